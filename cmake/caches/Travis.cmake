@@ -33,6 +33,7 @@ set(OMR_GLUE ${CMAKE_SOURCE_DIR}/example/glue)
 set(OMR_GC_SEGREGATED_HEAP ON CACHE BOOL "")
 set(OMR_GC_MODRON_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_MODRON_CONCURRENT_MARK ON CACHE BOOL "")
+set(OMR_GC_MODRON_COMPACTION ON CACHE BOOL "")
 set(OMR_THR_CUSTOM_SPIN_OPTIONS ON CACHE BOOL "")
 set(OMR_NOTIFY_POLICY_CONTROL ON CACHE BOOL "")
 set(OMR_THR_SPIN_WAKE_CONTROL ON CACHE BOOL "")
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrhashtable.h"
+
+#include "CompactScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "omrExampleVM.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "Task.hpp"
+
+#include "CompactDelegate.hpp"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+void
+MM_CompactDelegate::fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		J9HashTableState state;
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				if (NULL != rootEntry->rootPtr) {
+					rootEntry->rootPtr = compactScheme->getForwardingPtr(rootEntry->rootPtr);
+				}
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				if (NULL != objectEntry->objPtr) {
+					objectEntry->objPtr = compactScheme->getForwardingPtr(objectEntry->objPtr);
+				}
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+		OMR_VMThread *walkThread;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+			if (NULL != walkThread->_savedObject1) {
+				walkThread->_savedObject1 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				walkThread->_savedObject2 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+			}
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
@@ -77,8 +77,11 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
-	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	/**
+	 * Update the roots, the tracked objects and the objects saved by threads to the new
+	 * locations of the objects they refer to.
+	 */
+	void fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
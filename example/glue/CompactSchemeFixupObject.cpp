@@ -24,20 +24,27 @@
 
 #include "CompactSchemeFixupObject.hpp"
 #include "EnvironmentStandard.hpp"
+#include "ObjectIterator.hpp"
+#include "SlotObject.hpp"
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 void
 MM_CompactSchemeFixupObject::fixupObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
-#error provide an implementation to fix objects during a compact
+	GC_ObjectIterator objectIterator(_omrVM, objectPtr);
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		_compactScheme->fixupObjectSlot(slotObject);
+	}
 }
 
 
 void
 MM_CompactSchemeFixupObject::verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr)
 {
-#error provide an implementation to verify objects after a compact is complete
+	/* objects only ever slide towards the base of their region */
+	Assert_MM_true(forwardingPtr <= objectPtr);
 }
 
 #endif /* OMR_GC_MODRON_COMPACTION */
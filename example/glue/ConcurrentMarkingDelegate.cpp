@@ -21,8 +21,13 @@
 
 #include "ConcurrentMarkingDelegate.hpp"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "omrhashtable.h"
+
+#include "ConcurrentEvacuator.hpp"
 #include "ConcurrentGC.hpp"
 #include "MarkingScheme.hpp"
+#include "omrExampleVM.hpp"
+#include "OMRVMThreadListIterator.hpp"
 
 bool
 MM_ConcurrentMarkingDelegate::initialize(MM_EnvironmentBase *env, MM_ConcurrentGC *collector)
@@ -51,6 +56,30 @@ MM_ConcurrentMarkingDelegate::collectRoots(MM_EnvironmentBase *env, uintptr_t co
 
 	return bytesScanned;
 }
+
+void
+MM_ConcurrentMarkingDelegate::evacuateRoots(MM_EnvironmentBase *env, MM_ConcurrentEvacuator *evacuator)
+{
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	J9HashTableState state;
+	RootEntry *rEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+	while (rEntry != NULL) {
+		rEntry->rootPtr = evacuator->resolve(env, rEntry->rootPtr);
+		rEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+	/* The object table is how the example runtime reaches objects, it must never hold a stale address */
+	ObjectEntry *objEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+	while (objEntry != NULL) {
+		objEntry->objPtr = evacuator->resolve(env, objEntry->objPtr);
+		objEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+	OMR_VMThread *walkThread;
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+		walkThread->_savedObject1 = evacuator->resolve(env, (omrobjectptr_t)walkThread->_savedObject1);
+		walkThread->_savedObject2 = evacuator->resolve(env, (omrobjectptr_t)walkThread->_savedObject2);
+	}
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 
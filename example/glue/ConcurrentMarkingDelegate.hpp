@@ -28,17 +28,19 @@
 #include "omrgcconsts.h"
 #include "omrport.h"
 
+#include "ConcurrentMarkingDelegateBase.hpp"
 #include "ConcurrentSafepointCallback.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 
+class MM_ConcurrentEvacuator;
 class MM_ConcurrentGC;
 class MM_MarkingScheme;
 
 /**
  * Provides language-specific support for marking.
  */
-class MM_ConcurrentMarkingDelegate
+class MM_ConcurrentMarkingDelegate : public MM_ConcurrentMarkingDelegateBase
 {
 	/*
 	 * Data members
@@ -227,6 +229,14 @@ public:
 	 */
 	MMINLINE void processItem(MM_EnvironmentBase *env, omrobjectptr_t objectPtr) { }
 
+	/**
+	 * Replace the references held in the root table, the object table and the threads of the example
+	 * runtime with their new locations once a concurrent evacuation set has been selected.
+	 *
+	 * @see MM_ConcurrentMarkingDelegateBase::evacuateRoots(MM_EnvironmentBase *, MM_ConcurrentEvacuator *)
+	 */
+	void evacuateRoots(MM_EnvironmentBase *env, MM_ConcurrentEvacuator *evacuator);
+
 	/**
 	 * Scan a thread structure and stack frames for roots. Implementation must call
 	 * MM_MarkingScheme::markObject(..) for each heap object reference found on the
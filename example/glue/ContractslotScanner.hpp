@@ -19,6 +19,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
  *******************************************************************************/
 
+#include "omrExampleVM.hpp"
+#include "omrhashtable.h"
+
 #include "Base.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -26,6 +29,7 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "ModronAssertions.h"
+#include "OMRVMThreadListIterator.hpp"
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
@@ -63,7 +67,28 @@ public:
 	void
 	scanAllSlots(MM_EnvironmentBase *env)
 	{
-		Assert_MM_unimplemented();
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		J9HashTableState state;
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				doSlot(&rootEntry->rootPtr);
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				doSlot(&objectEntry->objPtr);
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+		OMR_VMThread *walkThread;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+			doSlot((omrobjectptr_t *)&walkThread->_savedObject1);
+			doSlot((omrobjectptr_t *)&walkThread->_savedObject2);
+		}
 	}
 
 	/* TODO remove this function as it is Java specific */
@@ -50,6 +50,13 @@ MM_EnvironmentDelegate::detachVMThread(OMR_VM *omrVM, OMR_VMThread *omrVMThread,
 	}
 }
 
+void
+MM_EnvironmentDelegate::getAllocationSite(omrobjectptr_t omrObject, const void **type, const void **callSite)
+{
+	*type = (const void *)_env->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(omrObject);
+	*callSite = NULL;
+}
+
 void
 MM_EnvironmentDelegate::acquireVMAccess()
 {
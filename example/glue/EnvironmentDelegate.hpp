@@ -163,6 +163,21 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return true; }
 
+	/**
+	 * Report the site of an object sampled by the allocation site sampler. The type and the call site
+	 * are opaque to OMR, which only compares them; a call site that is a method dictionary key can be
+	 * described by agents with OMR_TI GetMethodDescriptions(). This is called while the thread has
+	 * VM access, right after the object is initialized.
+	 *
+	 * The example language has no types or methods, so objects are told apart by their size and have
+	 * no call site.
+	 *
+	 * @param omrObject the object allocated by the sampled allocation
+	 * @param[out] type the type of the object
+	 * @param[out] callSite the call site which allocated the object, NULL if it is not known
+	 */
+	void getAllocationSite(omrobjectptr_t omrObject, const void **type, const void **callSite);
+
 	/**
 	 * Acquire shared VM access. Threads must acquire VM access before accessing any OMR internal
 	 * structures such as the heap. Requests for VM access will be blocked if any other thread is
@@ -25,6 +25,7 @@
 #include "ObjectScanner.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
+#include "omrExampleVM.hpp"
 
 class GC_MixedObjectScanner : public GC_ObjectScanner
 {
@@ -47,7 +48,7 @@ protected:
 	 * @param[in] flags Scanning context flags
 	 */
 	MMINLINE GC_MixedObjectScanner(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t flags)
-		: GC_ObjectScanner(env, objectPtr, (fomrobject_t *)objectPtr + 1, 0, flags, 0)
+		: GC_ObjectScanner(env, objectPtr, (fomrobject_t *)objectPtr + 1, 0, flags, ((OMR_VM_Example *)env->getOmrVM()->_language_vm)->hotFieldsDescriptor)
 		, _endPtr((fomrobject_t *)((uint8_t*)objectPtr + MM_GCExtensionsBase::getExtensions(env->getOmrVM())->objectModel.getConsumedSizeInBytesWithHeader(objectPtr)))
 		, _mapPtr(_scanPtr)
 	{
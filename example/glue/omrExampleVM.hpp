@@ -34,6 +34,7 @@ typedef struct OMR_VM_Example {
 	omrthread_t self;
 	omrthread_rwmutex_t _vmAccessMutex;
 	volatile uintptr_t _vmExclusiveAccessCount;
+	uintptr_t hotFieldsDescriptor; /**< Hot fields descriptor shared by all objects, standing in for per-type profiling data (0 if there is none) */
 } OMR_VM_Example;
 
 typedef struct RootEntry {
@@ -0,0 +1,217 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+
+#include "gcTestHelpers.hpp"
+#include "CompactSummaryTable.hpp"
+
+/* The table never touches the heap, so the regions are made up address ranges */
+#define SUMMARYTABLE_TEST_CHUNK_SIZE ((uintptr_t)4096)
+#define SUMMARYTABLE_TEST_REGIONS 3
+#define SUMMARYTABLE_TEST_CHUNKS (131 + 1 + 64)
+
+static const uintptr_t regionLowAddresses[SUMMARYTABLE_TEST_REGIONS] = {0x10000000, 0x20000000, 0x30000000};
+/* several blocks ending with a short chunk, a single chunk, and exactly one full block */
+static const uintptr_t regionSizes[SUMMARYTABLE_TEST_REGIONS] = {
+	(130 * SUMMARYTABLE_TEST_CHUNK_SIZE) + 1000,
+	SUMMARYTABLE_TEST_CHUNK_SIZE,
+	MM_CompactSummaryTable::block_chunks * SUMMARYTABLE_TEST_CHUNK_SIZE
+};
+
+class gcFunctionalTestCompactSummaryTable : public ::testing::Test
+{
+protected:
+	MM_CompactSummaryTable table;
+	void *memory;
+	uintptr_t expectedBlockCount;
+	uintptr_t expectedChunkCount;
+
+	virtual void
+	SetUp()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		expectedBlockCount = 0;
+		expectedChunkCount = 0;
+		for (uintptr_t i = 0; i < SUMMARYTABLE_TEST_REGIONS; i++) {
+			uintptr_t chunkCount = MM_CompactSummaryTable::getChunkCountForSize(regionSizes[i], SUMMARYTABLE_TEST_CHUNK_SIZE);
+			expectedChunkCount += chunkCount;
+			expectedBlockCount += MM_CompactSummaryTable::getBlockCountForChunks(chunkCount);
+		}
+		memory = omrmem_allocate_memory(MM_CompactSummaryTable::getTableSize(SUMMARYTABLE_TEST_REGIONS, expectedBlockCount, expectedChunkCount), OMRMEM_CATEGORY_MM);
+		ASSERT_TRUE(NULL != memory);
+
+		table.attach(memory, SUMMARYTABLE_TEST_REGIONS, expectedBlockCount, SUMMARYTABLE_TEST_CHUNK_SIZE);
+		for (uintptr_t i = 0; i < SUMMARYTABLE_TEST_REGIONS; i++) {
+			table.addRegion(NULL, regionLowAddresses[i], regionLowAddresses[i] + regionSizes[i]);
+		}
+	}
+
+	virtual void
+	TearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		table.detach();
+		omrmem_free_memory(memory);
+	}
+
+	/**
+	 * Lay out live objects of pseudo random sizes and gaps in every region, some of them spanning several chunks,
+	 * and record them in the table once per chunk, the way the mark map pass of the compaction does.
+	 */
+	void
+	recordLiveness(uint32_t seed)
+	{
+		uintptr_t liveBytes[SUMMARYTABLE_TEST_CHUNKS];
+		uintptr_t liveEnds[SUMMARYTABLE_TEST_CHUNKS];
+		for (uintptr_t chunkIndex = 0; chunkIndex < table.getChunkCount(); chunkIndex++) {
+			liveBytes[chunkIndex] = 0;
+			liveEnds[chunkIndex] = 0;
+		}
+
+		for (uintptr_t regionIndex = 0; regionIndex < table.getRegionCount(); regionIndex++) {
+			MM_CompactSummaryTable::RegionEntry *region = table.getRegion(regionIndex);
+			uintptr_t highAddress = regionLowAddresses[regionIndex] + regionSizes[regionIndex];
+			uintptr_t cursor = (uintptr_t)region->lowAddress;
+			while (true) {
+				seed = (seed * 1103515245) + 12345;
+				cursor += ((seed >> 8) % 4) * 1024;
+				seed = (seed * 1103515245) + 12345;
+				uintptr_t size = (0 == ((seed >> 8) % 16)) ? (((seed >> 12) % 3) + 1) * SUMMARYTABLE_TEST_CHUNK_SIZE : 16 + (((seed >> 12) % 64) * 8);
+				if ((cursor + size) > highAddress) {
+					break;
+				}
+				uintptr_t chunkIndex = region->firstChunk + ((cursor - (uintptr_t)region->lowAddress) / SUMMARYTABLE_TEST_CHUNK_SIZE);
+				liveBytes[chunkIndex] += size;
+				liveEnds[chunkIndex] = cursor + size;
+				cursor += size;
+			}
+		}
+
+		for (uintptr_t blockIndex = 0; blockIndex < table.getBlockCount(); blockIndex++) {
+			MM_CompactSummaryTable::BlockEntry *block = table.getBlock(blockIndex);
+			for (uintptr_t chunkIndex = block->firstChunk; chunkIndex < (block->firstChunk + block->chunkCount); chunkIndex++) {
+				table.setChunkLiveness(block, table.getChunk(chunkIndex), liveBytes[chunkIndex], (omrobjectptr_t)liveEnds[chunkIndex]);
+			}
+		}
+	}
+};
+
+TEST_F(gcFunctionalTestCompactSummaryTable, build)
+{
+	ASSERT_EQ((uintptr_t)SUMMARYTABLE_TEST_REGIONS, table.getRegionCount());
+	ASSERT_EQ((uintptr_t)SUMMARYTABLE_TEST_CHUNKS, expectedChunkCount);
+	ASSERT_EQ((uintptr_t)(3 + 1 + 1), expectedBlockCount);
+	ASSERT_EQ(expectedChunkCount, table.getChunkCount());
+	ASSERT_EQ(expectedBlockCount, table.getBlockCount());
+
+	uintptr_t chunkIndex = 0;
+	uintptr_t blockIndex = 0;
+	for (uintptr_t regionIndex = 0; regionIndex < table.getRegionCount(); regionIndex++) {
+		MM_CompactSummaryTable::RegionEntry *region = table.getRegion(regionIndex);
+		uintptr_t highAddress = regionLowAddresses[regionIndex] + regionSizes[regionIndex];
+		ASSERT_EQ(regionLowAddresses[regionIndex], (uintptr_t)region->lowAddress);
+		ASSERT_EQ(chunkIndex, region->firstChunk);
+		ASSERT_EQ(blockIndex, region->firstBlock);
+
+		/* the blocks of a region are full but for the last one, and together cover all of its chunks */
+		uintptr_t regionChunkCount = MM_CompactSummaryTable::getChunkCountForSize(regionSizes[regionIndex], SUMMARYTABLE_TEST_CHUNK_SIZE);
+		ASSERT_EQ(MM_CompactSummaryTable::getBlockCountForChunks(regionChunkCount), region->blockCount);
+		for (uintptr_t i = 0; i < region->blockCount; i++) {
+			MM_CompactSummaryTable::BlockEntry *block = table.getBlock(blockIndex + i);
+			ASSERT_EQ(region->firstChunk + (i * MM_CompactSummaryTable::block_chunks), block->firstChunk);
+			uintptr_t expectedChunks = ((i + 1) < region->blockCount) ? (uintptr_t)MM_CompactSummaryTable::block_chunks : regionChunkCount - (i * MM_CompactSummaryTable::block_chunks);
+			ASSERT_EQ(expectedChunks, block->chunkCount);
+			ASSERT_EQ((uintptr_t)0, block->liveBytes);
+		}
+
+		/* the chunks tile the region, the last one being cut short at its top */
+		uintptr_t expectedBase = regionLowAddresses[regionIndex];
+		for (uintptr_t i = 0; i < regionChunkCount; i++) {
+			MM_CompactSummaryTable::ChunkEntry *chunk = table.getChunk(chunkIndex + i);
+			ASSERT_EQ(expectedBase, (uintptr_t)chunk->base);
+			ASSERT_EQ(OMR_MIN(expectedBase + SUMMARYTABLE_TEST_CHUNK_SIZE, highAddress), (uintptr_t)chunk->top);
+			ASSERT_EQ(regionIndex, chunk->regionIndex);
+			ASSERT_EQ((uintptr_t)0, chunk->liveBytes);
+			expectedBase = (uintptr_t)chunk->top;
+		}
+		ASSERT_EQ(highAddress, expectedBase);
+
+		chunkIndex += regionChunkCount;
+		blockIndex += region->blockCount;
+	}
+}
+
+TEST_F(gcFunctionalTestCompactSummaryTable, destinationsAndSources)
+{
+	for (uint32_t seed = 1; seed <= 8; seed++) {
+		if (1 < seed) {
+			/* start again from empty tables */
+			table.attach(memory, SUMMARYTABLE_TEST_REGIONS, expectedBlockCount, SUMMARYTABLE_TEST_CHUNK_SIZE);
+			for (uintptr_t i = 0; i < SUMMARYTABLE_TEST_REGIONS; i++) {
+				table.addRegion(NULL, regionLowAddresses[i], regionLowAddresses[i] + regionSizes[i]);
+			}
+		}
+		recordLiveness(seed);
+
+		/* Keep the end of the last live object of each chunk, as distributeBlock() replaces it with the running maximum */
+		uintptr_t ownLiveEnds[SUMMARYTABLE_TEST_CHUNKS];
+		for (uintptr_t chunkIndex = 0; chunkIndex < table.getChunkCount(); chunkIndex++) {
+			ownLiveEnds[chunkIndex] = (uintptr_t)table.getChunk(chunkIndex)->liveEnd;
+		}
+
+		for (uintptr_t regionIndex = 0; regionIndex < table.getRegionCount(); regionIndex++) {
+			table.scanRegion(regionIndex);
+		}
+		for (uintptr_t blockIndex = 0; blockIndex < table.getBlockCount(); blockIndex++) {
+			table.distributeBlock(blockIndex);
+		}
+
+		for (uintptr_t regionIndex = 0; regionIndex < table.getRegionCount(); regionIndex++) {
+			MM_CompactSummaryTable::RegionEntry *region = table.getRegion(regionIndex);
+			uintptr_t chunkTop = (regionIndex + 1 < table.getRegionCount()) ? table.getRegion(regionIndex + 1)->firstChunk : table.getChunkCount();
+			uintptr_t destination = (uintptr_t)region->lowAddress;
+			uintptr_t liveEnd = (uintptr_t)region->lowAddress;
+			for (uintptr_t chunkIndex = region->firstChunk; chunkIndex < chunkTop; chunkIndex++) {
+				MM_CompactSummaryTable::ChunkEntry *chunk = table.getChunk(chunkIndex);
+
+				/* the live data of the chunk slides down to follow that of the earlier chunks of the region */
+				ASSERT_EQ(destination, (uintptr_t)chunk->destination) << "seed " << seed << " chunk " << chunkIndex;
+				destination += chunk->liveBytes;
+				liveEnd = OMR_MAX(liveEnd, ownLiveEnds[chunkIndex]);
+				ASSERT_EQ(liveEnd, (uintptr_t)chunk->liveEnd) << "seed " << seed << " chunk " << chunkIndex;
+
+				/* the chunks the move must wait for are exactly those holding live data above its destination */
+				uintptr_t expectedFirstSource = chunkIndex;
+				for (uintptr_t sourceIndex = region->firstChunk; sourceIndex < chunkIndex; sourceIndex++) {
+					if (ownLiveEnds[sourceIndex] > (uintptr_t)chunk->destination) {
+						expectedFirstSource = sourceIndex;
+						break;
+					}
+				}
+				ASSERT_EQ(expectedFirstSource, table.findFirstSourceChunk(chunkIndex)) << "seed " << seed << " chunk " << chunkIndex;
+			}
+			ASSERT_EQ(destination, (uintptr_t)region->newTop) << "seed " << seed << " region " << regionIndex;
+		}
+	}
+}
@@ -19,16 +19,34 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
  *******************************************************************************/
 
+#include <algorithm>
+#include <ctype.h>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapSnapshotFormat.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseRingBufferFormat.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingSynchronous.hpp"
+#include "heapSnapshotReader.hpp"
+#include "verboseGCRingDecoder.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -39,15 +57,49 @@
 	}
 #define STRINGFY(str) DO_STRINGFY(str)
 #define DO_STRINGFY(str) #str
+#define MAX_ALLOCATION_SITES 64
 
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml",
                                 "fvtest/gctest/configuration/test_system_gc.xml",
                                 "fvtest/gctest/configuration/gencon_GC_config.xml",
                                 "fvtest/gctest/configuration/gencon_GC_backout_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_pausetarget_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_pausetargetfixed_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_phasetimeline_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_phasetrace_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_threadcount_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_tenuredecay_config.xml",
+                                "fvtest/gctest/configuration/gencon_GC_heapwalk_config.xml",
                                 "fvtest/gctest/configuration/scavenger_GC_config.xml",
                                 "fvtest/gctest/configuration/scavenger_GC_backout_config.xml",
+                                "fvtest/gctest/configuration/scavenger_GC_hotfieldcopy_config.xml",
+                                "fvtest/gctest/configuration/scavenger_GC_rememberedsetcards_config.xml",
                                	"fvtest/gctest/configuration/global_GC_config.xml",
-								"fvtest/gctest/configuration/optavgpause_GC_config.xml"};
+                               	"fvtest/gctest/configuration/global_GC_workstealingdeque_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_workstealingdequetiny_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_workstealingdequeshare_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_markmapcache_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_markingprefetch_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_numaworkpackets_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_threadcount_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_tlhadaptive_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_quicklists_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_loasizebands_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_hugepages_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_heapwalk_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_memorymaintenance_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_verbosering_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_allocationsampling_config.xml",
+                               	"fvtest/gctest/configuration/global_GC_heapsnapshot_config.xml",
+								"fvtest/gctest/configuration/optavgpause_GC_config.xml",
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+								"fvtest/gctest/configuration/optavgpause_GC_concurrentevacuation_config.xml",
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+								"fvtest/gctest/configuration/optavgpause_GC_compact_config.xml",
+								"fvtest/gctest/configuration/optavgpause_GC_compactsummary_config.xml",
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+								};
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
 								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
@@ -101,10 +153,37 @@ GCConfigTest::SetUp()
 	if (NULL == verboseFile) {
 		FAIL() << "Failed to allocate native memory.";
 	}
-	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	int64_t verboseFileTime = omrtime_current_time_millis();
+	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), verboseFileTime);
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
-	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
+	if (0 == env->getExtensions()->verboseRingBufferSize) {
+		verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
+	} else {
+		/* write the ring to a file of its own, and the same output as text to verboseFile so the ring can be checked against it */
+		verboseRingFile = (char *)omrmem_allocate_memory(MAX_NAME_LENGTH, OMRMEM_CATEGORY_MM);
+		if (NULL == verboseRingFile) {
+			FAIL() << "Failed to allocate native memory.";
+		}
+		omrstr_printf(verboseRingFile, MAX_NAME_LENGTH, "%s_%d_%lld.ring", verboseFileNamePrefix, omrsysinfo_get_pid(), verboseFileTime);
+		verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseRingFile, 0, 0);
+		gcTestEnv->log("Verbose Ring File: %s\n", verboseRingFile);
+		MM_VerboseWriter *textWriter = MM_VerboseWriterFileLoggingSynchronous::newInstance(env, verboseManager, verboseFile, numOfFiles, numOfCycles);
+		if (NULL == textWriter) {
+			FAIL() << "Failed to create the text verbose writer.";
+		}
+		textWriter->isActive(true);
+		verboseManager->getWriterChain()->addWriter(textWriter);
+	}
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
+	if (NULL != env->getExtensions()->gcPhaseTraceFileName) {
+		/* the trace is complete once the dispatcher is shut down, it is checked then */
+		phaseTraceFile = (char *)omrmem_allocate_memory(strlen(env->getExtensions()->gcPhaseTraceFileName) + 1, OMRMEM_CATEGORY_MM);
+		if (NULL == phaseTraceFile) {
+			FAIL() << "Failed to allocate native memory.";
+		}
+		strcpy(phaseTraceFile, env->getExtensions()->gcPhaseTraceFileName);
+		gcTestEnv->log("GC Phase Trace File: %s\n", phaseTraceFile);
+	}
 	gcTestEnv->log(LEVEL_VERBOSE, "Verbose GC log name: %s; numOfFiles: %d; numOfCycles: %d.\n", verboseFile, numOfFiles, numOfCycles);
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
@@ -173,6 +252,13 @@ GCConfigTest::TearDown()
 	}
 	omrmem_free_memory((void *)verboseFile);
 	verboseFile = NULL;
+	if (NULL != verboseRingFile) {
+		if (false == gcTestEnv->keepLog) {
+			omrfile_unlink(verboseRingFile);
+		}
+		omrmem_free_memory((void *)verboseRingFile);
+		verboseRingFile = NULL;
+	}
 
 	cli->kill(env);
 
@@ -180,6 +266,15 @@ GCConfigTest::TearDown()
 	omr_error_t rc = OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread);
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownDispatcherThreads failed, rc=" << rc;
 
+	if (NULL != phaseTraceFile) {
+		EXPECT_EQ(0, verifyPhaseTrace()) << "Failed in GC phase trace verification.";
+		if (false == gcTestEnv->keepLog) {
+			omrfile_unlink(phaseTraceFile);
+		}
+		omrmem_free_memory((void *)phaseTraceFile);
+		phaseTraceFile = NULL;
+	}
+
 	/* Shut down collector */
 	rc = OMR_GC_ShutdownCollector(exampleVM->_omrVMThread);
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownCollector failed, rc=" << rc;
@@ -682,7 +777,7 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
+		if (objEntry->objPtr == standardReadBarrier(exampleVM->_omrVMThread, parentEntry->objPtr, currentSlot)) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, *(objEntry->objPtr), parentEntry->name, parentEntry->objPtr, *(parentEntry->objPtr), slotObject.readAddressFromSlot());
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
@@ -900,6 +995,380 @@ done:
 	return rt;
 }
 
+/**
+ * Read a whole file into contents.
+ * @return true if the file was read
+ */
+static bool
+readWholeFile(OMRPortLibrary *portLibrary, const char *fileName, std::string &contents)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+	int64_t length = omrfile_flength(fd);
+	bool result = (0 <= length);
+	if (result) {
+		contents.resize((size_t)length);
+		result = (0 == length) || (length == omrfile_read(fd, &contents[0], (intptr_t)length));
+	}
+	omrfile_close(fd);
+	return result;
+}
+
+/**
+ * Check the header and the record kinds of the verbose GC ring written alongside verboseFile, then check that
+ * it decodes to the same XML as the text writer wrote to verboseFile during the same run.
+ */
+int32_t
+GCConfigTest::verifyVerboseRing()
+{
+	int32_t rt = 0;
+	std::string ring;
+	std::string text;
+	std::string decoded;
+
+	gcTestEnv->log("Verifying verbose GC ring %s against %s:\n", verboseRingFile, verboseFile);
+	if (!isVerboseGCRing(gcTestEnv->portLib, verboseRingFile) || !readWholeFile(gcTestEnv->portLib, verboseRingFile, ring) || (ring.size() < sizeof(VerboseRingBufferHeader))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %s is not a verbose GC ring.\n", __FILE__, __LINE__, verboseRingFile);
+		return 1;
+	}
+
+	const VerboseRingBufferHeader *header = (const VerboseRingBufferHeader *)ring.data();
+	if ((VERBOSE_RING_BUFFER_VERSION != header->version)
+		|| (sizeof(void *) != header->pointerSize)
+		|| (0 == header->formatCount)
+		|| (header->tail >= header->head)
+		|| (0 != header->overwrittenRecords)
+		|| (0 != header->droppedRecords)
+		|| ((header->textOffset + header->headerTextLength + header->footerTextLength) > ring.size())
+		|| ((header->ringOffset + header->ringSize) > ring.size())
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Unexpected verbose GC ring header: version=%u formatCount=%u tail=%llu head=%llu overwrittenRecords=%llu droppedRecords=%llu\n",
+				__FILE__, __LINE__, header->version, header->formatCount, header->tail, header->head, header->overwrittenRecords, header->droppedRecords);
+		return 1;
+	}
+
+	/* every line output by the GC has a format of a few arguments, so all of the records should be formatted ones (or padding) */
+	uintptr_t recordCounts[VERBOSE_RING_BUFFER_RECORD_TEXT + 1] = {0, 0, 0};
+	const uint8_t *records = (const uint8_t *)ring.data() + header->ringOffset;
+	for (uint64_t position = header->tail; position < header->head;) {
+		const VerboseRingBufferRecord *record = (const VerboseRingBufferRecord *)(records + (position % header->ringSize));
+		if ((record->length < sizeof(VerboseRingBufferRecord)) || (VERBOSE_RING_BUFFER_RECORD_TEXT < record->type)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Corrupt verbose GC ring record at %llu.\n", __FILE__, __LINE__, position);
+			return 1;
+		}
+		recordCounts[record->type] += 1;
+		position += record->length;
+	}
+	gcTestEnv->log("\t%u formats, %zu formatted records, %zu text records, %zu padding records\n",
+			header->formatCount, recordCounts[VERBOSE_RING_BUFFER_RECORD_FORMATTED], recordCounts[VERBOSE_RING_BUFFER_RECORD_TEXT], recordCounts[VERBOSE_RING_BUFFER_RECORD_PAD]);
+	if ((0 == recordCounts[VERBOSE_RING_BUFFER_RECORD_FORMATTED]) || (0 != recordCounts[VERBOSE_RING_BUFFER_RECORD_TEXT])) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected only formatted records in the verbose GC ring.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	/* the text writer has not written its footer yet, as its stream is still open */
+	if (!decodeVerboseGCRing(gcTestEnv->portLib, verboseRingFile, decoded) || !readWholeFile(gcTestEnv->portLib, verboseFile, text)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode %s or to read %s.\n", __FILE__, __LINE__, verboseRingFile, verboseFile);
+		return 1;
+	}
+	text.append(ring, (size_t)(header->textOffset + header->headerTextLength), header->footerTextLength);
+	if (decoded != text) {
+		size_t lineStart = 0;
+		size_t mismatch = 0;
+		while ((mismatch < decoded.size()) && (mismatch < text.size()) && (decoded[mismatch] == text[mismatch])) {
+			if ('\n' == decoded[mismatch]) {
+				lineStart = mismatch + 1;
+			}
+			mismatch += 1;
+		}
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Decoded verbose GC ring differs from the text output at offset %zu:\n\tring: %s\n\ttext: %s\n", __FILE__, __LINE__, mismatch,
+				decoded.substr(lineStart, decoded.find('\n', lineStart) - lineStart).c_str(), text.substr(lineStart, text.find('\n', lineStart) - lineStart).c_str());
+		rt = 1;
+	} else {
+		gcTestEnv->log("\tdecoded %zu bytes, identical to the text output\n", decoded.size());
+	}
+
+	return rt;
+}
+
+static void
+skipJSONWhitespace(const char **cursor, const char *end)
+{
+	while ((*cursor < end) && ((' ' == **cursor) || ('\t' == **cursor) || ('\n' == **cursor) || ('\r' == **cursor))) {
+		*cursor += 1;
+	}
+}
+
+/**
+ * Read a JSON string, unescaping it into value except for \u escapes, which are kept as written.
+ * @return false if the string is not valid JSON
+ */
+static bool
+readJSONString(const char **cursor, const char *end, std::string *value)
+{
+	if ((*cursor >= end) || ('"' != **cursor)) {
+		return false;
+	}
+	*cursor += 1;
+	value->clear();
+	while (*cursor < end) {
+		char c = **cursor;
+		*cursor += 1;
+		if ('"' == c) {
+			return true;
+		} else if ((unsigned char)c < ' ') {
+			return false;
+		} else if ('\\' == c) {
+			if (*cursor >= end) {
+				return false;
+			}
+			c = **cursor;
+			*cursor += 1;
+			if ('u' == c) {
+				if ((end - *cursor) < 4) {
+					return false;
+				}
+				for (uintptr_t i = 0; i < 4; i++) {
+					if (!isxdigit((unsigned char)(*cursor)[i])) {
+						return false;
+					}
+				}
+				value->append("\\u");
+				value->append(*cursor, 4);
+				*cursor += 4;
+			} else if (NULL != strchr("\"\\/bfnrt", c)) {
+				value->push_back(c);
+			} else {
+				return false;
+			}
+		} else {
+			value->push_back(c);
+		}
+	}
+	return false;
+}
+
+/**
+ * Read a JSON value. The text of a string or a number is returned in scalar, and the members of an object in
+ * members, with the text of their scalar values.
+ * @return false if the value is not valid JSON
+ */
+static bool
+readJSONValue(const char **cursor, const char *end, uintptr_t depth, std::string *scalar, std::map<std::string, std::string> *members)
+{
+	skipJSONWhitespace(cursor, end);
+	if ((*cursor >= end) || (64 < depth)) {
+		return false;
+	}
+	scalar->clear();
+	char c = **cursor;
+	if (('{' == c) || ('[' == c)) {
+		bool isObject = ('{' == c);
+		char close = isObject ? '}' : ']';
+		*cursor += 1;
+		skipJSONWhitespace(cursor, end);
+		if ((*cursor < end) && (close == **cursor)) {
+			*cursor += 1;
+			return true;
+		}
+		while (true) {
+			std::string key;
+			std::string memberScalar;
+			if (isObject) {
+				skipJSONWhitespace(cursor, end);
+				if (!readJSONString(cursor, end, &key)) {
+					return false;
+				}
+				skipJSONWhitespace(cursor, end);
+				if ((*cursor >= end) || (':' != **cursor)) {
+					return false;
+				}
+				*cursor += 1;
+			}
+			std::map<std::string, std::string> nestedMembers;
+			if (!readJSONValue(cursor, end, depth + 1, &memberScalar, &nestedMembers)) {
+				return false;
+			}
+			if (isObject && (NULL != members)) {
+				(*members)[key] = memberScalar;
+			}
+			skipJSONWhitespace(cursor, end);
+			if (*cursor >= end) {
+				return false;
+			}
+			if (close == **cursor) {
+				*cursor += 1;
+				return true;
+			} else if (',' != **cursor) {
+				return false;
+			}
+			*cursor += 1;
+		}
+	} else if ('"' == c) {
+		return readJSONString(cursor, end, scalar);
+	} else if (('-' == c) || isdigit((unsigned char)c)) {
+		/* -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)? */
+		const char *start = *cursor;
+		if ('-' == **cursor) {
+			*cursor += 1;
+		}
+		if ((*cursor >= end) || !isdigit((unsigned char)**cursor)) {
+			return false;
+		}
+		if ('0' == **cursor) {
+			*cursor += 1;
+		} else {
+			while ((*cursor < end) && isdigit((unsigned char)**cursor)) {
+				*cursor += 1;
+			}
+		}
+		if ((*cursor < end) && ('.' == **cursor)) {
+			*cursor += 1;
+			if ((*cursor >= end) || !isdigit((unsigned char)**cursor)) {
+				return false;
+			}
+			while ((*cursor < end) && isdigit((unsigned char)**cursor)) {
+				*cursor += 1;
+			}
+		}
+		if ((*cursor < end) && (('e' == **cursor) || ('E' == **cursor))) {
+			*cursor += 1;
+			if ((*cursor < end) && (('+' == **cursor) || ('-' == **cursor))) {
+				*cursor += 1;
+			}
+			if ((*cursor >= end) || !isdigit((unsigned char)**cursor)) {
+				return false;
+			}
+			while ((*cursor < end) && isdigit((unsigned char)**cursor)) {
+				*cursor += 1;
+			}
+		}
+		scalar->assign(start, *cursor - start);
+		return true;
+	} else {
+		const char *literals[] = { "true", "false", "null" };
+		for (uintptr_t i = 0; i < (sizeof(literals) / sizeof(literals[0])); i++) {
+			size_t length = strlen(literals[i]);
+			if (((size_t)(end - *cursor) >= length) && (0 == strncmp(*cursor, literals[i], length))) {
+				*cursor += length;
+				scalar->assign(literals[i]);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * Convert a trace timestamp or duration, in microseconds with up to 3 decimals, to nanoseconds.
+ */
+static uint64_t
+traceMicrosToNanos(const std::string &micros)
+{
+	uint64_t nanos = (uint64_t)strtoull(micros.c_str(), NULL, 10) * 1000;
+	size_t point = micros.find('.');
+	if (std::string::npos != point) {
+		uint64_t scale = 100;
+		for (size_t i = point + 1; (i < micros.size()) && (0 != scale); i++, scale /= 10) {
+			nanos += (uint64_t)(micros[i] - '0') * scale;
+		}
+	}
+	return nanos;
+}
+
+/**
+ * Order complete trace events by start, enclosing events first.
+ */
+static bool
+compareTraceEvents(const std::pair<uint64_t, uint64_t> &event, const std::pair<uint64_t, uint64_t> &other)
+{
+	return (event.first < other.first) || ((event.first == other.first) && (event.second > other.second));
+}
+
+/**
+ * Check that the GC phase trace written while the dispatcher ran is a valid JSON array of Chrome trace events,
+ * with at least one complete ("X") event, and that the complete events of each thread are balanced: each one
+ * ends before any event that encloses its start ends.
+ */
+int32_t
+GCConfigTest::verifyPhaseTrace()
+{
+	std::string trace;
+	gcTestEnv->log("Verifying GC phase trace %s:\n", phaseTraceFile);
+	if (!readWholeFile(gcTestEnv->portLib, phaseTraceFile, trace)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to read GC phase trace %s.\n", __FILE__, __LINE__, phaseTraceFile);
+		return 1;
+	}
+
+	const char *cursor = trace.data();
+	const char *end = cursor + trace.size();
+	std::map<std::string, std::vector<std::pair<uint64_t, uint64_t> > > threadEvents;
+	uintptr_t eventCount = 0;
+	bool valid = false;
+	skipJSONWhitespace(&cursor, end);
+	if ((cursor < end) && ('[' == *cursor)) {
+		cursor += 1;
+		valid = true;
+		while (valid) {
+			std::string scalar;
+			std::map<std::string, std::string> members;
+			valid = readJSONValue(&cursor, end, 1, &scalar, &members);
+			if (valid) {
+				const std::string &phase = members["ph"];
+				if ("X" == phase) {
+					uint64_t start = traceMicrosToNanos(members["ts"]);
+					threadEvents[members["tid"]].push_back(std::make_pair(start, start + traceMicrosToNanos(members["dur"])));
+				} else if (("M" != phase) && ("i" != phase)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Unexpected phase \"%s\" of event %zu.\n", __FILE__, __LINE__, phase.c_str(), eventCount);
+					return 1;
+				}
+				eventCount += 1;
+				skipJSONWhitespace(&cursor, end);
+				if ((cursor < end) && (']' == *cursor)) {
+					cursor += 1;
+					break;
+				}
+				valid = (cursor < end) && (',' == *cursor);
+				cursor += 1;
+			}
+		}
+		skipJSONWhitespace(&cursor, end);
+		valid = valid && (cursor == end);
+	}
+	if (!valid) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d GC phase trace %s is not a JSON array of events, at offset %zu.\n", __FILE__, __LINE__, phaseTraceFile, (size_t)(cursor - trace.data()));
+		return 1;
+	}
+
+	uintptr_t completeCount = 0;
+	for (std::map<std::string, std::vector<std::pair<uint64_t, uint64_t> > >::iterator thread = threadEvents.begin(); thread != threadEvents.end(); ++thread) {
+		/* the ends of the events enclosing the start of the current event are stacked */
+		std::vector<std::pair<uint64_t, uint64_t> > &events = thread->second;
+		std::sort(events.begin(), events.end(), compareTraceEvents);
+		std::vector<uint64_t> enclosingEnds;
+		for (std::vector<std::pair<uint64_t, uint64_t> >::const_iterator event = events.begin(); event != events.end(); ++event) {
+			while (!enclosingEnds.empty() && (enclosingEnds.back() <= event->first)) {
+				enclosingEnds.pop_back();
+			}
+			if (!enclosingEnds.empty() && (event->second > enclosingEnds.back())) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Event [%llu, %llu] of thread %s ends after an enclosing event ending at %llu.\n", __FILE__, __LINE__, event->first, event->second, thread->first.c_str(), enclosingEnds.back());
+				return 1;
+			}
+			enclosingEnds.push_back(event->second);
+		}
+		completeCount += events.size();
+	}
+	gcTestEnv->log("GC phase trace: %zu events, %zu complete events on %zu threads\n", eventCount, completeCount, threadEvents.size());
+	if (0 == completeCount) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No complete events in GC phase trace %s.\n", __FILE__, __LINE__, phaseTraceFile);
+		return 1;
+	}
+	return 0;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -947,6 +1416,406 @@ done:
 	return rt;
 }
 
+/* Totals gathered by a heap walk: the objects are summed by address to compare the sets walked */
+typedef struct HeapWalkTotals {
+	uintptr_t objectCount;
+	uintptr_t addressSum;
+	uintptr_t batchCount;
+	uintptr_t invalidBatchCount;
+} HeapWalkTotals;
+
+static void
+countObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkTotals *totals = (HeapWalkTotals *)userData;
+	totals->objectCount += 1;
+	totals->addressSum += (uintptr_t)object;
+}
+
+static void
+countObjectBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t objectCount, void *userData)
+{
+	HeapWalkTotals *totals = (HeapWalkTotals *)userData;
+	uintptr_t addressSum = 0;
+	bool valid = (0 < objectCount) && (PARALLEL_HEAP_WALKER_BATCH_SIZE >= objectCount);
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		addressSum += (uintptr_t)objects[i];
+		if (!region->isAddressInRegion(objects[i]) || ((0 < i) && (objects[i - 1] >= objects[i]))) {
+			valid = false;
+		}
+	}
+	/* called on all of the GC threads at once */
+	MM_AtomicOperations::add(&totals->objectCount, objectCount);
+	MM_AtomicOperations::add(&totals->addressSum, addressSum);
+	MM_AtomicOperations::add(&totals->batchCount, 1);
+	if (!valid) {
+		MM_AtomicOperations::add(&totals->invalidBatchCount, 1);
+	}
+}
+
+/**
+ * Walk the heap with the batched parallel walker, and check that it finds the objects a single threaded walk does.
+ */
+int32_t
+GCConfigTest::walkHeap(bool prepareHeapForWalk)
+{
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->isStandardGC()) {
+		gcTestEnv->log("Skipping heap walk: requires a standard GC policy\n");
+		return rt;
+	}
+	MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+	HeapWalkTotals serialTotals = {0, 0, 0, 0};
+	HeapWalkTotals parallelTotals = {0, 0, 0, 0};
+
+	env->acquireExclusiveVMAccess();
+	heapWalker->allObjectsBatchDo(env, countObjectBatch, &parallelTotals, 0, prepareHeapForWalk);
+	heapWalker->allObjectsDo(env, countObject, &serialTotals, 0, false, false);
+	env->releaseExclusiveVMAccess();
+
+	gcTestEnv->log("Heap walk (prepareHeapForWalk=%d): %zu objects, %zu batches\n", prepareHeapForWalk, parallelTotals.objectCount, parallelTotals.batchCount);
+	if ((serialTotals.objectCount != parallelTotals.objectCount) || (serialTotals.addressSum != parallelTotals.addressSum)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk found %zu objects, single threaded walk found %zu.\n", __FILE__, __LINE__, parallelTotals.objectCount, serialTotals.objectCount);
+		rt = 1;
+	} else if (0 != parallelTotals.invalidBatchCount) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk produced %zu invalid batches.\n", __FILE__, __LINE__, parallelTotals.invalidBatchCount);
+		rt = 1;
+	}
+	return rt;
+}
+
+/**
+ * Query the sampled allocation sites, as an agent would, and check that at least minSites are ranked by allocated bytes.
+ */
+int32_t
+GCConfigTest::verifyAllocationSites(int32_t minSites)
+{
+	int32_t rt = 0;
+	OMR_TI_AllocationSite sites[MAX_ALLOCATION_SITES];
+	int32_t writtenCount = 0;
+	int32_t totalCount = 0;
+
+	omr_error_t rc = OMR_GC_GetAllocationSites(exampleVM->_omrVMThread, MAX_ALLOCATION_SITES, sites, &writtenCount, &totalCount);
+	if (OMR_ERROR_NONE != rc) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_GetAllocationSites with error code %d.\n", __FILE__, __LINE__, rc);
+		return 1;
+	}
+
+	gcTestEnv->log("%d of %d allocation sites:\n", writtenCount, totalCount);
+	for (int32_t i = 0; i < writtenCount; i++) {
+		gcTestEnv->log("\ttype %p, call site %p: %llu bytes, %llu samples\n", sites[i].type, sites[i].callSite, sites[i].allocatedBytes, sites[i].sampleCount);
+		if ((0 < i) && (sites[i].allocatedBytes > sites[i - 1].allocatedBytes)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation site %d allocated more bytes than the site ranked before it.\n", __FILE__, __LINE__, i);
+			rt = 1;
+		}
+	}
+	if (writtenCount < minSites) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected at least %d allocation sites, found %d.\n", __FILE__, __LINE__, minSites, writtenCount);
+		rt = 1;
+	}
+	return rt;
+}
+
+/**
+ * Wait for the memory maintenance thread to finish zeroing the free memory left by the last collection, then allocate
+ * unreferenced objects, so that the TLHs they are allocated from are carved from pre-zeroed memory.
+ */
+int32_t
+GCConfigTest::allocateAfterMemoryMaintenance(uintptr_t objectCount, uintptr_t objectSize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->memoryMaintenance) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The memoryMaintenance operation requires the memoryMaintenance option.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	/* zeroing is done once the count has been stable for a while; give up after 10 seconds */
+	uintptr_t bytesZeroed = extensions->memoryManager->getBytesPreZeroed();
+	uintptr_t stablePolls = 0;
+	for (uintptr_t poll = 0; (poll < 1000) && ((0 == bytesZeroed) || (stablePolls < 10)); poll++) {
+		omrthread_sleep(10);
+		uintptr_t currentBytesZeroed = extensions->memoryManager->getBytesPreZeroed();
+		stablePolls = (currentBytesZeroed == bytesZeroed) ? (stablePolls + 1) : 0;
+		bytesZeroed = currentBytesZeroed;
+	}
+	gcTestEnv->log("Memory maintenance thread zeroed %zu bytes\n", bytesZeroed);
+	if (0 == bytesZeroed) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The memory maintenance thread did not zero any memory.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	return allocateUnreferenced(objectCount, objectSize);
+}
+
+/**
+ * Allocate objects which are not referenced from the root or object tables.
+ */
+int32_t
+GCConfigTest::allocateUnreferenced(uintptr_t objectCount, uintptr_t objectSize)
+{
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *allocationModel = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, objectSize, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		if (NULL == OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate object of size 0x%zx.\n", __FILE__, __LINE__, objectSize);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Check that every reference the test stored in the objects of the object table refers to an object of the
+ * table, as it must once the collector has moved objects (e.g. by compacting the heap). The glue drops the
+ * objects a global collection did not mark from the table, so this also finds live objects the mark missed.
+ */
+int32_t
+GCConfigTest::verifyReferences()
+{
+	int32_t rt = 0;
+	std::set<omrobjectptr_t> objects;
+	J9HashTableState state;
+	ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+	while (NULL != objectEntry) {
+		objects.insert(objectEntry->objPtr);
+		objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+
+	uintptr_t referenceCount = 0;
+	objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+	while (NULL != objectEntry) {
+		fomrobject_t *firstSlot = (fomrobject_t *)objectEntry->objPtr + 1;
+		for (int32_t i = 0; i < objectEntry->numOfRef; i++) {
+			omrobjectptr_t child = standardReadBarrier(exampleVM->_omrVMThread, objectEntry->objPtr, firstSlot + i);
+			if (NULL != child) {
+				referenceCount += 1;
+				if (objects.end() == objects.find(child)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Slot %d of %s(%p) refers to %p, which is not an object of the object table.\n", __FILE__, __LINE__, i, objectEntry->name, objectEntry->objPtr, child);
+					rt = 1;
+				}
+			}
+		}
+		objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+
+	gcTestEnv->log("Verified %zu references between %zu objects\n", referenceCount, objects.size());
+	if (0 == referenceCount) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No references to verify.\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+	return rt;
+}
+
+/**
+ * Check that the heap, which the configuration must ask to be backed by transparent huge pages, is at least partly
+ * backed by them. The check is skipped where the system does not offer transparent huge pages.
+ */
+int32_t
+GCConfigTest::verifyHugePages()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (MM_GCExtensionsBase::HEAP_HUGE_PAGES_TRANSPARENT != extensions->heapHugePages) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The hugePages operation requires heapHugePages=\"transparent\".\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	/* the selected mode is bracketed, e.g. "always [madvise] never" */
+	char enabled[128] = "";
+	intptr_t fd = omrfile_open("/sys/kernel/mm/transparent_hugepage/enabled", EsOpenRead, 0);
+	if (-1 != fd) {
+		intptr_t length = omrfile_read(fd, enabled, sizeof(enabled) - 1);
+		enabled[(0 < length) ? length : 0] = '\0';
+		omrfile_close(fd);
+	}
+	if ((NULL == strstr(enabled, "[always]")) && (NULL == strstr(enabled, "[madvise]"))) {
+		gcTestEnv->log("Skipping huge page check: transparent huge pages are not available\n");
+		return 0;
+	}
+
+	uintptr_t backedBytes = extensions->heap->getHugePageBackedSize();
+	gcTestEnv->log("%zu bytes of the heap are backed by huge pages of %zu bytes\n", backedBytes, extensions->heapHugePageSize);
+	if (0 == backedBytes) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No part of the heap is backed by huge pages.\n", __FILE__, __LINE__);
+		return 1;
+	}
+	return 0;
+}
+
+static uint64_t
+readVarint(const uint8_t **cursor, const uint8_t *end)
+{
+	uint64_t value = 0;
+	for (uint32_t shift = 0; (*cursor < end) && (shift < 64); shift += 7) {
+		uint8_t byte = **cursor;
+		*cursor += 1;
+		value |= ((uint64_t)(byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80)) {
+			break;
+		}
+	}
+	return value;
+}
+
+/**
+ * Decode a heap snapshot, then check that it holds the objects and references of its totals and, unless rootName is
+ * empty, that the retained size of that root object is the size of the objects reachable from it. The objects
+ * reachable from the root must not be referenced by any other object.
+ */
+int32_t
+GCConfigTest::verifyHeapSnapshot(const char *fileName, uint64_t objectCount, uint64_t referenceCount, const char *rootName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	HeapSnapshotGraph graph;
+	if (!readHeapSnapshot(gcTestEnv->portLib, fileName, graph)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode heap snapshot %s.\n", __FILE__, __LINE__, fileName);
+		return 1;
+	}
+	gcTestEnv->log("Decoded heap snapshot: %zu objects, %zu references, %llu dangling references\n", graph.offsets.size(), graph.references.size(), graph.danglingReferenceCount);
+	if ((objectCount != graph.offsets.size()) || (referenceCount != graph.references.size()) || (0 != graph.danglingReferenceCount)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected %llu objects and %llu references in the decoded heap snapshot.\n", __FILE__, __LINE__, objectCount, referenceCount);
+		return 1;
+	}
+	if (0 == strcmp(rootName, "")) {
+		return 0;
+	}
+
+	ObjectEntry *rootEntry = find(rootName);
+	if (NULL == rootEntry) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find object %s in hash table.\n", __FILE__, __LINE__, rootName);
+		return 1;
+	}
+	uint64_t rootOffset = ((uint64_t)(uintptr_t)rootEntry->objPtr - graph.heapBase) / graph.objectAlignment;
+	std::vector<uint64_t>::const_iterator found = std::lower_bound(graph.offsets.begin(), graph.offsets.end(), rootOffset);
+	if ((graph.offsets.end() == found) || (rootOffset != *found)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %s(%p) is missing from the heap snapshot.\n", __FILE__, __LINE__, rootName, rootEntry->objPtr);
+		return 1;
+	}
+	size_t root = (size_t)(found - graph.offsets.begin());
+
+	/* the sizes of the objects reachable from the root, found through the slots the test stored its children in */
+	std::map<omrobjectptr_t, ObjectEntry *> objects;
+	J9HashTableState state;
+	ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+	while (NULL != objectEntry) {
+		objects[objectEntry->objPtr] = objectEntry;
+		objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+	uint64_t expectedRetainedSize = 0;
+	std::set<omrobjectptr_t> reached;
+	std::vector<omrobjectptr_t> stack(1, rootEntry->objPtr);
+	reached.insert(rootEntry->objPtr);
+	while (!stack.empty()) {
+		omrobjectptr_t object = stack.back();
+		stack.pop_back();
+		expectedRetainedSize += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+		std::map<omrobjectptr_t, ObjectEntry *>::const_iterator entry = objects.find(object);
+		int32_t numOfRef = (objects.end() == entry) ? 0 : entry->second->numOfRef;
+		fomrobject_t *firstSlot = (fomrobject_t *)object + 1;
+		for (int32_t i = 0; i < numOfRef; i++) {
+			omrobjectptr_t child = standardReadBarrier(exampleVM->_omrVMThread, object, firstSlot + i);
+			if ((NULL != child) && reached.insert(child).second) {
+				stack.push_back(child);
+			}
+		}
+	}
+
+	HeapSnapshotDominators dominators;
+	computeHeapSnapshotDominators(graph, dominators);
+	gcTestEnv->log("Heap snapshot: %zu inferred roots, %s retains %llu bytes of %zu objects\n", dominators.roots.size(), rootName, dominators.retainedSizes[root], reached.size());
+	if (dominators.roots.end() == std::find(dominators.roots.begin(), dominators.roots.end(), root)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %s(%p) is not a root of the heap snapshot.\n", __FILE__, __LINE__, rootName, rootEntry->objPtr);
+		return 1;
+	}
+	if (expectedRetainedSize != dominators.retainedSizes[root]) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected %s to retain %llu bytes, the heap snapshot says %llu.\n", __FILE__, __LINE__, rootName, expectedRetainedSize, dominators.retainedSizes[root]);
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * Write a heap snapshot, then check that its frames are well formed, that it ends with the totals of at least
+ * minObjects objects and that it decodes to these totals (see verifyHeapSnapshot()).
+ */
+int32_t
+GCConfigTest::writeHeapSnapshot(const char *fileName, uintptr_t minObjects, const char *rootName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (!extensions->isStandardGC()) {
+		gcTestEnv->log("Skipping heap snapshot: requires a standard GC policy\n");
+		return rt;
+	}
+
+	omr_error_t rc = OMR_GC_WriteHeapSnapshot(exampleVM->_omrVMThread, fileName);
+	if (OMR_ERROR_NONE != rc) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_WriteHeapSnapshot with error code %d.\n", __FILE__, __LINE__, rc);
+		return 1;
+	}
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	int64_t length = (-1 == fd) ? -1 : omrfile_flength(fd);
+	uint8_t *contents = (length < (int64_t)sizeof(HeapSnapshotHeader)) ? NULL : (uint8_t *)omrmem_allocate_memory((uintptr_t)length, OMRMEM_CATEGORY_MM);
+	if ((NULL == contents) || (length != omrfile_read(fd, contents, (intptr_t)length))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to read heap snapshot %s.\n", __FILE__, __LINE__, fileName);
+		rt = 1;
+	} else {
+		HeapSnapshotHeader *header = (HeapSnapshotHeader *)contents;
+		const uint8_t *cursor = contents + sizeof(HeapSnapshotHeader);
+		const uint8_t *end = contents + length;
+		uintptr_t frameCount = 0;
+		uint64_t objectCount = 0;
+		uint64_t referenceCount = 0;
+		bool complete = false;
+		if ((HEAP_SNAPSHOT_MAGIC != header->magic) || (HEAP_SNAPSHOT_VERSION != header->version)) {
+			rt = 1;
+		}
+		while ((0 == rt) && !complete && (cursor < end)) {
+			uint8_t type = *cursor;
+			cursor += 1;
+			uint64_t payloadLength = readVarint(&cursor, end);
+			if (payloadLength > (uint64_t)(end - cursor)) {
+				rt = 1;
+			} else if (HEAP_SNAPSHOT_FRAME_END == type) {
+				const uint8_t *payload = cursor;
+				objectCount = readVarint(&payload, cursor + payloadLength);
+				referenceCount = readVarint(&payload, cursor + payloadLength);
+				complete = true;
+			} else if ((HEAP_SNAPSHOT_FRAME_OBJECTS != type) && (HEAP_SNAPSHOT_FRAME_REFERENCES != type)) {
+				rt = 1;
+			}
+			cursor += payloadLength;
+			frameCount += 1;
+		}
+		gcTestEnv->log("Heap snapshot: %lld bytes, %zu frames, %llu objects, %llu references\n", length, frameCount, objectCount, referenceCount);
+		if ((0 != rt) || !complete || (cursor != end)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap snapshot %s is malformed.\n", __FILE__, __LINE__, fileName);
+			rt = 1;
+		} else if (objectCount < minObjects) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Expected at least %zu objects in the heap snapshot, found %llu.\n", __FILE__, __LINE__, minObjects, objectCount);
+			rt = 1;
+		} else {
+			rt = verifyHeapSnapshot(fileName, objectCount, referenceCount, rootName);
+		}
+	}
+
+	if (NULL != contents) {
+		omrmem_free_memory(contents);
+	}
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	if (!gcTestEnv->keepLog) {
+		omrfile_unlink(fileName);
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -967,6 +1836,41 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			bool prepareHeapForWalk = (0 == strcmp(node.attribute("prepareHeapForWalk").value(), "true"));
+			gcTestEnv->log("Invoking parallel heap walk...\n");
+			rt = walkHeap(prepareHeapForWalk);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocationSites")) {
+			int32_t minSites = (int32_t)atoi(node.attribute("minSites").value());
+			gcTestEnv->log("Querying allocation sites...\n");
+			rt = verifyAllocationSites(minSites);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "memoryMaintenance")) {
+			uintptr_t objectCount = (uintptr_t)atoi(node.attribute("allocations").value());
+			uintptr_t objectSize = (uintptr_t)atoi(node.attribute("objectSize").value());
+			gcTestEnv->log("Allocating after memory maintenance...\n");
+			rt = allocateAfterMemoryMaintenance(objectCount, objectSize);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocate")) {
+			uintptr_t objectCount = (uintptr_t)atoi(node.attribute("objects").value());
+			uintptr_t objectSize = (uintptr_t)atoi(node.attribute("objectSize").value());
+			gcTestEnv->log("Allocating %zu unreferenced objects...\n", objectCount);
+			rt = allocateUnreferenced(objectCount, objectSize);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "verifyReferences")) {
+			gcTestEnv->log("Verifying object references...\n");
+			rt = verifyReferences();
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "hugePages")) {
+			gcTestEnv->log("Verifying huge page backing...\n");
+			rt = verifyHugePages();
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "heapSnapshot")) {
+			uintptr_t minObjects = (uintptr_t)atoi(node.attribute("minObjects").value());
+			gcTestEnv->log("Writing heap snapshot...\n");
+			rt = writeHeapSnapshot(node.attribute("file").value(), minObjects, node.attribute("root").value());
+			OMRGCTEST_CHECK_RT(rt);
 		}
 	}
 done:
@@ -1040,6 +1944,10 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			if (NULL != verboseRingFile) {
+				rt = verifyVerboseRing();
+				ASSERT_EQ(0, rt) << "Failed in verbose GC ring verification.";
+			}
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
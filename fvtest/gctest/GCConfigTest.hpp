@@ -85,6 +85,8 @@ protected:
 	/* verbose log options */
 	MM_VerboseManager *verboseManager;
 	char *verboseFile;
+	char *verboseRingFile;
+	char *phaseTraceFile;
 	uintptr_t numOfFiles;
 
 	/*
@@ -108,8 +110,18 @@ protected:
 	void printFile(const char *name);
 #endif
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t verifyVerboseRing();
+	int32_t verifyPhaseTrace();
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t walkHeap(bool prepareHeapForWalk);
+	int32_t verifyAllocationSites(int32_t minSites);
+	int32_t writeHeapSnapshot(const char *fileName, uintptr_t minObjects, const char *rootName);
+	int32_t verifyHeapSnapshot(const char *fileName, uint64_t objectCount, uint64_t referenceCount, const char *rootName);
+	int32_t allocateAfterMemoryMaintenance(uintptr_t objectCount, uintptr_t objectSize);
+	int32_t allocateUnreferenced(uintptr_t objectCount, uintptr_t objectSize);
+	int32_t verifyReferences();
+	int32_t verifyHugePages();
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -158,6 +170,8 @@ public:
 		, cli(NULL)
 		, verboseManager(NULL)
 		, verboseFile(NULL)
+		, verboseRingFile(NULL)
+		, phaseTraceFile(NULL)
 		, numOfFiles(0)
 	{
 		gp.namePrefix = NULL;
@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+
+#include "gcTestHelpers.hpp"
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "sizeclasses.h"
+
+#include "AllocationContextSegregated.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MagazineDepotSegregated.hpp"
+#include "SegregatedAllocationInterface.hpp"
+#include "SizeClasses.hpp"
+#include "StartupManagerTestExample.hpp"
+
+#define MAGAZINEDEPOT_TEST_MAGAZINE_BYTES ((uintptr_t)256)
+#define MAGAZINEDEPOT_TEST_MAGAZINES ((uintptr_t)10)
+#define MAGAZINEDEPOT_TEST_ALLOCATION_MAGAZINES ((uintptr_t)4)
+#define MAGAZINEDEPOT_TEST_OBJECT_BYTES ((uintptr_t)96)
+
+/**
+ * Depot of an initialized heap, the cells of the magazines are native memory.
+ */
+class gcFunctionalTestMagazineDepotSegregated : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_MagazineDepotSegregated *depot;
+	uintptr_t *cells;
+
+	virtual void
+	SetUp()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/global_GC_config.xml");
+
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
+
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		depot = MM_MagazineDepotSegregated::newInstance(env);
+		ASSERT_TRUE(NULL != depot);
+		cells = (uintptr_t *)omrmem_allocate_memory(2 * MAGAZINEDEPOT_TEST_MAGAZINES * MAGAZINEDEPOT_TEST_MAGAZINE_BYTES, OMRMEM_CATEGORY_MM);
+		ASSERT_TRUE(NULL != cells);
+	}
+
+	virtual void
+	TearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		omrmem_free_memory(cells);
+		depot->kill(env);
+
+		omr_error_t rc = OMR_GC_ShutdownCollector(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownCollector failed, rc=" << rc;
+		rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		rc = OMR_GC_ShutdownHeap(exampleVM->_omrVM);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_GC_ShutdownHeap failed, rc=" << rc;
+		exampleVM->_omrVMThread = NULL;
+	}
+
+	gcFunctionalTestMagazineDepotSegregated()
+		: exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, depot(NULL)
+		, cells(NULL)
+	{
+	}
+};
+
+TEST_F(gcFunctionalTestMagazineDepotSegregated, pushPopFlush)
+{
+	const uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL;
+	const uintptr_t otherSizeClass = OMR_SIZECLASSES_MAX_SMALL;
+	uintptr_t magazineBytes = 0;
+
+	ASSERT_EQ((uintptr_t)0, depot->getMagazineCount(sizeClass));
+	ASSERT_TRUE(NULL == depot->popMagazine(env, sizeClass, &magazineBytes));
+
+	/* The last magazine is smaller, magazines are popped in address order */
+	uintptr_t cellsBytes = ((MAGAZINEDEPOT_TEST_MAGAZINES - 1) * MAGAZINEDEPOT_TEST_MAGAZINE_BYTES) + (MAGAZINEDEPOT_TEST_MAGAZINE_BYTES / 2);
+	depot->pushMagazines(env, sizeClass, cells, cellsBytes, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES);
+	ASSERT_EQ(MAGAZINEDEPOT_TEST_MAGAZINES, depot->getMagazineCount(sizeClass));
+	ASSERT_EQ((uintptr_t)0, depot->getMagazineCount(otherSizeClass));
+	ASSERT_TRUE(NULL == depot->popMagazine(env, otherSizeClass, &magazineBytes));
+	for (uintptr_t i = 0; i < MAGAZINEDEPOT_TEST_MAGAZINES; i++) {
+		uintptr_t *magazine = depot->popMagazine(env, sizeClass, &magazineBytes);
+		ASSERT_EQ((uintptr_t)cells + (i * MAGAZINEDEPOT_TEST_MAGAZINE_BYTES), (uintptr_t)magazine);
+		ASSERT_EQ(((MAGAZINEDEPOT_TEST_MAGAZINES - 1) == i) ? (MAGAZINEDEPOT_TEST_MAGAZINE_BYTES / 2) : MAGAZINEDEPOT_TEST_MAGAZINE_BYTES, magazineBytes);
+		ASSERT_EQ(MAGAZINEDEPOT_TEST_MAGAZINES - 1 - i, depot->getMagazineCount(sizeClass));
+	}
+	ASSERT_TRUE(NULL == depot->popMagazine(env, sizeClass, &magazineBytes));
+
+	/* The magazines of the last push are popped first */
+	uintptr_t *secondCells = (uintptr_t *)((uintptr_t)cells + (MAGAZINEDEPOT_TEST_MAGAZINES * MAGAZINEDEPOT_TEST_MAGAZINE_BYTES));
+	depot->pushMagazines(env, sizeClass, cells, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES);
+	depot->pushMagazines(env, sizeClass, secondCells, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES);
+	ASSERT_EQ((uintptr_t)2, depot->getMagazineCount(sizeClass));
+	ASSERT_EQ((uintptr_t)secondCells, (uintptr_t)depot->popMagazine(env, sizeClass, &magazineBytes));
+	ASSERT_EQ((uintptr_t)cells, (uintptr_t)depot->popMagazine(env, sizeClass, &magazineBytes));
+
+	/* Flush empties every size class */
+	depot->pushMagazines(env, sizeClass, cells, cellsBytes, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES);
+	depot->pushMagazines(env, otherSizeClass, secondCells, cellsBytes, MAGAZINEDEPOT_TEST_MAGAZINE_BYTES);
+	ASSERT_EQ(MAGAZINEDEPOT_TEST_MAGAZINES, depot->getMagazineCount(otherSizeClass));
+	depot->flush(env);
+	ASSERT_EQ((uintptr_t)0, depot->getMagazineCount(sizeClass));
+	ASSERT_EQ((uintptr_t)0, depot->getMagazineCount(otherSizeClass));
+	ASSERT_TRUE(NULL == depot->popMagazine(env, sizeClass, &magazineBytes));
+	ASSERT_TRUE(NULL == depot->popMagazine(env, otherSizeClass, &magazineBytes));
+}
+
+/**
+ * Allocation context without regions or marking scheme, it counts the loaded magazines it is asked to pre-mark.
+ */
+class MM_AllocationContextSegregatedTestExample : public MM_AllocationContextSegregated
+{
+public:
+	uintptr_t _preMarkCount; /**< number of times the cells of a loaded magazine would have been pre-marked */
+
+	static MM_AllocationContextSegregatedTestExample *
+	newInstance(MM_EnvironmentBase *env)
+	{
+		MM_AllocationContextSegregatedTestExample *allocCtxt = (MM_AllocationContextSegregatedTestExample *)env->getForge()->allocate(sizeof(MM_AllocationContextSegregatedTestExample), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL != allocCtxt) {
+			new(allocCtxt) MM_AllocationContextSegregatedTestExample(env);
+			if (!allocCtxt->initialize(env)) {
+				allocCtxt->kill(env);
+				allocCtxt = NULL;
+			}
+		}
+		return allocCtxt;
+	}
+
+	uintptr_t
+	distribute(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsBytes, uintptr_t magazineBytes)
+	{
+		return distributeMagazines(env, sizeClass, cells, cellsBytes, magazineBytes);
+	}
+
+protected:
+	virtual bool
+	shouldPreMarkSmallCells(MM_EnvironmentBase *env)
+	{
+		_preMarkCount += 1;
+		return false;
+	}
+
+	MM_AllocationContextSegregatedTestExample(MM_EnvironmentBase *env)
+		: MM_AllocationContextSegregated(env, NULL, NULL)
+		, _preMarkCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Allocation context with magazines enabled, the thread allocates through a segregated allocation interface.
+ */
+class gcFunctionalTestAllocationContextSegregated : public gcFunctionalTestMagazineDepotSegregated
+{
+protected:
+	OMR_SizeClasses omrSizeClasses;
+	OMR_SizeClasses *savedOmrSizeClasses;
+	MM_ObjectAllocationInterface *savedAllocationInterface;
+	uintptr_t savedAllocationMagazineCount;
+	MM_SizeClasses *sizeClasses;
+	MM_SegregatedAllocationInterface *allocationInterface;
+	MM_AllocationContextSegregatedTestExample *context;
+
+	virtual void
+	SetUp()
+	{
+		gcFunctionalTestMagazineDepotSegregated::SetUp();
+		if (HasFatalFailure()) {
+			return;
+		}
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		savedOmrSizeClasses = exampleVM->_omrVM->_sizeClasses;
+		exampleVM->_omrVM->_sizeClasses = &omrSizeClasses;
+		sizeClasses = MM_SizeClasses::newInstance(env);
+		ASSERT_TRUE(NULL != sizeClasses);
+		extensions->defaultSizeClasses = sizeClasses;
+
+		savedAllocationMagazineCount = extensions->allocationMagazineCount;
+		extensions->allocationMagazineCount = MAGAZINEDEPOT_TEST_ALLOCATION_MAGAZINES;
+		context = MM_AllocationContextSegregatedTestExample::newInstance(env);
+		ASSERT_TRUE(NULL != context);
+
+		allocationInterface = MM_SegregatedAllocationInterface::newInstance(env);
+		ASSERT_TRUE(NULL != allocationInterface);
+		savedAllocationInterface = env->_objectAllocationInterface;
+		env->_objectAllocationInterface = allocationInterface;
+	}
+
+	virtual void
+	TearDown()
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		if (NULL != allocationInterface) {
+			env->_objectAllocationInterface = savedAllocationInterface;
+			allocationInterface->kill(env);
+		}
+		if (NULL != context) {
+			context->kill(env);
+		}
+		extensions->allocationMagazineCount = savedAllocationMagazineCount;
+		if (NULL != sizeClasses) {
+			sizeClasses->kill(env);
+		}
+		extensions->defaultSizeClasses = NULL;
+		exampleVM->_omrVM->_sizeClasses = savedOmrSizeClasses;
+
+		gcFunctionalTestMagazineDepotSegregated::TearDown();
+	}
+
+	gcFunctionalTestAllocationContextSegregated()
+		: gcFunctionalTestMagazineDepotSegregated()
+		, savedOmrSizeClasses(NULL)
+		, savedAllocationInterface(NULL)
+		, savedAllocationMagazineCount(0)
+		, sizeClasses(NULL)
+		, allocationInterface(NULL)
+		, context(NULL)
+	{
+	}
+};
+
+TEST_F(gcFunctionalTestAllocationContextSegregated, spareAndDepotMagazines)
+{
+	const uintptr_t sizeInBytes = MAGAZINEDEPOT_TEST_OBJECT_BYTES;
+	uintptr_t sizeClass = sizeClasses->getSizeClassSmall(sizeInBytes);
+	uintptr_t cellSize = sizeClasses->getCellSize(sizeClass);
+	uintptr_t replenishSize = allocationInterface->getReplenishSize(env, sizeInBytes);
+	/* Magazines hold whole cells */
+	uintptr_t magazineBytes = replenishSize - (replenishSize % cellSize);
+	ASSERT_TRUE(magazineBytes > cellSize);
+
+	/* The first magazine is loaded, the next one is the spare of the thread and the others are parked in the depot */
+	ASSERT_EQ(magazineBytes, context->distribute(env, sizeClass, cells, MAGAZINEDEPOT_TEST_ALLOCATION_MAGAZINES * magazineBytes, replenishSize));
+	allocationInterface->replenishCache(env, sizeInBytes, cells, magazineBytes);
+	ASSERT_EQ((uintptr_t)cells, (uintptr_t)allocationInterface->allocateFromCache(env, sizeInBytes));
+
+	for (uintptr_t magazine = 0; magazine < MAGAZINEDEPOT_TEST_ALLOCATION_MAGAZINES; magazine++) {
+		uintptr_t magazineCells = (uintptr_t)cells + (magazine * magazineBytes);
+		if (0 != magazine) {
+			/* The spare magazine is loaded first, then the magazines of the depot in address order, each is pre-marked */
+			ASSERT_EQ(magazineCells, (uintptr_t)context->preAllocateSmall(env, sizeInBytes));
+			ASSERT_EQ(magazine, context->_preMarkCount);
+		}
+		for (uintptr_t offset = cellSize; offset < magazineBytes; offset += cellSize) {
+			ASSERT_EQ(magazineCells + offset, (uintptr_t)allocationInterface->allocateFromCache(env, sizeInBytes));
+		}
+		ASSERT_TRUE(NULL == allocationInterface->allocateFromCache(env, sizeInBytes));
+	}
+
+	/* A magazine returned by a thread is loaded by the next replenish */
+	context->returnMagazine(env, sizeClass, cells, magazineBytes);
+	ASSERT_EQ((uintptr_t)cells, (uintptr_t)context->preAllocateSmall(env, sizeInBytes));
+	ASSERT_EQ(MAGAZINEDEPOT_TEST_ALLOCATION_MAGAZINES, context->_preMarkCount);
+}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+
+#include "gcTestHelpers.hpp"
+#include "CardTableScan.hpp"
+#include "HeapMapScan.hpp"
+#include "NonZeroWordScan.hpp"
+
+#define NONZEROWORDSCAN_TEST_WORDS ((uintptr_t)1 << 15)
+#define NONZEROWORDSCAN_BENCHMARK_WORDS ((uintptr_t)1 << 20)
+#define NONZEROWORDSCAN_BENCHMARK_ITERATIONS 16
+
+static const char *implementationNames[] = {"scalar", "sse4.1", "avx2"};
+
+/**
+ * Fill a range of words with roughly one non-zero byte in every bytesPerMark bytes (0 for all zero), as set mark
+ * bits or dirty cards would be.
+ */
+static void
+fillWords(uintptr_t *words, uintptr_t wordCount, uintptr_t bytesPerMark, uint32_t seed)
+{
+	uint8_t *bytes = (uint8_t *)words;
+	for (uintptr_t i = 0; i < (wordCount * sizeof(uintptr_t)); i++) {
+		bytes[i] = 0;
+		seed = (seed * 1103515245) + 12345;
+		if ((0 != bytesPerMark) && (0 == ((seed >> 8) % bytesPerMark))) {
+			bytes[i] = (uint8_t)(1 << ((seed >> 4) % 8));
+		}
+	}
+}
+
+/**
+ * Walk a range of words the way heap map and card table walkers do, counting the non-zero words. The scanner is
+ * only called once a zero word is found.
+ */
+static uintptr_t
+walkWords(MM_NonZeroWordScan::FindNonZeroWordFunction findNonZeroWord, uintptr_t *words, uintptr_t *top)
+{
+	uintptr_t count = 0;
+	uintptr_t *word = words;
+	while (word < top) {
+		if (0 == *word) {
+			word = findNonZeroWord(word + 1, top);
+			if (word == top) {
+				break;
+			}
+		}
+		count += 1;
+		word += 1;
+	}
+	return count;
+}
+
+class NonZeroWordScanTest : public ::testing::TestWithParam<MM_NonZeroWordScan::Implementation>
+{
+};
+
+/**
+ * Every implementation must find the word the scalar loop does. The implementation selected for this processor
+ * is also checked through the heap map and card table scanners, which add their own head and tail handling.
+ */
+TEST_P(NonZeroWordScanTest, matchesScalar)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_NonZeroWordScan::Implementation implementation = GetParam();
+	MM_NonZeroWordScan::FindNonZeroWordFunction findNonZeroWord = MM_NonZeroWordScan::getImplementation(implementation);
+	if (NULL == findNonZeroWord) {
+		gcTestEnv->log(LEVEL_INFO, "Skipping %s: not supported\n", implementationNames[implementation]);
+		return;
+	}
+	bool selected = (MM_NonZeroWordScan::getSelectedImplementation() == implementation);
+
+	uintptr_t *words = (uintptr_t *)omrmem_allocate_memory(NONZEROWORDSCAN_TEST_WORDS * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != words);
+	Card *cards = (Card *)words;
+	const uintptr_t cardCount = NONZEROWORDSCAN_TEST_WORDS * sizeof(uintptr_t);
+
+	const uintptr_t densities[] = {0, 4096, 64, 3, 1};
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillWords(words, NONZEROWORDSCAN_TEST_WORDS, densities[d], (uint32_t)d);
+		/* Every start offset within a vector pair and a spread of range lengths, to cover the head and tail handling */
+		for (uintptr_t start = 0; start < 64; start++) {
+			for (uintptr_t length = 0; length < NONZEROWORDSCAN_TEST_WORDS - start; length = (length * 2) + 1) {
+				uintptr_t *top = words + start + length;
+				uintptr_t *expected = MM_NonZeroWordScan::findNonZeroWordScalar(words + start, top);
+				ASSERT_EQ(expected, findNonZeroWord(words + start, top))
+					<< implementationNames[implementation] << " density " << densities[d] << " start " << start << " length " << length;
+				if (selected) {
+					ASSERT_EQ(expected, MM_HeapMapScan::findNonEmptySlot(words + start, top));
+				}
+			}
+		}
+		ASSERT_EQ(walkWords(MM_NonZeroWordScan::findNonZeroWordScalar, words, words + NONZEROWORDSCAN_TEST_WORDS),
+				walkWords(findNonZeroWord, words, words + NONZEROWORDSCAN_TEST_WORDS));
+
+		if (selected) {
+			/* Cards are bytes, so ranges of cards need not start or end on a word boundary */
+			for (uintptr_t start = 0; start < 128; start++) {
+				for (uintptr_t length = 0; length < cardCount - start; length = (length * 2) + 1) {
+					Card *top = cards + start + length;
+					Card *expected = cards + start;
+					while ((expected < top) && ((Card)CARD_CLEAN == *expected)) {
+						expected += 1;
+					}
+					ASSERT_EQ(expected, MM_CardTableScan::findNonCleanCard(cards + start, top))
+						<< "density " << densities[d] << " start card " << start << " length " << length;
+				}
+			}
+		}
+	}
+
+	omrmem_free_memory(words);
+}
+
+INSTANTIATE_TEST_CASE_P(gcFunctionalTestNonZeroWordScan, NonZeroWordScanTest,
+		::testing::Values(MM_NonZeroWordScan::SCAN_SCALAR, MM_NonZeroWordScan::SCAN_SSE41, MM_NonZeroWordScan::SCAN_AVX2));
+
+/* Compare the scanner implementations on sparse and dense ranges; run with --gtest_filter="perfTest*" */
+TEST(perfTestNonZeroWordScan, benchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t *words = (uintptr_t *)omrmem_allocate_memory(NONZEROWORDSCAN_BENCHMARK_WORDS * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != words);
+
+	gcTestEnv->log(LEVEL_INFO, "Non-zero word scan: %zu words, selected implementation %s\n",
+			NONZEROWORDSCAN_BENCHMARK_WORDS, implementationNames[MM_NonZeroWordScan::getSelectedImplementation()]);
+
+	const uintptr_t densities[] = {0, 65536, 1024, 16, 1};
+	const char *densityNames[] = {"empty", "sparse (1/65536)", "sparse (1/1024)", "dense (1/16)", "dense (1/1)"};
+	for (uintptr_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+		fillWords(words, NONZEROWORDSCAN_BENCHMARK_WORDS, densities[d], (uint32_t)d);
+		uint64_t scalarTime = 0;
+		for (uintptr_t implementation = MM_NonZeroWordScan::SCAN_SCALAR; implementation < MM_NonZeroWordScan::SCAN_IMPLEMENTATION_COUNT; implementation++) {
+			MM_NonZeroWordScan::FindNonZeroWordFunction findNonZeroWord = MM_NonZeroWordScan::getImplementation((MM_NonZeroWordScan::Implementation)implementation);
+			if (NULL == findNonZeroWord) {
+				gcTestEnv->log(LEVEL_INFO, "  %-18s %-8s not supported\n", densityNames[d], implementationNames[implementation]);
+				continue;
+			}
+			uintptr_t count = 0;
+			uint64_t startTime = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < NONZEROWORDSCAN_BENCHMARK_ITERATIONS; i++) {
+				count += walkWords(findNonZeroWord, words, words + NONZEROWORDSCAN_BENCHMARK_WORDS);
+			}
+			uint64_t elapsed = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+			if (MM_NonZeroWordScan::SCAN_SCALAR == implementation) {
+				scalarTime = elapsed;
+			}
+			gcTestEnv->log(LEVEL_INFO, "  %-18s %-8s %8.3f ms  %6.3f ns/word  speedup %5.2fx  (%zu non-zero words)\n",
+					densityNames[d], implementationNames[implementation], (double)elapsed / 1000000.0,
+					(double)elapsed / (double)(NONZEROWORDSCAN_BENCHMARK_WORDS * NONZEROWORDSCAN_BENCHMARK_ITERATIONS),
+					(0 == elapsed) ? 0.0 : (double)scalarTime / (double)elapsed, count / NONZEROWORDSCAN_BENCHMARK_ITERATIONS);
+		}
+	}
+
+	omrmem_free_memory(words);
+}
@@ -55,6 +55,9 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 		}
 
 		if (result) {
+			/* the example language has no profiling, so a test may supply the hot fields of its objects */
+			OMR_VM_Example *exampleVM = (OMR_VM_Example *)omrVM->_language_vm;
+			exampleVM->hotFieldsDescriptor = 0;
 			for (pugi::xml_attribute attr = option.node().first_attribute(); attr; attr = attr.next_attribute()) {
 				if (0 == strcmp(attr.name(), "memoryMax")) {
 					extensions->memoryMax = atoi(attr.value()) * unitSize;
@@ -83,7 +86,10 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodes")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -101,12 +107,130 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentEvacuation")) {
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+					extensions->concurrentEvacuation = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentEvacuation=true ignored, requires OMR_GC_LARGE_OBJECT_AREA\n");
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+				} else if (0 == strcmp(attr.name(), "concurrentEvacuationAreaSize")) {
+					extensions->concurrentEvacuationAreaSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "concurrentEvacuationLiveThreshold")) {
+					extensions->concurrentEvacuationLiveThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "concurrentEvacuationMaxAreas")) {
+					extensions->concurrentEvacuationMaxAreas = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldCopy")) {
+					extensions->scavengerHotFieldCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hotFieldsDescriptor")) {
+					exampleVM->hotFieldsDescriptor = (uintptr_t)strtoul(attr.value(), NULL, 0);
+				} else if (0 == strcmp(attr.name(), "rememberedSetCards")) {
+					extensions->scavengerRememberedSetCards = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPauseTargetMicros")) {
+					extensions->scavengerPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerOverheadTarget")) {
+					extensions->scavengerOverheadTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scvTenureStrategyDecay")) {
+					extensions->scvTenureStrategyDecay = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scvTenureDecayWindow")) {
+					extensions->scvTenureDecayWindow = atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "workStealingDeque")) {
+					extensions->workStealingDeque = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealingDequeSize")) {
+					extensions->workStealingDequeSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+					extensions->tlhAdaptiveRefreshInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					uintptr_t prefetchDepth = (uintptr_t)atoi(attr.value());
+					if (prefetchDepth > MAXIMUM_MARKING_PREFETCH_DEPTH) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: markingPrefetchDepth must not exceed %d\n", MAXIMUM_MARKING_PREFETCH_DEPTH);
+						result = false;
+					} else {
+						extensions->markingPrefetchDepth = prefetchDepth;
+					}
+				} else if (0 == strcmp(attr.name(), "markMapCache")) {
+					extensions->markMapCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeEntryQuickLists")) {
+					extensions->freeEntryQuickLists = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeEntryQuickListSizes")) {
+					uintptr_t quickListSizes = (uintptr_t)atoi(attr.value());
+					if (quickListSizes > MAXIMUM_FREE_ENTRY_QUICK_LIST_SIZES) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: freeEntryQuickListSizes must not exceed %d\n", MAXIMUM_FREE_ENTRY_QUICK_LIST_SIZES);
+						result = false;
+					} else {
+						extensions->freeEntryQuickListSizes = quickListSizes;
+					}
+				} else if (0 == strcmp(attr.name(), "freeEntryQuickListPercent")) {
+					extensions->freeEntryQuickListPercent = atoi(attr.value());
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+				} else if (0 == strcmp(attr.name(), "largeObjectArea")) {
+					extensions->largeObjectArea = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "largeObjectAreaInitialRatio")) {
+					extensions->largeObjectAreaInitialRatio = atof(attr.value());
+				} else if (0 == strcmp(attr.name(), "loaSizeBands")) {
+					extensions->loaSizeBands = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "loaSizeBandPercent")) {
+					extensions->loaSizeBandPercent = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "loaReservationCount")) {
+					extensions->loaReservationCount = atoi(attr.value());
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					/* compaction is disabled by default, so this overrides the default as well */
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+					extensions->noCompactOnGlobalGC = 1 - extensions->compactOnGlobalGC;
+				} else if (0 == strcmp(attr.name(), "compactSummaryTable")) {
+					extensions->compactSummaryTable = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "compactSummaryChunkSize")) {
+					extensions->compactSummaryChunkSize = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "memoryMaintenance")) {
+					extensions->memoryMaintenance = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "memoryMaintenanceRate")) {
+					extensions->memoryMaintenanceRate = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "allocationSamplingTopSites")) {
+					extensions->allocationSamplingTopSites = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "heapHugePages")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "transparent")) {
+						extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_TRANSPARENT;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "explicit")) {
+						extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_EXPLICIT;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "none")) {
+						extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized heapHugePages (expected transparent, explicit or none): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "verboseRingBufferSize")) {
+					extensions->verboseRingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "gcPhaseTimeline")) {
+					extensions->gcPhaseTimeline = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcPhaseTimelineSize")) {
+					extensions->gcPhaseTimelineSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "gcPhaseTraceFile")) {
+					extensions->gcPhaseTraceFileName = (char *)extensions->getForge()->allocate(strlen(attr.value()) + 1, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+					if (NULL == extensions->gcPhaseTraceFileName) {
+						result = false;
+					} else {
+						strcpy(extensions->gcPhaseTraceFileName, attr.value());
+						extensions->gcPhaseTimeline = true;
+					}
+				} else if (0 == strcmp(attr.name(), "gcThreadMinimumWork")) {
+					extensions->gcThreadMinimumWork = atoi(attr.value()) * unitSize;
+					extensions->gcThreadMinimumWorkForced = true;
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -3724,6 +3724,52 @@ TEST(PortVmemTest, vmem_testGetProcessMemorySize)
 	EXPECT_TRUE(0 == size) << "value updated when query invalid";
 }
 
+/**
+ * Reserves memory advised for transparent huge pages and queries how much of it is backed by huge pages.
+ *
+ * @ref omrvmem.c
+ */
+TEST(PortVmemTest, vmem_testHugePageBackedSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testHugePageBackedSize";
+	const uintptr_t twoMB = 2 * 1024 * 1024;
+	struct J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	uintptr_t backedSize = 0;
+	int32_t result = -1;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = 4 * twoMB;
+	params.alignmentInBytes = twoMB;
+	params.options |= OMRPORT_VMEM_ADVISE_HUGEPAGE;
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+	params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+
+	char *memPtr = (char *)omrvmem_reserve_memory_ex(&vmemID, &params);
+	ASSERT_TRUE(NULL != memPtr) << "unable to reserve memory advised for huge pages";
+	memset(memPtr, 0xA5, params.byteAmount);
+
+	result = omrvmem_get_huge_page_backed_size(memPtr, params.byteAmount, &vmemID, &backedSize);
+#if defined(LINUX)
+	EXPECT_TRUE(0 == result) << "omrvmem_get_huge_page_backed_size failed";
+	EXPECT_TRUE(backedSize <= params.byteAmount) << "more memory backed by huge pages than was reserved";
+	portTestEnv->log("0x%zx of 0x%zx bytes backed by huge pages\n", backedSize, params.byteAmount);
+
+	backedSize = 0;
+	result = omrvmem_get_huge_page_backed_size(memPtr, 2 * params.byteAmount, &vmemID, &backedSize);
+	EXPECT_TRUE(result < 0) << "range outside the reservation not detected";
+	EXPECT_TRUE(0 == backedSize) << "value updated when range invalid";
+#else /* defined(LINUX) */
+	EXPECT_TRUE(OMRPORT_ERROR_VMEM_NOT_SUPPORTED == result) << "unexpected result from omrvmem_get_huge_page_backed_size";
+#endif /* defined(LINUX) */
+
+	EXPECT_TRUE(0 == omrvmem_free_memory(memPtr, params.byteAmount, &vmemID)) << "omrvmem_free_memory failed";
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* This function is used by omrvmem_test_reserveExecutableMemory */
 int
 myFunction1()
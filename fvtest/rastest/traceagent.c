@@ -166,6 +166,7 @@ testTraceAgentFromUnattachedThread(OMR_TI const *ti, OMRPortLibrary *portLibrary
 	void *methodArray[1] = { (void *)0 };
 	size_t nameBytesRemaining = 0;
 	char nameBuffer[5];
+	OMR_TI_AllocationSite allocationSite;
 
 	if (OMR_ERROR_NONE == testRc) {
 		rc = OMRTEST_PRINT_UNEXPECTED_RC(ti->SetTraceOptions(vmThread, setOpts), OMR_THREAD_NOT_ATTACHED);
@@ -242,6 +243,13 @@ testTraceAgentFromUnattachedThread(OMR_TI const *ti, OMRPortLibrary *portLibrary
 		}
 	}
 
+	if (OMR_ERROR_NONE == testRc) {
+		rc = OMRTEST_PRINT_UNEXPECTED_RC(ti->GetAllocationSites(vmThread, 1, &allocationSite, NULL, NULL), OMR_THREAD_NOT_ATTACHED);
+		if (OMR_THREAD_NOT_ATTACHED != rc) {
+			testRc = OMR_ERROR_INTERNAL;
+		}
+	}
+
 	return testRc;
 }
 
@@ -348,6 +356,20 @@ testNegativeCases(OMR_VMThread *vmThread, OMR_TI const *ti)
 			testRc = OMR_ERROR_INTERNAL;
 		}
 	}
+	/* sites is NULL */
+	if (OMR_ERROR_NONE == testRc) {
+		rc = OMRTEST_PRINT_UNEXPECTED_RC(ti->GetAllocationSites(vmThread, 1, NULL, NULL, NULL), OMR_ERROR_ILLEGAL_ARGUMENT);
+		if (OMR_ERROR_ILLEGAL_ARGUMENT != rc) {
+			testRc = OMR_ERROR_INTERNAL;
+		}
+	}
+	/* allocation sites are not sampled */
+	if (OMR_ERROR_NONE == testRc) {
+		rc = OMRTEST_PRINT_UNEXPECTED_RC(ti->GetAllocationSites(vmThread, 0, NULL, NULL, NULL), OMR_ERROR_NOT_AVAILABLE);
+		if (OMR_ERROR_NOT_AVAILABLE != rc) {
+			testRc = OMR_ERROR_INTERNAL;
+		}
+	}
 
 	/* Test with invalidMemorySizePtr, OMR_ERROR_ILLEGAL_ARGUMENT is expected */
 #if defined(LINUX) || defined(AIXPPC) || defined(WIN32) || defined(OSX)
@@ -58,8 +58,11 @@ protected:
 	uintptr_t _allocationTaxSize;
 
 	bool _tlhAllocation;
+	bool _preZeroedTLH; /**< Was the TLH carved entirely from memory already zeroed by the memory maintenance thread */
 	bool _nurseryAllocation;
 	bool _loaAllocation;
+	bool _quickListAllocation; /**< Was the allocation satisfied from a memory pool quick-list (without taking the pool lock) */
+	bool _loaReservationAllocation; /**< Was the allocation satisfied from the thread's large object area reservation (without taking the pool lock) */
 	uintptr_t _spineBytes;
 	uintptr_t _numArraylets;
 	bool _chunkedArray;
@@ -180,12 +183,21 @@ public:
 
 	MMINLINE void setTLHAllocation(bool tlhAlloc) 						{ _tlhAllocation = tlhAlloc; }
 	MMINLINE bool isTLHAllocation()										{ return _tlhAllocation; }
+
+	MMINLINE void setPreZeroedTLH(bool preZeroed)						{ _preZeroedTLH = preZeroed; }
+	MMINLINE bool isPreZeroedTLH()										{ return _preZeroedTLH; }
 	
 	MMINLINE void setNurseryAllocation(bool nurseryAlloc)				{ _nurseryAllocation = nurseryAlloc; }
 	MMINLINE bool isNurseryAllocation()									{ return _nurseryAllocation; }
 	
 	MMINLINE void setLOAAllocation(bool loaAlloc)						{ _loaAllocation = loaAlloc; }
 	MMINLINE bool isLOAAllocation()										{ return _loaAllocation; }
+
+	MMINLINE void setQuickListAllocation(bool quickListAlloc)			{ _quickListAllocation = quickListAlloc; }
+	MMINLINE bool isQuickListAllocation()								{ return _quickListAllocation; }
+
+	MMINLINE void setLOAReservationAllocation(bool reservationAlloc)	{ _loaReservationAllocation = reservationAlloc; }
+	MMINLINE bool isLOAReservationAllocation()							{ return _loaReservationAllocation; }
 	
 	MMINLINE void setThreadIsAtSafePoint(bool safe)						{_threadAtSafePoint = safe; }
 	MMINLINE bool isThreadAtSafePoint()									{ return _threadAtSafePoint; }
@@ -231,8 +243,11 @@ public:
 		,_memorySubSpace(NULL)
 		,_allocationTaxSize(0)
 		,_tlhAllocation(false)
+		,_preZeroedTLH(false)
 		,_nurseryAllocation(false)
 		,_loaAllocation(false)
+		,_quickListAllocation(false)
+		,_loaReservationAllocation(false)
 		,_spineBytes(0)
 		,_numArraylets(0)
 		,_chunkedArray(false)
@@ -30,6 +30,7 @@
 #include "omrutil.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "EnvironmentBase.hpp"
@@ -218,6 +219,14 @@ public:
 				/* let the language object model perform its header and object initialization */
 				objectPtr = objectModel->initializeAllocation(env, heapBytes, this);
 
+				/* the allocation interface selected this allocation as an allocation site sample */
+				if (0 != env->_pendingAllocationSampleBytes) {
+					if (NULL != objectPtr) {
+						env->getExtensions()->allocationSiteSampler->sample(env, objectPtr, env->_pendingAllocationSampleBytes);
+					}
+					env->_pendingAllocationSampleBytes = 0;
+				}
+
 				/* if object model initialization fails heapBytes will become floating garbage to be recovered in next GC */
 				if (NULL != objectPtr) {
 					/* in case the object escapes to another thread... */
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include "omrport.h"
+#include "ModronAssertions.h"
+
+#include "AllocationSiteSampler.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_AllocationSiteSampler *
+MM_AllocationSiteSampler::newInstance(MM_EnvironmentBase *env, uintptr_t topSiteCount)
+{
+	MM_AllocationSiteSampler *sampler = (MM_AllocationSiteSampler *)env->getForge()->allocate(sizeof(MM_AllocationSiteSampler), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sampler) {
+		new(sampler) MM_AllocationSiteSampler(topSiteCount);
+		if (!sampler->initialize(env)) {
+			sampler->kill(env);
+			sampler = NULL;
+		}
+	}
+	return sampler;
+}
+
+void
+MM_AllocationSiteSampler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationSiteSampler::initialize(MM_EnvironmentBase *env)
+{
+	OMRPortLibrary *portLibrary = env->getPortLibrary();
+
+	_sites = (SiteRecord *)env->getForge()->allocate(_siteCount * sizeof(SiteRecord), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sites) {
+		return false;
+	}
+
+	_siteTable = hashTableNew(portLibrary, OMR_GET_CALLSITE(), (uint32_t)_siteCount, sizeof(SiteRecord *), 0, 0, OMRMEM_CATEGORY_MM, siteHash, siteEquals, NULL, NULL);
+	if (NULL == _siteTable) {
+		return false;
+	}
+
+	_ranking = spaceSavingNew(portLibrary, (uint32_t)_siteCount);
+	if (NULL == _ranking) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "MM_AllocationSiteSampler::_mutex")) {
+		_mutex = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_AllocationSiteSampler::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+
+	if (NULL != _ranking) {
+		spaceSavingFree(_ranking);
+		_ranking = NULL;
+	}
+
+	if (NULL != _siteTable) {
+		hashTableFree(_siteTable);
+		_siteTable = NULL;
+	}
+
+	if (NULL != _sites) {
+		env->getForge()->free(_sites);
+		_sites = NULL;
+	}
+}
+
+void
+MM_AllocationSiteSampler::sample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t bytes)
+{
+	const void *type = NULL;
+	const void *callSite = NULL;
+	env->getAllocationSite(object, &type, &callSite);
+
+	omrthread_monitor_enter(_mutex);
+	SiteRecord *site = findOrReplaceSite(type, callSite);
+	if (NULL != site) {
+		site->sampleCount += 1;
+		/* a site which replaced another is still ranked at the bytes of the site it replaced */
+		spaceSavingUpdate(_ranking, site, bytes);
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+MM_AllocationSiteSampler::SiteRecord *
+MM_AllocationSiteSampler::findOrReplaceSite(const void *type, const void *callSite)
+{
+	SiteRecord key = { type, callSite, 0 };
+	SiteRecord *site = &key;
+	SiteRecord **entry = (SiteRecord **)hashTableFind(_siteTable, &site);
+	if (NULL != entry) {
+		return *entry;
+	}
+
+	bool replaced = false;
+	if (_sitesUsed < _siteCount) {
+		site = &_sites[_sitesUsed];
+		_sitesUsed += 1;
+	} else {
+		/* every tracked site is ranked, so the last one has the fewest bytes */
+		site = (SiteRecord *)spaceSavingGetKthMostFreq(_ranking, spaceSavingGetCurSize(_ranking));
+		hashTableRemove(_siteTable, &site);
+		replaced = true;
+	}
+
+	site->type = type;
+	site->callSite = callSite;
+	site->sampleCount = 0;
+	if (NULL == hashTableAdd(_siteTable, &site)) {
+		/* the entry freed by the removal of a replaced site is reused, so only a new site can fail to be added */
+		Assert_MM_false(replaced);
+		_sitesUsed -= 1;
+		site = NULL;
+	}
+
+	return site;
+}
+
+void
+MM_AllocationSiteSampler::getSites(int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, int32_t *totalCount)
+{
+	omrthread_monitor_enter(_mutex);
+	uintptr_t available = OMR_MIN(spaceSavingGetCurSize(_ranking), _topSiteCount);
+	uintptr_t written = OMR_MIN(available, (uintptr_t)maxSites);
+	for (uintptr_t index = 0; index < written; index++) {
+		SiteRecord *site = (SiteRecord *)spaceSavingGetKthMostFreq(_ranking, index + 1);
+		sites[index].type = site->type;
+		sites[index].callSite = site->callSite;
+		sites[index].allocatedBytes = spaceSavingGetKthMostFreqCount(_ranking, index + 1);
+		sites[index].sampleCount = site->sampleCount;
+	}
+	omrthread_monitor_exit(_mutex);
+
+	if (NULL != writtenCount) {
+		*writtenCount = (int32_t)written;
+	}
+	if (NULL != totalCount) {
+		*totalCount = (int32_t)available;
+	}
+}
+
+uintptr_t
+MM_AllocationSiteSampler::siteHash(void *entry, void *userData)
+{
+	SiteRecord *site = *(SiteRecord **)entry;
+	return ((uintptr_t)site->type * 31) ^ (uintptr_t)site->callSite;
+}
+
+uintptr_t
+MM_AllocationSiteSampler::siteEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	SiteRecord *left = *(SiteRecord **)leftEntry;
+	SiteRecord *right = *(SiteRecord **)rightEntry;
+	return (left->type == right->type) && (left->callSite == right->callSite);
+}
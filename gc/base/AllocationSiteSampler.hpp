@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#if !defined(ALLOCATIONSITESAMPLER_HPP_)
+#define ALLOCATIONSITESAMPLER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omragent.h"
+#include "omrhashtable.h"
+#include "omrthread.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+#include "spacesaving.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/* The number of allocation sites tracked for each site that is reported, so that the reported ranking is accurate. */
+#define ALLOCATION_SITE_SAMPLER_TRACKED_SITES_RATIO 8
+
+/**
+ * Ranks the sites that allocate the most bytes, from allocation samples taken by the allocation interfaces every
+ * -Xgc:allocationSamplingInterval= bytes a thread allocates. A site is the pair of the type of the sampled object
+ * and the call site the language reports for it. The sites are ranked with the space saving top-k algorithm, which
+ * tracks a fixed number of sites: a new site replaces the site with the fewest bytes and inherits its byte count,
+ * so the bytes of a site are an overestimate, by at most the bytes of the site it replaced.
+ * The ranking is read by agents through OMR_TI GetAllocationSites().
+ * @ingroup GC_Base_Core
+ */
+class MM_AllocationSiteSampler : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	typedef struct SiteRecord {
+		const void *type; /**< type of the sampled objects */
+		const void *callSite; /**< language call site of the sampled objects */
+		uintptr_t sampleCount; /**< number of samples taken at the site since it replaced another site */
+	} SiteRecord;
+
+	uintptr_t _topSiteCount; /**< number of sites reported */
+	uintptr_t _siteCount; /**< number of entries in _sites */
+	uintptr_t _sitesUsed; /**< number of entries of _sites which hold a site */
+	SiteRecord *_sites; /**< the tracked sites */
+	J9HashTable *_siteTable; /**< pointers to the entries of _sites, hashed by type and call site */
+	OMRSpaceSaving *_ranking; /**< the entries of _sites ranked by allocated bytes */
+	omrthread_monitor_t _mutex; /**< protects the sites and the ranking */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the tracked site of a type and call site, replacing the site with the fewest bytes if it is not tracked.
+	 * Must be called with _mutex held.
+	 * @return the site, or NULL if the site table could not grow
+	 */
+	SiteRecord *findOrReplaceSite(const void *type, const void *callSite);
+
+	static uintptr_t siteHash(void *entry, void *userData);
+	static uintptr_t siteEquals(void *leftEntry, void *rightEntry, void *userData);
+
+protected:
+public:
+	static MM_AllocationSiteSampler *newInstance(MM_EnvironmentBase *env, uintptr_t topSiteCount);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record a sample of an allocation.
+	 * @param object the object allocated by the sampled allocation
+	 * @param bytes the bytes allocated since the previous sample of the thread, attributed to the site of the object
+	 */
+	void sample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t bytes);
+
+	/**
+	 * Copy the sites which allocated the most bytes, in decreasing order of bytes.
+	 * @param maxSites the number of entries in sites
+	 * @param[out] sites the sites
+	 * @param[out] writtenCount if not NULL, the number of sites written to sites
+	 * @param[out] totalCount if not NULL, the number of sites which can be reported
+	 */
+	void getSites(int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, int32_t *totalCount);
+
+	MM_AllocationSiteSampler(uintptr_t topSiteCount) :
+		MM_BaseNonVirtual()
+		,_topSiteCount(topSiteCount)
+		,_siteCount(topSiteCount * ALLOCATION_SITE_SAMPLER_TRACKED_SITES_RATIO)
+		,_sitesUsed(0)
+		,_sites(NULL)
+		,_siteTable(NULL)
+		,_ranking(NULL)
+		,_mutex(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ALLOCATIONSITESAMPLER_HPP_ */
@@ -27,6 +27,7 @@
 
 #include "AtomicOperations.hpp"
 #include "CardCleaner.hpp"
+#include "CardTableScan.hpp"
 #include "GCExtensionsBase.hpp"
 #include "EnvironmentBase.hpp"
 #include "Heap.hpp"
@@ -302,20 +303,19 @@ MM_CardTable::cardAddrToHeapAddr(MM_EnvironmentBase *env, Card *cardAddr)
 MMINLINE void
 MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high)
 {
-	Card *thisCard = low;
 	Card *endCard = high;
+	Card *thisCard = MM_CardTableScan::findNonCleanCard(low, endCard);
 	uintptr_t cardsCleaned = 0;
 	while (thisCard < endCard) {
-		if (CARD_CLEAN != *thisCard) {
-			void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
-			void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
-			
-			cardCleaner->clean(env, lowAddress, highAddress, thisCard);
-			cardsCleaned += 1;
-		}
-		thisCard += 1;
+		void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
+		void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
+		
+		cardCleaner->clean(env, lowAddress, highAddress, thisCard);
+		cardsCleaned += 1;
+		thisCard = MM_CardTableScan::findNonCleanCard(thisCard + 1, endCard);
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
+	env->_cardCleaningStats._cardsScanned += (high - low);
 }
 
 void
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "CardTableScan.hpp"
+
+#include "NonZeroWordScan.hpp"
+
+Card *
+MM_CardTableScan::findNonCleanCardBulk(Card *card, Card *top)
+{
+	/* Card at a time up to a word boundary.. */
+	while ((card < top) && (0 != ((uintptr_t)card % sizeof(uintptr_t)))) {
+		if ((Card)CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+
+	/* ..then skip the complete words of clean cards in the range (CARD_CLEAN is zero).. */
+	uintptr_t *lastWord = (uintptr_t *)((uintptr_t)top & ~(sizeof(uintptr_t) - 1));
+	if ((uintptr_t *)card < lastWord) {
+		card = (Card *)MM_NonZeroWordScan::findNonZeroWord((uintptr_t *)card, lastWord);
+	}
+
+	/* ..and card at a time through the word holding the non-clean card, or the tail of the range */
+	while ((card < top) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+	return card;
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(CARDTABLESCAN_HPP_)
+#define CARDTABLESCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrmodroncore.h"
+#include "modronbase.h"
+
+/**
+ * Bulk scanning of the card table for cards which are not clean.
+ *
+ * The card table is mostly clean when it is cleaned, so card cleaners spend most of their time skipping clean
+ * cards. CARD_CLEAN is zero, so the complete words of cards in a range are skipped with MM_NonZeroWordScan.
+ * @ingroup GC_Base
+ */
+class MM_CardTableScan
+{
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Find the first card in a range which is not clean.
+	 * @param card first card to examine
+	 * @param top first card past the range
+	 * @return the first card in [card, top) which is not CARD_CLEAN, or top if there is none
+	 */
+	static MMINLINE Card *
+	findNonCleanCard(Card *card, Card *top)
+	{
+		/* Dirty cards tend to be clustered; only hand over to the bulk scanner when the next card is clean */
+		if ((card < top) && ((Card)CARD_CLEAN != *card)) {
+			return card;
+		}
+		return (card < top) ? findNonCleanCardBulk(card + 1, top) : top;
+	}
+
+	/**
+	 * Find the first card in a range which is not clean, skipping the complete words of cards in bulk.
+	 * @see findNonCleanCard()
+	 */
+	static Card *findNonCleanCardBulk(Card *card, Card *top);
+};
+
+#endif /* CARDTABLESCAN_HPP_ */
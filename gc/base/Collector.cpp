@@ -22,13 +22,16 @@
 
 #include "AllocateDescription.hpp"
 #include "Collector.hpp"
+#include "Dispatcher.hpp"
 #include "GCExtensionsBase.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "Heap.hpp"
+#include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronAssertions.h"
 #include "ObjectAllocationInterface.hpp"
 #include "OMRVMThreadListIterator.hpp"
+#include "PhaseTimelineRecorder.hpp"
 
 class MM_MemorySubSpace;
 class MM_MemorySpace;
@@ -460,6 +463,9 @@ MM_Collector::postCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace)
 
 		/* Set the excessive GC state, whether it was an implicit or system GC */
 		setThreadFailAllocFlag(env, excessiveGCDetected);
+
+		/* The free lists have been rebuilt: let the memory maintenance thread zero them again */
+		extensions->memoryManager->resumeMemoryMaintenance(env);
 	}
 }
 
@@ -478,6 +484,14 @@ MM_Collector::garbageCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* calling
 {
 	Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
 
+	/* the GC thread timelines describe only this collection, anything recorded since the previous one is traced first */
+	MM_Dispatcher *dispatcher = env->getExtensions()->dispatcher;
+	MM_PhaseTimelineRecorder *phaseTimelineRecorder = dispatcher->getPhaseTimelineRecorder();
+	if (NULL != phaseTimelineRecorder) {
+		phaseTimelineRecorder->flush(env);
+	}
+	dispatcher->resetCycleThreadCount();
+
 	Assert_MM_true(NULL == env->_cycleState);
 	preCollect(env, callingSubSpace, allocateDescription, gcCode);
 	Assert_MM_true(NULL != env->_cycleState);
@@ -516,6 +530,10 @@ MM_Collector::garbageCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* calling
 	Assert_MM_true(NULL != env->_cycleState);
 	env->_cycleState = NULL;
 
+	if (NULL != phaseTimelineRecorder) {
+		phaseTimelineRecorder->flush(env);
+	}
+
 	return postCollectAllocationResult;
 }
 
@@ -61,7 +61,7 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 {
 	bool result = false;
 
-	if (initializeRegionSize(env) && initializeArrayletLeafSize(env)) {
+	if (initializeHugePages(env) && initializeRegionSize(env) && initializeArrayletLeafSize(env)) {
 		if (_delegate.initialize(env, _writeBarrierType, _allocationType)) {
 			MM_GCExtensionsBase* extensions = env->getExtensions();
 			/* excessivegc is enabled by default */
@@ -368,6 +368,34 @@ MM_Configuration::getAlignment(MM_GCExtensionsBase* extensions, MM_AlignmentType
 	return result;
 }
 
+bool
+MM_Configuration::initializeHugePages(MM_EnvironmentBase* env)
+{
+	bool result = true;
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	if (MM_GCExtensionsBase::HEAP_HUGE_PAGES_EXPLICIT == extensions->heapHugePages) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uintptr_t hugePageSize = 0;
+		uintptr_t hugePageFlags = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
+		omrvmem_default_large_page_size_ex(OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE, &hugePageSize, &hugePageFlags);
+		if (0 != hugePageSize) {
+			/* back the heap with explicit huge pages; the port library falls back to (advised) default pages if they can not be reserved */
+			extensions->requestedPageSize = hugePageSize;
+			extensions->requestedPageFlags = hugePageFlags;
+			extensions->heapHugePageSize = hugePageSize;
+		}
+	}
+
+	if (MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE != extensions->heapHugePages) {
+		/* the heap reservation is aligned to the region size, which initializeRegionSize() rounds up to the huge page size */
+		uintptr_t shift = calculatePowerOfTwoShift(env, extensions->heapHugePageSize);
+		result = (0 != shift) && (extensions->heapHugePageSize == ((uintptr_t)1 << shift));
+	}
+
+	return result;
+}
+
 bool
 MM_Configuration::initializeRegionSize(MM_EnvironmentBase* env)
 {
@@ -377,6 +405,10 @@ MM_Configuration::initializeRegionSize(MM_EnvironmentBase* env)
 	if (0 == regionSize) {
 		regionSize = _defaultRegionSize;
 	}
+	if ((MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE != extensions->heapHugePages) && (regionSize < extensions->heapHugePageSize)) {
+		/* keep every region a whole number of huge pages so that regions never share a huge page */
+		regionSize = extensions->heapHugePageSize;
+	}
 
 	uintptr_t shift = calculatePowerOfTwoShift(env, regionSize);
 	if (0 == shift) {
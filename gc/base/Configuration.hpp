@@ -169,6 +169,7 @@ private:
 	void initializeGCParameters(MM_EnvironmentBase* env);
 
 	uintptr_t getAlignment(MM_GCExtensionsBase* extensions, MM_AlignmentType type);
+	bool initializeHugePages(MM_EnvironmentBase* env);
 	bool initializeRegionSize(MM_EnvironmentBase* env);
 	bool initializeArrayletLeafSize(MM_EnvironmentBase* env);
 	bool initializeRunTimeObjectAlignmentAndCRShift(MM_EnvironmentBase* env, MM_Heap* heap);
@@ -26,6 +26,8 @@
 #include "Dispatcher.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "PhaseTimelineRecorder.hpp"
 #include "Task.hpp"
 
 MM_Dispatcher *
@@ -47,12 +49,28 @@ MM_Dispatcher::newInstance(MM_EnvironmentBase *env)
 void
 MM_Dispatcher::kill(MM_EnvironmentBase *env)
 {
+	if (NULL != _phaseTimelineRecorder) {
+		_phaseTimelineRecorder->kill(env);
+		_phaseTimelineRecorder = NULL;
+	}
 	env->getForge()->free(this);
 }
 
 bool
 MM_Dispatcher::initialize(MM_EnvironmentBase *env)
 {
+	return initializePhaseTimelines(env, 1);
+}
+
+bool
+MM_Dispatcher::initializePhaseTimelines(MM_EnvironmentBase *env, uintptr_t threadCount)
+{
+	if (env->getExtensions()->gcPhaseTimeline) {
+		_phaseTimelineRecorder = MM_PhaseTimelineRecorder::newInstance(env, threadCount);
+		if (NULL == _phaseTimelineRecorder) {
+			return false;
+		}
+	}
 	return true;
 }
 
@@ -97,6 +115,7 @@ MM_Dispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCo
 
 	task->masterSetup(env);
 	prepareThreadsForTask(env, task);
+	_cycleThreadCount = OMR_MAX(_cycleThreadCount, task->getThreadCount());
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
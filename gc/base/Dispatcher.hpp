@@ -35,6 +35,7 @@
 #include "BaseVirtual.hpp"
 
 class MM_EnvironmentBase;
+class MM_PhaseTimelineRecorder;
 class MM_Task;
 
 /**
@@ -53,8 +54,18 @@ private:
 	MM_Task *_task;
 	
 protected:
+	MM_PhaseTimelineRecorder *_phaseTimelineRecorder; /**< timelines of the GC threads, NULL unless -Xgc:gcPhaseTimeline */
+	uintptr_t _cycleThreadCount; /**< largest number of threads a task was dispatched to since resetCycleThreadCount() */
+
 	bool initialize(MM_EnvironmentBase *env);
 
+	/**
+	 * Create the phase timelines of the GC threads, if they were requested.
+	 * @param threadCount the number of GC threads the dispatcher can run
+	 * @return false if the timelines could not be created
+	 */
+	bool initializePhaseTimelines(MM_EnvironmentBase *env, uintptr_t threadCount);
+
 	virtual void prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task);
 	virtual void acceptTask(MM_EnvironmentBase *env);
 	virtual void completeTask(MM_EnvironmentBase *env);
@@ -74,6 +85,23 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) {}
 
 	void run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount = UDATA_MAX);
+
+	/**
+	 * @return the phase timelines of the GC threads, NULL if they are not recorded
+	 */
+	MMINLINE MM_PhaseTimelineRecorder *getPhaseTimelineRecorder() { return _phaseTimelineRecorder; }
+
+	/**
+	 * @return the largest number of threads a task was dispatched to since the last call to resetCycleThreadCount(),
+	 * 0 if no task was dispatched
+	 */
+	MMINLINE uintptr_t cycleThreadCount() { return _cycleThreadCount; }
+
+	/**
+	 * Start counting the threads used by a new collection.
+	 */
+	MMINLINE void resetCycleThreadCount() { _cycleThreadCount = 0; }
+
 	virtual void reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount) {}
 
 	/**
@@ -81,7 +109,9 @@ public:
 	 */
 	MM_Dispatcher(MM_EnvironmentBase *env) :
 		MM_BaseVirtual(),
-		_task(NULL)
+		_task(NULL),
+		_phaseTimelineRecorder(NULL),
+		_cycleThreadCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
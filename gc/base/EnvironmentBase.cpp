@@ -508,6 +508,32 @@ MM_EnvironmentBase::assumeExclusiveVMAccess(uintptr_t exclusiveCount)
 	_delegate.assumeExclusiveVMAccess(exclusiveCount);
 }
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+uintptr_t
+MM_EnvironmentBase::updateTLHAllocationRate(uintptr_t bytesConsumed)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _tlhRefreshTime) {
+		uint64_t elapsedMicros = omrtime_hires_delta(_tlhRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 == elapsedMicros) {
+			elapsedMicros = 1;
+		}
+		uintptr_t sample = (uintptr_t)(((uint64_t)bytesConsumed * 1000) / elapsedMicros);
+		if (0 == _tlhAllocationRate) {
+			_tlhAllocationRate = sample;
+		} else {
+			/* exponential moving average, weighting the newest sample by 1/4 */
+			_tlhAllocationRate = _tlhAllocationRate - (_tlhAllocationRate >> 2) + (sample >> 2);
+		}
+	}
+	_tlhRefreshTime = now;
+
+	return _tlhAllocationRate;
+}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 MM_MemorySubSpace *
 MM_EnvironmentBase::getDefaultMemorySubSpace()
 {
@@ -36,6 +36,7 @@
 #include "GCCode.hpp"
 #include "GCExtensionsBase.hpp"
 #include "LargeObjectAllocateStats.hpp"
+#include "MarkMapCache.hpp"
 #include "MarkStats.hpp"
 #include "RootScannerStats.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
@@ -52,6 +53,7 @@ class MM_Collector;
 class MM_HeapRegionQueue;
 class MM_MemorySpace;
 class MM_ObjectAllocationInterface;
+class MM_PhaseTimeline;
 class MM_SegregatedAllocationTracker;
 class MM_Task;
 class MM_Validator;
@@ -141,20 +143,39 @@ public:
 	
 	MM_WorkPacketStats _workPacketStats;
 	MM_WorkPacketStats _workPacketStatsRSScan;   /**< work packet Stats specifically for RS Scan Phase of Concurrent STW GC */
+	uintptr_t _workPacketNodeIndex; /**< Index of the NUMA affinity leader whose work packet lists this thread prefers (0 if work packets are not NUMA-aware) */
 
 	uint64_t _slaveThreadCpuTimeNanos;	/**< Total CPU time used by this slave thread (or 0 for non-slaves) */
 
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
+	uintptr_t _allocationSamplingBytes; /**< bytes allocated since the last allocation site sample (see -Xgc:allocationSamplingInterval=) */
+	uintptr_t _pendingAllocationSampleBytes; /**< bytes to attribute to the object being allocated once it is initialized, 0 if the allocation is not sampled */
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	uint64_t _tlhRefreshTime; /**< hires clock value at this thread's last TLH refresh, 0 if the next refresh should not produce a rate sample */
+	uintptr_t _tlhAllocationRate; /**< smoothed number of bytes this thread consumes from its TLHs per millisecond */
+	uintptr_t _tlhBytesSinceRestart; /**< bytes of TLH handed to this thread since its caches were last restarted by a GC */
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	uintptr_t _loaLastAllocationSize; /**< size of this thread's last allocation from the large object area */
+	uintptr_t _loaReservationSize; /**< object size this thread's large object area reservation was taken for, 0 if it holds none */
+	void *_loaReservationAlloc; /**< address of the next object in this thread's large object area reservation */
+	void *_loaReservationTop; /**< top of this thread's large object area reservation */
+	uintptr_t _loaReservationGCCount; /**< global collection count when the reservation was taken, any later collection drops it */
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
 
 	MM_Validator *_activeValidator; /**< Used to identify and report crashes inside Validators */
 
 	MM_MarkStats _markStats;
+	MM_MarkMapCache _markMapCache; /**< mark bits set by this thread and not yet published to the mark map (see -Xgc:markMapCache) */
 
 	MM_RootScannerStats _rootScannerStats; /**< Per thread stats to track the performance of the root scanner */
 
 	const char * _lastSyncPointReached; /**< string indicating latest sync point reached by this associated env's thread */
+	MM_PhaseTimeline *_phaseTimeline; /**< timeline the thread records its phases and stalls into while it runs a task, NULL if none is recorded */
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
@@ -385,6 +406,14 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Report the site of an object sampled by the allocation site sampler (see -Xgc:allocationSamplingInterval=).
+	 * @param omrObject the object allocated by the sampled allocation
+	 * @param[out] type the type of the object
+	 * @param[out] callSite the call site which allocated the object, NULL if it is not known
+	 */
+	void getAllocationSite(omrobjectptr_t omrObject, const void **type, const void **callSite) { _delegate.getAllocationSite(omrObject, type, callSite); }
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -525,6 +554,24 @@ public:
 	 * @return TRUE if inline TLH allocates currently enabled for this thread; FALSE otherwise
 	 */
 	bool isInlineTLHAllocateEnabled() { return _delegate.isInlineTLHAllocateEnabled(); }
+
+	/**
+	 * Fold the bytes consumed from a TLH since the previous refresh into this thread's
+	 * smoothed allocation rate.
+	 * @param bytesConsumed bytes allocated from the TLH being retired
+	 * @return the updated allocation rate, in bytes per millisecond
+	 */
+	uintptr_t updateTLHAllocationRate(uintptr_t bytesConsumed);
+
+	/**
+	 * Forget the time of the last TLH refresh and the TLH bytes consumed so far, so that
+	 * time spent in a collection does not count against this thread's allocation rate.
+	 */
+	void restartTLHAllocationRate()
+	{
+		_tlhRefreshTime = 0;
+		_tlhBytesSinceRestart = 0;
+	}
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 	MMINLINE uintptr_t getWorkUnitIndex() { return _workUnitIndex; }
@@ -627,11 +674,27 @@ public:
 		,_isInNoGCAllocationCall(false)
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
+		,_workPacketNodeIndex(0)
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSamplingBytes(0)
+		,_pendingAllocationSampleBytes(0)
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		,_tlhRefreshTime(0)
+		,_tlhAllocationRate(0)
+		,_tlhBytesSinceRestart(0)
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		,_loaLastAllocationSize(0)
+		,_loaReservationSize(0)
+		,_loaReservationAlloc(NULL)
+		,_loaReservationTop(NULL)
+		,_loaReservationGCCount(0)
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
+		,_phaseTimeline(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -675,11 +738,27 @@ public:
 		,_isInNoGCAllocationCall(false)
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
+		,_workPacketNodeIndex(0)
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSamplingBytes(0)
+		,_pendingAllocationSampleBytes(0)
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		,_tlhRefreshTime(0)
+		,_tlhAllocationRate(0)
+		,_tlhBytesSinceRestart(0)
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		,_loaLastAllocationSize(0)
+		,_loaReservationSize(0)
+		,_loaReservationAlloc(NULL)
+		,_loaReservationTop(NULL)
+		,_loaReservationGCCount(0)
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
+		,_phaseTimeline(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
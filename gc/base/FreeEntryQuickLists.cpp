@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "FreeEntryQuickLists.hpp"
+
+#include "LargeObjectAllocateStats.hpp"
+#include "ModronAssertions.h"
+
+uintptr_t
+MM_FreeEntryQuickLists::addList(uintptr_t size, uintptr_t minimumSize)
+{
+	uintptr_t index = _listCount;
+	if (index < MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM) {
+		QuickList *list = &_lists[index];
+		list->_size = size;
+		list->_minimumSize = (0 == minimumSize) ? size : minimumSize;
+		list->_head = 0;
+		list->_entryCount = 0;
+		list->_allocatedCount = 0;
+		list->_reportedCount = 0;
+		_listCount += 1;
+	}
+	return index;
+}
+
+void
+MM_FreeEntryQuickLists::pushEntries(uintptr_t index, void *addrBase, uintptr_t count)
+{
+	Assert_MM_true(index < _listCount);
+	QuickList *list = &_lists[index];
+	uintptr_t size = list->_size;
+
+	/* link the entries of the chunk from the highest address down, so the list is popped in address order */
+	MM_HeapLinkedFreeHeader *next = (MM_HeapLinkedFreeHeader *)list->_head;
+	for (uintptr_t i = count; i > 0; i--) {
+		void *entryBase = (void *)((uintptr_t)addrBase + ((i - 1) * size));
+		MM_HeapLinkedFreeHeader *entry = MM_HeapLinkedFreeHeader::fillWithHoles(entryBase, size);
+		Assert_MM_true(entry == entryBase);
+		entry->setNext(next);
+		next = entry;
+	}
+	list->_head = (uintptr_t)next;
+	list->_entryCount += count;
+}
+
+void
+MM_FreeEntryQuickLists::clear()
+{
+	_listCount = 0;
+}
+
+uintptr_t
+MM_FreeEntryQuickLists::getFreeBytes()
+{
+	uintptr_t freeBytes = 0;
+	for (uintptr_t i = 0; i < _listCount; i++) {
+		QuickList *list = &_lists[i];
+		freeBytes += (list->_entryCount - list->_allocatedCount) * list->_size;
+	}
+	return freeBytes;
+}
+
+uintptr_t
+MM_FreeEntryQuickLists::reportAllocations(MM_LargeObjectAllocateStats *largeObjectAllocateStats, uintptr_t *bytesAllocated)
+{
+	uintptr_t allocationCount = 0;
+	*bytesAllocated = 0;
+	for (uintptr_t i = 0; i < _listCount; i++) {
+		QuickList *list = &_lists[i];
+		uintptr_t allocatedCount = list->_allocatedCount;
+		uintptr_t delta = allocatedCount - list->_reportedCount;
+		if (0 != delta) {
+			largeObjectAllocateStats->allocateObject(list->_size, delta);
+			allocationCount += delta;
+			*bytesAllocated += delta * list->_size;
+			list->_reportedCount = allocatedCount;
+		}
+	}
+	return allocationCount;
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(FREEENTRYQUICKLISTS_HPP_)
+#define FREEENTRYQUICKLISTS_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+
+class MM_EnvironmentBase;
+class MM_LargeObjectAllocateStats;
+
+#define MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM 8
+
+/**
+ * Lock-free front end of an address ordered memory pool.
+ * A small number of segregated lists, each holding free entries of one size, that are popped with a
+ * compare and swap instead of taking the pool lock. Lists are only pushed to while the world is stopped (after
+ * a global collection has rebuilt the free list), so popping is not subject to ABA.
+ * A list either serves its exact entry size, or a band of sizes up to it, in which case the tail of a popped
+ * entry is left behind as a hole until the next sweep.
+ * Entries are formatted as free list holes, keeping the heap walkable while they sit on a list.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntryQuickLists : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	struct QuickList {
+		uintptr_t _size; /**< exact size in bytes of every entry on this list */
+		uintptr_t _minimumSize; /**< smallest allocation size served by this list (_size for an exact size list) */
+		volatile uintptr_t _head; /**< top of the lock-free stack of entries */
+		uintptr_t _entryCount; /**< number of entries pushed when the list was populated */
+		volatile uintptr_t _allocatedCount; /**< number of entries popped since the list was populated */
+		uintptr_t _reportedCount; /**< value of _allocatedCount already folded into the allocation stats */
+	};
+
+	QuickList _lists[MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM];
+	uintptr_t _listCount; /**< number of lists in use */
+
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+protected:
+public:
+	/**
+	 * Pop an entry from the list serving the requested size, if one is available.
+	 * @param sizeInBytesRequired allocation size
+	 * @return the address of the entry, or NULL if there is no list for this size or it is empty
+	 */
+	MMINLINE void *
+	allocate(uintptr_t sizeInBytesRequired)
+	{
+		for (uintptr_t i = 0; i < _listCount; i++) {
+			QuickList *list = &_lists[i];
+			if ((list->_minimumSize <= sizeInBytesRequired) && (sizeInBytesRequired <= list->_size)) {
+				uintptr_t head = list->_head;
+				while (0 != head) {
+					/* a stale next read by a loser of the race is discarded by the failing exchange */
+					uintptr_t next = (uintptr_t)((MM_HeapLinkedFreeHeader *)head)->getNext();
+					if (head == MM_AtomicOperations::lockCompareExchange(&list->_head, head, next)) {
+						MM_AtomicOperations::add(&list->_allocatedCount, 1);
+						if (sizeInBytesRequired < list->_size) {
+							/* the rest of a band entry stays a hole, reclaimed by the next sweep */
+							MM_HeapLinkedFreeHeader::fillWithHoles((void *)(head + sizeInBytesRequired), list->_size - sizeInBytesRequired);
+						}
+						return (void *)head;
+					}
+					head = list->_head;
+				}
+				return NULL;
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * @return true if no list is in use
+	 */
+	MMINLINE bool isEmpty() { return 0 == _listCount; }
+
+	/**
+	 * Add a list for the given entry size. Must be called while the world is stopped.
+	 * @param size size of the entries on the list
+	 * @param minimumSize smallest allocation size served by the list, 0 if it only serves its exact entry size.
+	 * Bands of different lists must not overlap.
+	 * @return the index of the list, or MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM if all lists are in use
+	 */
+	uintptr_t addList(uintptr_t size, uintptr_t minimumSize = 0);
+
+	/**
+	 * Push a chunk of memory, carved as count consecutive entries, to the list at the given index.
+	 * Must be called while the world is stopped.
+	 */
+	void pushEntries(uintptr_t index, void *addrBase, uintptr_t count);
+
+	/**
+	 * Drop all lists. Entries still on the lists are left formatted as holes, and are reclaimed by the next sweep.
+	 * Allocations not yet reported are lost. Must be called while the world is stopped.
+	 */
+	void clear();
+
+	/**
+	 * @return the number of free bytes held by the lists
+	 */
+	uintptr_t getFreeBytes();
+
+	/**
+	 * Fold the allocations satisfied from the lists since the last call into the given stats.
+	 * Allocations from a band are reported at the entry size, which is the memory they consumed.
+	 * @param[out] bytesAllocated number of bytes allocated from the lists since the last call
+	 * @return number of allocations satisfied from the lists since the last call
+	 */
+	uintptr_t reportAllocations(MM_LargeObjectAllocateStats *largeObjectAllocateStats, uintptr_t *bytesAllocated);
+
+	MM_FreeEntryQuickLists() :
+		MM_BaseNonVirtual()
+		,_listCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* FREEENTRYQUICKLISTS_HPP_ */
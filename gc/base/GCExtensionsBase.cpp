@@ -28,6 +28,7 @@
 #include "omrmemcategories.h"
 #include "modronbase.h"
 
+#include "AllocationSiteSampler.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -260,6 +261,11 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 		collectorLanguageInterface = NULL;
 	}
 
+	if (NULL != allocationSiteSampler) {
+		allocationSiteSampler->kill(env);
+		allocationSiteSampler = NULL;
+	}
+
 	if (NULL != environments) {
 		pool_kill(environments);
 		environments = NULL;
@@ -275,6 +281,11 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 		_lightweightNonReentrantLockPoolMutex = (omrthread_monitor_t) NULL;
 	}
 
+	if (NULL != gcPhaseTraceFileName) {
+		_forge.free(gcPhaseTraceFileName);
+		gcPhaseTraceFileName = NULL;
+	}
+
 	_forge.tearDown();
 
 	J9HookInterface** tmpHookInterface = getPrivateHookInterface();
@@ -53,6 +53,7 @@
 #include <set>
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
 
+class MM_AllocationSiteSampler;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_Collector;
@@ -60,6 +61,7 @@ class MM_CollectorLanguageInterface;
 class MM_CompactGroupPersistentStats;
 class MM_CompressedCardTable;
 class MM_Configuration;
+class MM_ConcurrentEvacuator;
 class MM_Dispatcher;
 class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
@@ -75,6 +77,7 @@ class MM_ObjectMap;
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 class MM_ReferenceChainWalkerMarkMap;
 class MM_RememberedSetCardBucket;
+class MM_RememberedSetCards;
 #if defined(OMR_GC_STACCATO)
 class MM_RememberedSetWorkPackets;
 #endif /* OMR_GC_STACCATO */
@@ -103,6 +106,34 @@ struct J9Pool;
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* The length of the hot field chain followed when copying hot children depth-first. */
+#define DEFAULT_HOT_FIELD_COPY_DEPTH 4
+
+/* The number of scavenges whose survival rates the Decay scavenger tenure strategy averages. */
+#define DEFAULT_SCV_TENURE_DECAY_WINDOW 8
+
+/* The number of popped objects held in the marking prefetch ring before they are scanned (0, the plain scan loop, unless requested). */
+#define DEFAULT_MARKING_PREFETCH_DEPTH 0
+#define MAXIMUM_MARKING_PREFETCH_DEPTH 32
+
+#define DEFAULT_FREE_ENTRY_QUICK_LIST_SIZES 4
+#define MAXIMUM_FREE_ENTRY_QUICK_LIST_SIZES 8
+
+/* The transparent huge page size assumed when the heap is advised for huge pages. */
+#define DEFAULT_HEAP_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+/* The number of megabytes per second the memory maintenance thread may decommit or zero. */
+#define DEFAULT_MEMORY_MAINTENANCE_RATE 1024
+
+/* The number of events each GC thread can record in its phase timeline per collection. */
+#define DEFAULT_GC_PHASE_TIMELINE_SIZE 1024
+
+/* The number of allocation sites ranked by the allocation site sampler. */
+#define DEFAULT_ALLOCATION_SAMPLING_TOP_SITES 32
+
+/* The number of bytes of expected work below which a task is not dispatched to another GC thread. */
+#define DEFAULT_GC_THREAD_MINIMUM_WORK (1024 * 1024)
+
 #define NO_ESTIMATE_FRAGMENTATION 			0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 		0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 	0x2
@@ -250,6 +281,17 @@ public:
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
 
+	enum HeapHugePages {
+		HEAP_HUGE_PAGES_NONE = 0, /**< heap is backed by whatever page size was requested */
+		HEAP_HUGE_PAGES_TRANSPARENT, /**< heap is reserved huge page aligned and advised for transparent huge pages */
+		HEAP_HUGE_PAGES_EXPLICIT, /**< heap is backed by explicit (hugetlbfs) huge pages, falling back to transparent huge pages if none are available */
+	};
+
+	HeapHugePages heapHugePages; /**< huge page backing requested for the heap (set through -Xgc:heapHugePages=) */
+	uintptr_t heapHugePageSize; /**< size of the huge pages backing the heap; region size and heap alignment are kept a multiple of it */
+	bool memoryMaintenance; /**< if true, the memory manager runs a background thread that decommits contracted heap memory after the pause and pre-zeroes free memory ahead of TLH allocation (enabled with -Xgc:memoryMaintenance) */
+	uintptr_t memoryMaintenanceRate; /**< maximum number of megabytes per second the memory maintenance thread decommits or zeroes (set through -Xgc:memoryMaintenanceRate=) */
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -270,6 +312,9 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	uintptr_t allocationSamplingInterval; /**< number of bytes a thread allocates between two allocation site samples, 0 if allocation sites are not sampled (set through -Xgc:allocationSamplingInterval=) */
+	uintptr_t allocationSamplingTopSites; /**< number of allocation sites ranked by the allocation site sampler (set through -Xgc:allocationSamplingTopSites=) */
+	MM_AllocationSiteSampler *allocationSiteSampler; /**< ranking of the sampled allocation sites, NULL if allocation sites are not sampled */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -300,6 +345,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each thread's TLH refresh size follows its own allocation rate instead of growing by tlhIncrementSize on every refresh (enabled with the -Xgc:tlhAdaptiveSizing option) */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< with adaptive TLH sizing, the number of microseconds of allocation a refreshed TLH should cover */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -309,6 +356,9 @@ public:
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool freeEntryQuickLists; /**< if true, address ordered tenure pools keep lock-free lists of free entries for the most frequently allocated large object sizes (enabled with the -Xgc:freeEntryQuickLists option) */
+	uintptr_t freeEntryQuickListSizes; /**< maximum number of allocation sizes given a quick-list (at most MAXIMUM_FREE_ENTRY_QUICK_LIST_SIZES) */
+	uintptr_t freeEntryQuickListPercent; /**< percentage of the free memory left after a global collection that may be carved into quick-list entries */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -327,6 +377,9 @@ public:
 	bool debugLOAAllocate;
 	int loaFreeHistorySize; /**< max size of _loaFreeRatioHistory array */
 	ConcurrentMetering concurrentMetering;
+	bool loaSizeBands; /**< if true, the large object area keeps lock-free size band lists built from the allocation profile (enabled with the -Xgc:loaSizeBands option) */
+	uintptr_t loaSizeBandPercent; /**< percentage of the large object area free memory left after a global collection that may be carved into size band entries */
+	uintptr_t loaReservationCount; /**< number of objects a thread reserves in the large object area when it repeats an allocation size, 0 if threads do not reserve */
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 
 	uintptr_t** markingStackList;
@@ -350,6 +403,11 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool numaAwareWorkPackets; /**< True if packet lists are split per NUMA node so that threads take work from their own node first (disabled with the -Xgc:noNumaAwareWorkPackets option) */
+	bool workStealingDeque; /**< True if parallel marking threads push to a per-thread lock-free deque that idle threads steal from, instead of going through the packet lists (enabled with the -Xgc:workStealingDeque option) */
+	uintptr_t workStealingDequeSize; /**< The number of elements in each thread's work stealing deque, beyond which work spills over to packets */
+	uintptr_t markingPrefetchDepth; /**< Number of objects prefetched ahead of the object being scanned by the marking scan loop, 0 disables prefetching (at most MAXIMUM_MARKING_PREFETCH_DEPTH) */
+	bool markMapCache; /**< True if the marking scan loop collects mark bits in a per-thread cache and publishes each mark map slot with one atomic OR (enabled with the -Xgc:markMapCache option) */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -398,6 +456,8 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	uintptr_t gcThreadMinimumWork; /**< bytes of expected work each GC thread a task is dispatched to should have, 0 to dispatch tasks to all threads regardless of their work */
+	bool gcThreadMinimumWorkForced; /**< true if gcThreadMinimumWork is specified in options, in which case it also limits a forced number of GC threads */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -417,6 +477,9 @@ public:
 	bool scvTenureStrategyAdaptive; /**< Flag for enabling the Adaptive scavenger tenure strategy. */
 	bool scvTenureStrategyLookback; /**< Flag for enabling the Lookback scavenger tenure strategy. */
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
+	bool scvTenureStrategyDecay; /**< Flag for enabling the Decay scavenger tenure strategy, which replaces the Adaptive one. */
+	uintptr_t scvTenureDecayWindow; /**< The number of scavenges whose survival rates by age the Decay scavenger tenure strategy averages. */
+	uintptr_t scvTenureDecayTenureAge; /**< The tenure age last chosen by the Decay scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -432,6 +495,10 @@ public:
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	bool scavengerHotFieldCopy; /**< True if the scavenger copies the hot child of each copied object immediately after its parent (enabled with the -Xgc:scvHotFieldCopy option) */
+	uintptr_t scavengerHotFieldCopyDepth; /**< maximum number of hot children copied depth-first from a single parent object */
+	bool scavengerRememberedSetCards; /**< True if mutators record remembered objects in store buffers flushed to remembered set cards (enabled with the -Xgc:scvRememberedSetCards option) */
+	MM_RememberedSetCards *rememberedSetCards; /**< card granular remembered set owned by the scavenger, NULL if remembered set cards are disabled */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -452,6 +519,8 @@ public:
 	double dnssMaximumContraction;
 	double dnssMinimumExpansion;
 	double dnssMinimumContraction;
+	uintptr_t scavengerPauseTarget; /**< target scavenge pause in microseconds (set by -Xgc:scvPauseTarget= in milliseconds), 0 leaves nursery sizing to dynamic new space sizing */
+	uintptr_t scavengerOverheadTarget; /**< target percentage of time spent scavenging, used by the pause target controller to decide when to expand the nursery */
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 
 	enum HeapInitializationSplitHeapSection {
@@ -487,6 +556,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactSummaryTable; /**< if true, compaction slides objects using per-chunk summary tables computed by a parallel prefix sum over the mark map */
+	uintptr_t compactSummaryChunkSize; /**< heap bytes covered by one summary table chunk (rounded up to a compact table page) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -503,6 +574,11 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool concurrentEvacuation; /**< if true, the most fragmented tenure areas are evacuated between concurrent cycles */
+	uintptr_t concurrentEvacuationAreaSize; /**< heap bytes covered by one evacuation area (rounded up to a power of two) */
+	uintptr_t concurrentEvacuationLiveThreshold; /**< areas whose live bytes are below this percentage of their size are evacuation candidates */
+	uintptr_t concurrentEvacuationMaxAreas; /**< maximum number of areas selected for evacuation per cycle */
+	MM_ConcurrentEvacuator *concurrentEvacuator; /**< evacuator owned by the concurrent collector, NULL if concurrent evacuation is disabled */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -599,7 +675,9 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	uintptr_t allocationMagazineCount; /**< number of allocation cache sized magazines a thread carves from a small region at once, the first loaded, the next kept by the thread and the others parked in the allocation context depot (0 or 1 disables magazines) */
 	bool nonDeterministicSweep;
+	bool lazySweep; /**< if set, a segregated heap collection leaves the small regions unswept, to be swept on demand by allocating threads or by a background thread */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -611,6 +689,10 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	uintptr_t verboseRingBufferSize; /**< Set by -Xgc:verboseRingBufferSize=.  If non-zero, verbose:gc files are written as binary records into a memory mapped ring of this size (0 to write text) */
+	bool gcPhaseTimeline; /**< Enabled by -Xgc:gcPhaseTimeline.  GC threads record the times of their tasks, phases and stalls, and verbose:gc summarizes them per collection */
+	uintptr_t gcPhaseTimelineSize; /**< Set by -Xgc:gcPhaseTimelineSize=.  Number of events each GC thread can record per collection, further events are only counted */
+	char *gcPhaseTraceFileName; /**< Set by -Xgc:gcPhaseTraceFile=.  If non-NULL, the phase timelines are also written to this file as Chrome trace events */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -824,6 +906,20 @@ public:
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	}
 
+	/**
+	 * The pause target controller replaces dynamic new space sizing and the adaptive tenure age heuristic
+	 * for stop-the-world scavenges when a scavenge pause target has been specified.
+	 */
+	MMINLINE bool
+	isScavengerPauseTargetEnabled()
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		return (0 != scavengerPauseTarget) && !isConcurrentScavengerEnabled();
+#else
+		return false;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	}
+
 	MMINLINE bool
 	isConcurrentMarkEnabled()
 	{
@@ -1219,6 +1315,10 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapHugePages(HEAP_HUGE_PAGES_NONE)
+		, heapHugePageSize(DEFAULT_HEAP_HUGE_PAGE_SIZE)
+		, memoryMaintenance(false)
+		, memoryMaintenanceRate(DEFAULT_MEMORY_MAINTENANCE_RATE)
 #if defined(OMR_GC_STACCATO)
 		, staccatoRememberedSet(NULL)
 #endif /* OMR_GC_STACCATO */
@@ -1231,6 +1331,9 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSamplingInterval(0)
+		, allocationSamplingTopSites(DEFAULT_ALLOCATION_SAMPLING_TOP_SITES)
+		, allocationSiteSampler(NULL)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1254,12 +1357,17 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(1000)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
 		, gcModeString(NULL)
 		, splitFreeListSplitAmount(0)
 		, enableHybridMemoryPool(false)
+		, freeEntryQuickLists(false)
+		, freeEntryQuickListSizes(DEFAULT_FREE_ENTRY_QUICK_LIST_SIZES)
+		, freeEntryQuickListPercent(5)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1270,6 +1378,9 @@ public:
 		, debugLOAFreelist(false)
 		, debugLOAAllocate(false)
 		, loaFreeHistorySize(15)
+		, loaSizeBands(false)
+		, loaSizeBandPercent(25)
+		, loaReservationCount(0)
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 		, heapAlignment(HEAP_ALIGNMENT)
 		, absoluteMinimumOldSubSpaceSize(MINIMUM_OLD_SPACE_SIZE)
@@ -1289,6 +1400,11 @@ public:
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, cacheListSplit(0)
+		, numaAwareWorkPackets(true)
+		, workStealingDeque(false)
+		, workStealingDequeSize(4096)
+		, markingPrefetchDepth(DEFAULT_MARKING_PREFETCH_DEPTH)
+		, markMapCache(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1323,6 +1439,8 @@ public:
 		, softMx(0) /* softMx only set if specified */
 		, batchClearTLH(0)
 		, gcThreadCountForced(false)
+		, gcThreadMinimumWork(DEFAULT_GC_THREAD_MINIMUM_WORK)
+		, gcThreadMinimumWorkForced(false)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		, scavengerTraceHotFields(false)
@@ -1337,6 +1455,9 @@ public:
 		, scvTenureStrategyAdaptive(true)
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
+		, scvTenureStrategyDecay(false)
+		, scvTenureDecayWindow(DEFAULT_SCV_TENURE_DECAY_WINDOW)
+		, scvTenureDecayTenureAge(J9_OBJECT_HEADER_AGE_DEFAULT)
 		, scavengerEnabled(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, concurrentScavenger(false)
@@ -1351,6 +1472,10 @@ public:
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, scavengerHotFieldCopy(false)
+		, scavengerHotFieldCopyDepth(DEFAULT_HOT_FIELD_COPY_DEPTH)
+		, scavengerRememberedSetCards(false)
+		, rememberedSetCards(NULL)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1371,6 +1496,8 @@ public:
 		, dnssMaximumContraction(0.5)
 		, dnssMinimumExpansion(0.0)
 		, dnssMinimumContraction(0.0)
+		, scavengerPauseTarget(0)
+		, scavengerOverheadTarget(5)
 		, enableSplitHeap(false)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -1394,6 +1521,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactSummaryTable(false)
+		, compactSummaryChunkSize(64 * 1024)
 		, payAllocationTax(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1412,6 +1541,11 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, concurrentEvacuation(false)
+		, concurrentEvacuationAreaSize(256 * 1024)
+		, concurrentEvacuationLiveThreshold(25)
+		, concurrentEvacuationMaxAreas(16)
+		, concurrentEvacuator(NULL)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1494,12 +1628,18 @@ public:
 		, allocationCacheMaximumSize(16384)
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
+		, allocationMagazineCount(0)
 		, nonDeterministicSweep(false)
+		, lazySweep(false)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, verboseRingBufferSize(0)
+		, gcPhaseTimeline(false)
+		, gcPhaseTimelineSize(DEFAULT_GC_PHASE_TIMELINE_SIZE)
+		, gcPhaseTraceFileName(NULL)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
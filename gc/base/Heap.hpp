@@ -112,6 +112,12 @@ public:
 	 * Return the page flags describing the pages used for the heap memory.
 	 */
 	virtual uintptr_t getPageFlags() = 0;
+
+	/**
+	 * Return the number of bytes of heap memory currently backed by huge pages.
+	 * This should be used for reporting purposes only.
+	 */
+	virtual uintptr_t getHugePageBackedSize() { return 0; }
 	
 	virtual void *getHeapBase() = 0;
 	virtual void *getHeapTop() = 0;
@@ -123,6 +129,10 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+	/**
+	 * Decommit a range released by a contraction, possibly after the current pause (see MM_MemoryManager::decommitMemoryInBackground).
+	 */
+	virtual bool decommitMemoryInBackground(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) { return decommitMemory(address, size, lowValidAddress, highValidAddress); }
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -194,7 +194,11 @@ public:
 		return true;
 	}
 
-	MMINLINE void 
+	/**
+	 * Atomically OR bits into a heap map slot.
+	 * @return the value of the slot before the update
+	 */
+	MMINLINE uintptr_t
 	atomicSetSlot(uintptr_t slotIndex, uintptr_t slotValue)
 	{
 		/* Ensure compiler does not optimize away assign into oldValue */
@@ -206,6 +210,7 @@ public:
 		} while(oldValue != MM_AtomicOperations::lockCompareExchange(slotAddress,
 																	 oldValue, 
 																	 oldValue | slotValue));
+		return oldValue;
 	}
 
 	MMINLINE uintptr_t 
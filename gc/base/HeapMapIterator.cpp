@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScan.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -126,11 +127,17 @@ MM_HeapMapIterator::nextObject()
 		/* The termination point may not be at the end of the map slot - adjust accordingly */
 		_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (J9BITS_BITS_IN_SLOT - _bitIndexHead);
 
-		/* Move to the next mark map slot */
+		/* Move to the next non-empty mark map slot, skipping runs of empty slots in bulk */
 		_heapMapSlotCurrent += 1;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+			uintptr_t heapMapSlotsToScan = ((uintptr_t)(_heapChunkTop - _heapSlotCurrent) + J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT - 1) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+			uintptr_t *heapMapSlotNonEmpty = MM_HeapMapScan::findNonEmptySlot(_heapMapSlotCurrent, _heapMapSlotCurrent + heapMapSlotsToScan);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNonEmpty - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = heapMapSlotNonEmpty;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
 		}
 	}
 
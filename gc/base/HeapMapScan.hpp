@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCAN_HPP_)
+#define HEAPMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "NonZeroWordScan.hpp"
+
+/**
+ * Bulk scanning of heap map (mark map) slots.
+ *
+ * Heap map walkers spend most of their time skipping empty slots, which correspond to free memory or to
+ * the body of large objects. Runs of empty slots are skipped with MM_NonZeroWordScan.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScan
+{
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Find the first non-empty heap map slot in a range.
+	 * @param slot first heap map slot to examine
+	 * @param top first heap map slot past the range
+	 * @return the first slot in [slot, top) holding a set bit, or top if there is none
+	 */
+	static MMINLINE uintptr_t *
+	findNonEmptySlot(uintptr_t *slot, uintptr_t *top)
+	{
+		/* Most runs are short; only hand over to the bulk scanner when the first slots are all empty */
+		if ((slot < top) && (0 != *slot)) {
+			return slot;
+		}
+		slot += 1;
+		if ((slot < top) && (0 != *slot)) {
+			return slot;
+		}
+		return (slot < top) ? MM_NonZeroWordScan::findNonZeroWord(slot + 1, top) : top;
+	}
+};
+
+#endif /* HEAPMAPSCAN_HPP_ */
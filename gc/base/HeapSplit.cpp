@@ -183,6 +183,12 @@ MM_HeapSplit::getPageFlags()
 	return (_lowExtent->getPageSize() < _highExtent->getPageSize()) ? _lowExtent->getPageFlags() : _highExtent->getPageFlags();
 }
 
+uintptr_t
+MM_HeapSplit::getHugePageBackedSize()
+{
+	return _lowExtent->getHugePageBackedSize() + _highExtent->getHugePageBackedSize();
+}
+
 /**
  * Answer the largest size the heap will ever consume.
  * The value returned represents the difference between the lowest and highest possible address range
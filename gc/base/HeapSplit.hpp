@@ -59,6 +59,7 @@ public:
 	
 	virtual uintptr_t getPageSize();
 	virtual uintptr_t getPageFlags();
+	virtual uintptr_t getHugePageBackedSize();
 	virtual void *getHeapBase();
 	virtual void *getHeapTop();
 
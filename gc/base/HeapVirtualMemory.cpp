@@ -188,6 +188,13 @@ MM_HeapVirtualMemory::getPageFlags()
 	return memoryManager->getPageFlags(&_vmemHandle);
 }
 
+uintptr_t
+MM_HeapVirtualMemory::getHugePageBackedSize()
+{
+	MM_MemoryManager* memoryManager = MM_GCExtensionsBase::getExtensions(_omrVM)->memoryManager;
+	return memoryManager->getHugePageBackedSize(&_vmemHandle);
+}
+
 /**
  * Answer the largest size the heap will ever consume.
  * The value returned represents the difference between the lowest and highest possible address range
@@ -319,6 +326,18 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Decommit the address range from physical memory, once the current pause is over if the memory maintenance thread is running.
+ * @return true if successful or queued, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::decommitMemoryInBackground(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->decommitMemoryInBackground(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
@@ -54,6 +54,7 @@ public:
 
 	virtual uintptr_t getPageSize();
 	virtual uintptr_t getPageFlags();
+	virtual uintptr_t getHugePageBackedSize();
 	virtual void* getHeapBase();
 	virtual void* getHeapTop();
 
@@ -64,6 +65,7 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual bool decommitMemoryInBackground(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
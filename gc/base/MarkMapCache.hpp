@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(MARKMAPCACHE_HPP_)
+#define MARKMAPCACHE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/* Number of mark map slots a thread caches, must be a power of 2 */
+#define MARK_MAP_CACHE_ENTRIES 8
+
+/**
+ * Per thread cache of mark bits which were set during marking but not yet published to the mark map.
+ * Each entry accumulates the new bits of one mark map slot, which are published with a single atomic OR
+ * when the entry is evicted or the cache is flushed (see MM_MarkingScheme::flushMarkMapCache()).
+ * @ingroup GC_Base_Core
+ */
+class MM_MarkMapCache
+{
+/*
+ * Data members
+ */
+public:
+	typedef struct Entry {
+		uintptr_t slotIndex; /**< index of the cached mark map slot, meaningless if markBits is 0 */
+		uintptr_t markBits; /**< bits set in the slot by the owning thread and not yet published */
+		uintptr_t scanBits; /**< subset of markBits for objects which must be scanned once marked */
+	} Entry;
+
+	Entry _entries[MARK_MAP_CACHE_ENTRIES]; /**< direct mapped on the low bits of the slot index */
+
+/*
+ * Function members
+ */
+public:
+	/**
+	 * @return the entry a mark map slot is cached in
+	 */
+	MMINLINE Entry *
+	getEntry(uintptr_t slotIndex)
+	{
+		return &_entries[slotIndex & (MARK_MAP_CACHE_ENTRIES - 1)];
+	}
+
+	/**
+	 * Empty all entries, discarding the bits they hold.
+	 */
+	MMINLINE void
+	clear()
+	{
+		for (uintptr_t index = 0; index < MARK_MAP_CACHE_ENTRIES; index++) {
+			_entries[index].slotIndex = 0;
+			_entries[index].markBits = 0;
+			_entries[index].scanBits = 0;
+		}
+	}
+
+	MM_MarkMapCache()
+	{
+		clear();
+	}
+};
+
+#endif /* MARKMAPCACHE_HPP_ */
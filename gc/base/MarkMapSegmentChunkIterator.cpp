@@ -46,6 +46,11 @@ GC_MarkMapSegmentChunkIterator::nextChunk(MM_HeapMap *markMap, UDATA **base, UDA
 		_markedObjectIterator.reset(markMap, _nextChunkBase, chunkTop);
 		omrobjectptr_t firstObject = _markedObjectIterator.nextObject();
 
+		if (_nextChunkBase == _segmentBase) {
+			/* The first chunk starts at the base of the segment, so objects ahead of the first marked object
+			 * (ie. allocated since the last mark) are walked as well */
+			firstObject = (omrobjectptr_t)_segmentBase;
+		}
 		_nextChunkBase = chunkTop;
 
 		if (firstObject != NULL) {
@@ -39,8 +39,9 @@ class MM_HeapMap;
 
 /**
  * Iterate over chunks of an area of memory by splitting the extent into even size chunks,
- * then using the mark map to find the first object in each chunk.
- * @note the mark map must be valid in order to use this iterator
+ * then using the mark map to find the first object in each chunk. The first chunk always starts at the
+ * base of the area.
+ * @note the mark map must be valid in order to split the area into more than one chunk
  * @ingroup GC_Base
  */
 class GC_MarkMapSegmentChunkIterator
@@ -51,6 +52,7 @@ private:
 	UDATA _segmentBytesRemaining;
 	MM_HeapMapIterator _markedObjectIterator;
 	UDATA *_nextChunkBase;
+	UDATA *_segmentBase; /**< the base of the area, where the first chunk starts */
 
 public:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
@@ -60,7 +62,8 @@ public:
 		_chunkSize(chunkSize),
 		_segmentBytesRemaining((UDATA)highAddress - (UDATA)lowAddress),
 		_markedObjectIterator(extensions),
-		_nextChunkBase((UDATA *)lowAddress)
+		_nextChunkBase((UDATA *)lowAddress),
+		_segmentBase((UDATA *)lowAddress)
 	{};
 
 	/**
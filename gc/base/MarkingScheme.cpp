@@ -26,6 +26,7 @@
 
 #include <string.h>
 
+#include "Bits.hpp"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -293,6 +294,8 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
 	if (NULL != objectScanner) {
 		bool isLeafSlot = false;
+		bool useMarkMapCache = _extensions->markMapCache;
+		MM_ConcurrentEvacuator *evacuator = getActiveEvacuator();
 		GC_SlotObject *slotObject;
 #if defined(OMR_GC_LEAF_BITS)
 		while (NULL != (slotObject = objectScanner->getNextSlot(isLeafSlot))) {
@@ -300,13 +303,61 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 		while (NULL != (slotObject = objectScanner->getNextSlot())) {
 #endif /* OMR_GC_LEAF_BITS */
 			fixupForwardedSlot(slotObject);
+			fixupEvacuatedSlot(env, evacuator, slotObject);
 
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			if (useMarkMapCache) {
+				cachedMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			} else {
+				inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			}
 		}
 	}
 	return sizeToDo;
 }
 
+void
+MM_MarkingScheme::flushMarkMapCacheEntry(MM_EnvironmentBase *env, MM_MarkMapCache::Entry *entry)
+{
+	uintptr_t slotIndex = entry->slotIndex;
+	uintptr_t markBits = entry->markBits;
+
+	/* Skip the atomic update if other threads have already published all of the bits */
+	uintptr_t oldValue = _markMap->getSlot(slotIndex);
+	if (markBits != (oldValue & markBits)) {
+		oldValue = _markMap->atomicSetSlot(slotIndex, markBits);
+		env->_markStats._markMapCacheFlushes += 1;
+	}
+	env->_markStats._markMapCacheBits += MM_Bits::populationCount(markBits);
+
+	uintptr_t markedBits = markBits & ~oldValue;
+	if (0 != markedBits) {
+		env->_markStats._objectsMarked += MM_Bits::populationCount(markedBits);
+
+		uintptr_t scanBits = markedBits & entry->scanBits;
+		uintptr_t firstCell = _markMap->getFirstCellByMarkSlotIndex(slotIndex);
+		uintptr_t objectGrain = _markMap->getObjectGrain();
+		while (0 != scanBits) {
+			uintptr_t bitIndex = MM_Bits::leadingZeroes(scanBits);
+			env->_workStack.push(env, (void *)(firstCell + (bitIndex * objectGrain)));
+			scanBits &= (scanBits - 1);
+		}
+	}
+
+	entry->markBits = 0;
+	entry->scanBits = 0;
+}
+
+void
+MM_MarkingScheme::flushMarkMapCache(MM_EnvironmentBase *env)
+{
+	for (uintptr_t index = 0; index < MARK_MAP_CACHE_ENTRIES; index++) {
+		MM_MarkMapCache::Entry *entry = &env->_markMapCache._entries[index];
+		if (0 != entry->markBits) {
+			flushMarkMapCacheEntry(env, entry);
+		}
+	}
+}
+
 
 /**
  * Scan until there are no more work packets to be processed.
@@ -316,9 +367,57 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	uintptr_t prefetchDepth = _extensions->markingPrefetchDepth;
+	if (0 != prefetchDepth) {
+		completeScanWithPrefetch(env, prefetchDepth);
+		return;
+	}
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+		while (NULL != (objectPtr = popObjectToScan(env))) {
+			env->_markStats._bytesScanned += scanObject(env, objectPtr);
+			env->_markStats._objectsScanned += 1;
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
+
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDepth)
+{
+	Assert_MM_true(prefetchDepth <= MAXIMUM_MARKING_PREFETCH_DEPTH);
+	omrobjectptr_t prefetchRing[MAXIMUM_MARKING_PREFETCH_DEPTH];
+	uintptr_t ringHead = 0;
+	uintptr_t ringCount = 0;
+
+	do {
+		while (true) {
+			omrobjectptr_t objectPtr = NULL;
+			/* Top up the ring without waiting: a thread must never block in pop() (and possibly
+			 * be counted as out of work) while it still holds unscanned objects in its ring.
+			 */
+			while ((ringCount < prefetchDepth) && (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env)))) {
+				OMR_GC_PREFETCH_OBJECT(objectPtr);
+				uintptr_t ringTail = ringHead + ringCount;
+				if (ringTail >= prefetchDepth) {
+					ringTail -= prefetchDepth;
+				}
+				prefetchRing[ringTail] = objectPtr;
+				ringCount += 1;
+			}
+
+			if (0 != ringCount) {
+				objectPtr = prefetchRing[ringHead];
+				ringHead += 1;
+				if (ringHead == prefetchDepth) {
+					ringHead = 0;
+				}
+				ringCount -= 1;
+			} else if (NULL == (objectPtr = popObjectToScan(env))) {
+				/* all threads are out of work */
+				break;
+			}
+
 			env->_markStats._bytesScanned += scanObject(env, objectPtr);
 			env->_markStats._objectsScanned += 1;
 		}
@@ -28,6 +28,9 @@
 #include "omrgcconsts.h"
 
 #include "BaseVirtual.hpp"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentEvacuator.hpp"
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -94,6 +97,81 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan() when marking prefetch is enabled.
+	 * Popped objects are prefetched into a ring of prefetchDepth entries and scanned once they reach
+	 * the head of the ring, giving the cache line holding each object time to arrive before its
+	 * slots are read.
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDepth);
+
+	/**
+	 * Private internal. Called exclusively from scanObject() when the mark map cache is enabled.
+	 * The mark bit is collected in the calling thread's mark map cache instead of being set in the mark map,
+	 * and the object is only pushed to the work stack once the bit is published by flushMarkMapCacheEntry().
+	 * @param[in] env calling thread environment
+	 * @param[in] objectPtr pointer to object to be marked (must not be NULL)
+	 * @param[in] leafType pass true if object is known to be a leaf (holds no object references)
+	 */
+	MMINLINE void
+	cachedMarkObjectNoCheck(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, bool leafType)
+	{
+		assertSaneObjectPtr(env, objectPtr);
+
+		uintptr_t slotIndex = 0;
+		uintptr_t bitMask = 0;
+		_markMap->getSlotIndexAndMask(objectPtr, &slotIndex, &bitMask);
+
+		/* A plain read filters out objects whose mark is already published, without touching the cache */
+		if (0 != (_markMap->getSlot(slotIndex) & bitMask)) {
+			return;
+		}
+
+		MM_MarkMapCache::Entry *entry = env->_markMapCache.getEntry(slotIndex);
+		if (slotIndex != entry->slotIndex) {
+			if (0 != entry->markBits) {
+				flushMarkMapCacheEntry(env, entry);
+			}
+			entry->slotIndex = slotIndex;
+		}
+		entry->markBits |= bitMask;
+		if (!leafType) {
+			entry->scanBits |= bitMask;
+		}
+	}
+
+	/**
+	 * Publish the mark bits of a mark map cache entry with one atomic OR and empty the entry. Only the bits
+	 * which were not already set in the mark map are marks of the calling thread: their objects are counted
+	 * and, unless leaves, pushed to the work stack. Any other bit was set by another thread, which also
+	 * pushed its object, so every object is still pushed exactly once.
+	 */
+	void flushMarkMapCacheEntry(MM_EnvironmentBase *env, MM_MarkMapCache::Entry *entry);
+
+	/**
+	 * Publish all entries of the calling thread's mark map cache.
+	 */
+	void flushMarkMapCache(MM_EnvironmentBase *env);
+
+	/**
+	 * Private internal. Pop the next object for completeScan() to scan, waiting for the other threads if
+	 * there is none. With the mark map cache enabled, the cache is flushed before waiting: the objects it
+	 * holds may be the only work left, and must be visible when the threads agree that marking is complete.
+	 * @return the object, or NULL if all threads are out of work
+	 */
+	MMINLINE omrobjectptr_t
+	popObjectToScan(MM_EnvironmentBase *env)
+	{
+		if (_extensions->markMapCache) {
+			omrobjectptr_t objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+			if (NULL != objectPtr) {
+				return objectPtr;
+			}
+			flushMarkMapCache(env);
+		}
+		return (omrobjectptr_t)env->_workStack.pop(env);
+	}
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -230,7 +308,7 @@ public:
 	/**
 	 * This is the marking workhorse, which burns down the backlog of work packets that have accumulated
 	 * on the global work stack during marking. It calls scanObject() for every object in the work stack 
-	 * until the work stack is empty.
+	 * until the work stack is empty. When markingPrefetchDepth is set, objects are prefetched that many entries ahead of the scan.
 	 */
 	void completeScan(MM_EnvironmentBase *env);
 	
@@ -253,6 +331,7 @@ public:
 		GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, reason, &sizeToDo);
 		if (NULL != objectScanner) {
 			bool isLeafSlot = false;
+			MM_ConcurrentEvacuator *evacuator = getActiveEvacuator();
 			GC_SlotObject *slotObject;
 #if defined(OMR_GC_LEAF_BITS)
 			while (NULL != (slotObject = objectScanner->getNextSlot(isLeafSlot))) {
@@ -260,6 +339,7 @@ public:
 			while (NULL != (slotObject = objectScanner->getNextSlot())) {
 #endif /* OMR_GC_LEAF_BITS */
 				fixupForwardedSlot(slotObject);
+				fixupEvacuatedSlot(env, evacuator, slotObject);
 
 				/* with concurrentMark mutator may NULL the slot so must fetch and check here */
 				inlineMarkObject(env, slotObject->readReferenceFromSlot(), isLeafSlot);
@@ -321,6 +401,38 @@ public:
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */ 			
 	}
 
+	/**
+	 * Return the concurrent evacuator if it has an active evacuation set, NULL otherwise. Scanning loops
+	 * fetch it once per object and pass it to fixupEvacuatedSlot() for each slot.
+	 */
+	MMINLINE MM_ConcurrentEvacuator *
+	getActiveEvacuator()
+	{
+		MM_ConcurrentEvacuator *evacuator = NULL;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if ((NULL != _extensions->concurrentEvacuator) && _extensions->concurrentEvacuator->isEvacuationActive()) {
+			evacuator = _extensions->concurrentEvacuator;
+		}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+		return evacuator;
+	}
+
+	/**
+	 * Heal a slot referring to an object in a concurrent evacuation area, copying the object if that has
+	 * not happened yet. Marking heals every slot it scans, so once marking is complete no live reference
+	 * into the evacuation areas remains.
+	 * @param evacuator the evacuator returned by getActiveEvacuator(), or NULL if no evacuation is active
+	 */
+	MMINLINE void
+	fixupEvacuatedSlot(MM_EnvironmentBase *env, MM_ConcurrentEvacuator *evacuator, GC_SlotObject *slotObject)
+	{
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if (NULL != evacuator) {
+			evacuator->fixupSlot(env, slotObject);
+		}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+	}
+
 	/**
 	 * Create a MarkingScheme object.
 	 */
@@ -0,0 +1,359 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "ModronAssertions.h"
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMemorySubSpaceIterator.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelDispatcher.hpp"
+
+#include "MemoryMaintenanceThread.hpp"
+
+MM_MemoryMaintenanceThread::MM_MemoryMaintenanceThread(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _maintenanceMutex(NULL)
+	, _threadState(STATE_ERROR)
+	, _extensions(env->getExtensions())
+	, _pendingDecommitCount(0)
+	, _zeroingRequested(false)
+	, _burstStartTime(0)
+	, _burstBytes(0)
+	, _bytesDecommitted(0)
+	, _bytesZeroed(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+uintptr_t
+MM_MemoryMaintenanceThread::memory_maintenance_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	MM_MemoryMaintenanceThread *maintenanceThread = (MM_MemoryMaintenanceThread *)info;
+	/* jump into the thread procedure and wait for work.  This method will NOT return */
+	maintenanceThread->memoryMaintenanceThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_MemoryMaintenanceThread::memory_maintenance_thread_proc(void *info)
+{
+	MM_MemoryMaintenanceThread *maintenanceThread = (MM_MemoryMaintenanceThread *)info;
+	MM_GCExtensionsBase *extensions = maintenanceThread->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(memory_maintenance_thread_proc2, info,
+			((MM_ParallelDispatcher *)extensions->dispatcher)->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+bool
+MM_MemoryMaintenanceThread::initialize()
+{
+	bool success = true;
+	if (omrthread_monitor_init_with_name(&_maintenanceMutex, 0, "MM_MemoryMaintenanceThread::_maintenanceMutex")) {
+		success = false;
+	}
+
+	return success;
+}
+
+void
+MM_MemoryMaintenanceThread::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _maintenanceMutex) {
+		omrthread_monitor_destroy(_maintenanceMutex);
+		_maintenanceMutex = NULL;
+	}
+}
+
+bool
+MM_MemoryMaintenanceThread::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of this thread so that we eliminate any timing hole where it might notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_maintenanceMutex);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		memory_maintenance_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_maintenanceMutex);
+		}
+		success = (STATE_ERROR != _threadState);
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_maintenanceMutex);
+
+	return success;
+}
+
+void
+MM_MemoryMaintenanceThread::shutdown()
+{
+	if ((NULL != _maintenanceMutex) && (STATE_ERROR != _threadState)) {
+		/* tell the thread to shut down and then wait for it to exit */
+		omrthread_monitor_enter(_maintenanceMutex);
+		while (STATE_TERMINATED != _threadState) {
+			_threadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_maintenanceMutex);
+			omrthread_monitor_wait(_maintenanceMutex);
+		}
+		/* the memory is about to be released, but leave it as the collector asked for */
+		while (0 != _pendingDecommitCount) {
+			completeDecommit(0);
+		}
+		omrthread_monitor_exit(_maintenanceMutex);
+	}
+}
+
+bool
+MM_MemoryMaintenanceThread::queueDecommit(MM_MemoryHandle *handle, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	bool queued = false;
+
+	omrthread_monitor_enter(_maintenanceMutex);
+	if (((STATE_WAITING == _threadState) || (STATE_WORK_REQUESTED == _threadState) || (STATE_WORKING == _threadState))
+		&& (MEMORY_MAINTENANCE_PENDING_DECOMMITS > _pendingDecommitCount)
+	) {
+		PendingDecommit *pending = &_pendingDecommits[_pendingDecommitCount];
+		pending->handle = handle;
+		pending->base = address;
+		pending->top = (void *)((uintptr_t)address + size);
+		pending->lowValidAddress = lowValidAddress;
+		pending->highValidAddress = highValidAddress;
+		_pendingDecommitCount += 1;
+		if (STATE_WAITING == _threadState) {
+			_threadState = STATE_WORK_REQUESTED;
+			omrthread_monitor_notify(_maintenanceMutex);
+		}
+		queued = true;
+	}
+	omrthread_monitor_exit(_maintenanceMutex);
+
+	bool result = true;
+	if (!queued) {
+		result = _extensions->memoryManager->decommitMemory(handle, address, size, lowValidAddress, highValidAddress);
+	}
+	return result;
+}
+
+void
+MM_MemoryMaintenanceThread::completeOverlappingDecommits(void *address, uintptr_t size)
+{
+	omrthread_monitor_enter(_maintenanceMutex);
+	uintptr_t index = 0;
+	while (index < _pendingDecommitCount) {
+		PendingDecommit *pending = &_pendingDecommits[index];
+		/* decommits and commits are rounded to pages, so a range sharing a page with the commit must complete too */
+		uintptr_t pageSize = _extensions->memoryManager->getPageSize(pending->handle);
+		uintptr_t commitBase = (uintptr_t)address;
+		uintptr_t commitTop = (uintptr_t)address + size;
+		if (((uintptr_t)pending->base < (commitTop + pageSize)) && (commitBase < ((uintptr_t)pending->top + pageSize))) {
+			completeDecommit(index);
+		} else {
+			index += 1;
+		}
+	}
+	omrthread_monitor_exit(_maintenanceMutex);
+}
+
+void
+MM_MemoryMaintenanceThread::resume(MM_EnvironmentBase *env)
+{
+	/* the collection has rebuilt the free lists, so nothing in them is known to be zero anymore */
+	MM_HeapMemorySubSpaceIterator subSpaceIterator(_extensions->heap);
+	MM_MemorySubSpace *subSpace = NULL;
+	while (NULL != (subSpace = subSpaceIterator.nextSubSpace())) {
+		MM_MemoryPool *memoryPool = subSpace->getMemoryPool();
+		if (NULL != memoryPool) {
+			memoryPool->resetPreZeroedMemory();
+		}
+	}
+
+	omrthread_monitor_enter(_maintenanceMutex);
+	_zeroingRequested = true;
+	if (STATE_WAITING == _threadState) {
+		_threadState = STATE_WORK_REQUESTED;
+		omrthread_monitor_notify(_maintenanceMutex);
+	}
+	omrthread_monitor_exit(_maintenanceMutex);
+}
+
+void
+MM_MemoryMaintenanceThread::completeDecommit(uintptr_t index)
+{
+	Assert_MM_true(index < _pendingDecommitCount);
+	PendingDecommit *pending = &_pendingDecommits[index];
+	uintptr_t size = (uintptr_t)pending->top - (uintptr_t)pending->base;
+
+	_extensions->memoryManager->decommitMemory(pending->handle, pending->base, size, pending->lowValidAddress, pending->highValidAddress);
+	_bytesDecommitted += size;
+
+	_pendingDecommitCount -= 1;
+	memmove(pending, pending + 1, (_pendingDecommitCount - index) * sizeof(PendingDecommit));
+}
+
+uintptr_t
+MM_MemoryMaintenanceThread::decommitStep()
+{
+	PendingDecommit *pending = &_pendingDecommits[0];
+	uintptr_t size = (uintptr_t)pending->top - (uintptr_t)pending->base;
+	uintptr_t processed = size;
+
+	if (size > MEMORY_MAINTENANCE_STEP_SIZE) {
+		/* decommit the top pages of the range; the rest stays queued and keeps its low valid address */
+		uintptr_t pageSize = _extensions->memoryManager->getPageSize(pending->handle);
+		uintptr_t stepBase = MM_Math::roundToFloor(pageSize, (uintptr_t)pending->top - MEMORY_MAINTENANCE_STEP_SIZE);
+		if (stepBase > (uintptr_t)pending->base) {
+			processed = (uintptr_t)pending->top - stepBase;
+			_extensions->memoryManager->decommitMemory(pending->handle, (void *)stepBase, processed, NULL, pending->highValidAddress);
+			_bytesDecommitted += processed;
+			pending->top = (void *)stepBase;
+			return processed;
+		}
+	}
+
+	completeDecommit(0);
+	return processed;
+}
+
+uintptr_t
+MM_MemoryMaintenanceThread::zeroStep(MM_EnvironmentBase *env)
+{
+	uintptr_t zeroedBytes = 0;
+
+	MM_HeapMemorySubSpaceIterator subSpaceIterator(_extensions->heap);
+	MM_MemorySubSpace *subSpace = NULL;
+	while ((0 == zeroedBytes) && (NULL != (subSpace = subSpaceIterator.nextSubSpace()))) {
+		/* only memory TLHs may be carved from is worth zeroing (survivor space is refilled by the collector) */
+		if (subSpace->isAllocatable()) {
+			MM_MemoryPool *memoryPool = subSpace->getMemoryPool();
+			if (NULL != memoryPool) {
+				zeroedBytes = memoryPool->preZeroFreeMemory(env, MEMORY_MAINTENANCE_STEP_SIZE);
+			}
+		}
+	}
+	_bytesZeroed += zeroedBytes;
+
+	return zeroedBytes;
+}
+
+void
+MM_MemoryMaintenanceThread::throttle(uintptr_t bytes)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	_burstBytes += bytes;
+
+	uint64_t elapsedMillis = omrtime_hires_delta(_burstStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+	uint64_t budgetMillis = ((uint64_t)_burstBytes * 1000) / ((uint64_t)_extensions->memoryMaintenanceRate * 1024 * 1024);
+	if (budgetMillis > elapsedMillis) {
+		omrthread_monitor_wait_timed(_maintenanceMutex, (int64_t)(budgetMillis - elapsedMillis), 0);
+	}
+}
+
+void
+MM_MemoryMaintenanceThread::memoryMaintenanceThreadEntryPoint()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "Memory Maintenance", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_maintenanceMutex);
+	if (NULL == omrVMThread) {
+		/* we failed to attach so notify the creating thread that we should fail to start up */
+		_threadState = STATE_ERROR;
+		omrthread_monitor_notify(_maintenanceMutex);
+		omrthread_exit(_maintenanceMutex);
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	_threadState = STATE_WAITING;
+	omrthread_monitor_notify(_maintenanceMutex);
+
+	while (STATE_TERMINATION_REQUESTED != _threadState) {
+		if (STATE_WORK_REQUESTED == _threadState) {
+			_threadState = STATE_WORKING;
+			_burstStartTime = omrtime_hires_clock();
+			_burstBytes = 0;
+
+			while (STATE_WORKING == _threadState) {
+				bool idle = false;
+				uintptr_t processed = 0;
+				if (0 != _pendingDecommitCount) {
+					/* decommit with the monitor held, so that a commit of the same pages waits for it */
+					processed = decommitStep();
+				} else if (_zeroingRequested) {
+					_zeroingRequested = false;
+					omrthread_monitor_exit(_maintenanceMutex);
+
+					/* zeroing needs VM access, so that a collection (which rebuilds the free lists) waits for the step in hand */
+					env->acquireVMAccess();
+					processed = zeroStep(env);
+					env->releaseVMAccess();
+
+					omrthread_monitor_enter(_maintenanceMutex);
+					if (0 != processed) {
+						_zeroingRequested = true;
+					}
+				} else {
+					idle = true;
+				}
+
+				if (idle) {
+					if (STATE_WORKING == _threadState) {
+						_threadState = STATE_WAITING;
+					}
+				} else if (0 != processed) {
+					throttle(processed);
+				}
+			}
+		} else {
+			omrthread_monitor_wait(_maintenanceMutex);
+		}
+	}
+
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify(_maintenanceMutex);
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	omrthread_exit(_maintenanceMutex);
+}
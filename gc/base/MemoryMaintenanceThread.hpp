@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(MEMORYMAINTENANCETHREAD_HPP_)
+#define MEMORYMAINTENANCETHREAD_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_MemoryHandle;
+
+/* The number of bytes the memory maintenance thread decommits or zeroes between checks for other work. */
+#define MEMORY_MAINTENANCE_STEP_SIZE (256 * 1024)
+/* The number of decommits which may be queued before further ones are done synchronously. */
+#define MEMORY_MAINTENANCE_PENDING_DECOMMITS 16
+
+/**
+ * Background thread owned by the memory manager, taking page work out of the collection pause.
+ * Ranges released by heap contraction are queued by the collector and decommitted by the thread after the pause;
+ * a commit overlapping a queued range completes that decommit first, so the order of page operations is preserved.
+ * Once queued decommits are done, the thread zeroes free memory in the allocatable memory pools, from the top down,
+ * so that TLHs carved from it need not be cleared by the allocating thread.
+ * Both kinds of work are done in steps of MEMORY_MAINTENANCE_STEP_SIZE and limited to
+ * MM_GCExtensionsBase::memoryMaintenanceRate megabytes per second.
+ * @ingroup GC_Base
+ */
+class MM_MemoryMaintenanceThread : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	typedef enum MemoryMaintenanceThreadState
+	{
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_WORK_REQUESTED,
+		STATE_WORKING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} MemoryMaintenanceThreadState;
+
+	/**
+	 * A range released by a heap contraction, not decommitted yet.
+	 * The range shrinks from the top as the thread decommits it step by step.
+	 */
+	struct PendingDecommit {
+		MM_MemoryHandle *handle; /**< The virtual memory the range belongs to */
+		void *base; /**< The lowest address still to be decommitted */
+		void *top; /**< One byte past the highest address still to be decommitted */
+		void *lowValidAddress; /**< The end of the committed memory below the range, or NULL */
+		void *highValidAddress; /**< The start of the committed memory above the range, or NULL */
+	};
+
+	omrthread_monitor_t _maintenanceMutex; /**< Protects the thread state and the pending decommits, and is held while decommitting */
+	volatile MemoryMaintenanceThreadState _threadState; /**< The state of the background thread (protected by _maintenanceMutex) */
+	MM_GCExtensionsBase *_extensions; /**< The GC extensions */
+	PendingDecommit _pendingDecommits[MEMORY_MAINTENANCE_PENDING_DECOMMITS]; /**< Queued decommits, oldest first (protected by _maintenanceMutex) */
+	uintptr_t _pendingDecommitCount; /**< Number of used entries in _pendingDecommits (protected by _maintenanceMutex) */
+	bool _zeroingRequested; /**< True if free memory may be left to zero since the last collection (protected by _maintenanceMutex) */
+	uint64_t _burstStartTime; /**< Time the current burst of work started, used for rate limiting */
+	uintptr_t _burstBytes; /**< Bytes decommitted or zeroed since _burstStartTime */
+	uintptr_t _bytesDecommitted; /**< Total bytes decommitted in the background */
+	uintptr_t _bytesZeroed; /**< Total bytes pre-zeroed in the background */
+
+/*
+ * Function members
+ */
+public:
+	/**
+	 * Early initialize: monitor creation
+	 */
+	bool initialize();
+
+	/**
+	 * Teardown resources created by initialize
+	 */
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Start up the thread, waiting until it reports success.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Shut down the thread, waiting until it has detached, and complete any decommit still queued.
+	 */
+	void shutdown();
+
+	/**
+	 * Queue the decommit of a range released by a heap contraction. If the queue is full the range is decommitted
+	 * synchronously. The arguments are those of MM_MemoryManager::decommitMemory().
+	 * @return true if the range was queued or successfully decommitted
+	 */
+	bool queueDecommit(MM_MemoryHandle *handle, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Complete, synchronously, any queued decommit touching the pages of a range about to be committed.
+	 * @param address the start of the range to be committed
+	 * @param size the size of the range to be committed
+	 */
+	void completeOverlappingDecommits(void *address, uintptr_t size);
+
+	/**
+	 * Ask the thread to pre-zero the free memory rebuilt by the collection that just completed, after any queued decommit.
+	 * Called at the end of a collection, with exclusive VM access: the zeroed boundaries of all memory pools are reset first.
+	 */
+	void resume(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getBytesDecommitted() { return _bytesDecommitted; }
+	MMINLINE uintptr_t getBytesZeroed() { return _bytesZeroed; }
+
+	MM_MemoryMaintenanceThread(MM_EnvironmentBase *env);
+protected:
+private:
+	/**
+	 * Decommit the top step of the oldest queued range, removing it from the queue once it is done.
+	 * Called with _maintenanceMutex held.
+	 * @return the number of bytes of address range processed
+	 */
+	uintptr_t decommitStep();
+
+	/**
+	 * Decommit what is left of a queued range in one go, and remove it from the queue.
+	 * Called with _maintenanceMutex held.
+	 * @param index the index of the range in _pendingDecommits
+	 */
+	void completeDecommit(uintptr_t index);
+
+	/**
+	 * Zero one step of free memory in the first allocatable memory pool which has some left to zero.
+	 * Called with VM access, without _maintenanceMutex held.
+	 * @return the number of bytes zeroed, 0 if all the free memory is zeroed
+	 */
+	uintptr_t zeroStep(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait, if the work done in the current burst is ahead of MM_GCExtensionsBase::memoryMaintenanceRate.
+	 * Called with _maintenanceMutex held; the wait is interrupted by any notification.
+	 * @param bytes the number of bytes just processed
+	 */
+	void throttle(uintptr_t bytes);
+
+	/**
+	 * This is the method called by the forked thread. The function doesn't return.
+	 */
+	void memoryMaintenanceThreadEntryPoint();
+
+	/**
+	 * This is a helper function, used as a parameter to sig_protect
+	 */
+	static uintptr_t memory_maintenance_thread_proc2(OMRPortLibrary* portLib, void *info);
+
+	/**
+	 * This is a helper function, used as a parameter to omrthread_create
+	 */
+	static int J9THREAD_PROC memory_maintenance_thread_proc(void *info);
+};
+
+#endif /* MEMORYMAINTENANCETHREAD_HPP_ */
@@ -49,6 +49,7 @@ MM_MemoryManager::newInstance(MM_EnvironmentBase* env)
 void
 MM_MemoryManager::kill(MM_EnvironmentBase* env)
 {
+	_maintenanceThread.tearDown(env);
 	env->getForge()->free(this);
 }
 
@@ -117,6 +118,11 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
+	if (MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE != extensions->heapHugePages) {
+		/* heap alignment is already a multiple of the huge page sized regions (see MM_Configuration::initializeRegionSize) */
+		options |= OMRPORT_VMEM_ADVISE_HUGEPAGE;
+	}
+
 	if (NULL == ceiling) {
 		instance = MM_VirtualMemory::newInstance(env, heapAlignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress,
 												 ceiling, mode, options, memoryCategory);
@@ -524,6 +530,10 @@ MM_MemoryManager::commitMemory(MM_MemoryHandle* handle, void* address, uintptr_t
 	Assert_MM_true(NULL != handle);
 	MM_VirtualMemory* memory = handle->getVirtualMemory();
 	Assert_MM_true(NULL != memory);
+	if (_maintenanceThreadStarted) {
+		/* a decommit of these pages still queued must not be done after they are committed again */
+		_maintenanceThread.completeOverlappingDecommits(address, size);
+	}
 	return memory->commitMemory(address, size);
 }
 
@@ -536,6 +546,36 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+bool
+MM_MemoryManager::decommitMemoryInBackground(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress)
+{
+	bool result = false;
+	if (_maintenanceThreadStarted) {
+		result = _maintenanceThread.queueDecommit(handle, address, size, lowValidAddress, highValidAddress);
+	} else {
+		result = decommitMemory(handle, address, size, lowValidAddress, highValidAddress);
+	}
+	return result;
+}
+
+bool
+MM_MemoryManager::startMemoryMaintenance()
+{
+	if (!_maintenanceThreadStarted) {
+		_maintenanceThreadStarted = _maintenanceThread.initialize() && _maintenanceThread.startup();
+	}
+	return _maintenanceThreadStarted;
+}
+
+void
+MM_MemoryManager::stopMemoryMaintenance()
+{
+	if (_maintenanceThreadStarted) {
+		_maintenanceThreadStarted = false;
+		_maintenanceThread.shutdown();
+	}
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
@@ -28,6 +28,7 @@
 
 #include "BaseNonVirtual.hpp"
 #include "MemoryHandle.hpp"
+#include "MemoryMaintenanceThread.hpp"
 #include "VirtualMemory.hpp"
 
 class MM_EnvironmentBase;
@@ -38,6 +39,8 @@ class MM_MemoryManager : public MM_BaseNonVirtual {
 	 */
 private:
 	MM_MemoryHandle _preAllocated; /**< stored preallocated memory parameters in case of over-allocation */
+	MM_MemoryMaintenanceThread _maintenanceThread; /**< Background thread decommitting contracted memory and pre-zeroing free memory */
+	bool _maintenanceThreadStarted; /**< True if the memory maintenance thread has been started */
 
 protected:
 public:
@@ -114,6 +117,8 @@ protected:
 
 	MM_MemoryManager(MM_EnvironmentBase* env)
 		: _preAllocated()
+		, _maintenanceThread(env)
+		, _maintenanceThreadStarted(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -191,6 +196,55 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Decommit memory for range for specified virtual memory instance once the current pause is over.
+	 * The decommit is handed to the memory maintenance thread if it is running, and done synchronously otherwise.
+	 * A later commit of the same range completes the decommit first.
+	 *
+	 * @param pointer to memory handle
+	 * @param address start address of memory should be decommitted
+	 * @param size size of memory should be decommitted
+	 * @param lowValidAddress
+	 * @param highValidAddress
+	 * @return true if the decommit was queued or succeeded
+	 */
+	bool decommitMemoryInBackground(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+
+	/**
+	 * Start the memory maintenance thread (see MM_GCExtensionsBase::memoryMaintenance)
+	 *
+	 * @return true if the thread has been started
+	 */
+	bool startMemoryMaintenance();
+
+	/**
+	 * Stop the memory maintenance thread, if it has been started, completing any decommit it has queued
+	 */
+	void stopMemoryMaintenance();
+
+	/**
+	 * Let the memory maintenance thread, if it has been started, pre-zero the free memory rebuilt by a collection.
+	 * Must be called at the end of every collection, with exclusive VM access.
+	 *
+	 * @param env environment
+	 */
+	void resumeMemoryMaintenance(MM_EnvironmentBase* env)
+	{
+		if (_maintenanceThreadStarted) {
+			_maintenanceThread.resume(env);
+		}
+	}
+
+	/**
+	 * @return the total number of bytes decommitted by the memory maintenance thread
+	 */
+	MMINLINE uintptr_t getBytesDecommittedInBackground() { return _maintenanceThread.getBytesDecommitted(); }
+
+	/**
+	 * @return the total number of bytes of free memory zeroed by the memory maintenance thread
+	 */
+	MMINLINE uintptr_t getBytesPreZeroed() { return _maintenanceThread.getBytesZeroed(); }
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -265,6 +319,18 @@ public:
 		return memory->getPageFlags();
 	};
 
+	/**
+	 * Return the number of bytes of the virtual memory object currently backed by huge pages
+	 *
+	 * @param handle pointer to memory handle
+	 * @return huge page backed size, 0 if it can not be determined
+	 */
+	MMINLINE uintptr_t getHugePageBackedSize(MM_MemoryHandle* handle)
+	{
+		MM_VirtualMemory* memory = handle->getVirtualMemory();
+		return memory->getHugePageBackedSize();
+	};
+
 	/**
 	 * Return the maximum size of the heap.
 	 *
@@ -249,6 +249,26 @@ public:
 	
 	virtual void postProcess(MM_EnvironmentBase *env, Cause cause) {};
 
+	/**
+	 * Refill the lock-free quick-lists of the pool, if it has any, from its free list.
+	 * Called with the world stopped once a global collection has rebuilt the free list.
+	 */
+	virtual void populateFreeEntryQuickLists(MM_EnvironmentBase *env) {};
+
+	/**
+	 * Zero part of the free memory of the pool, from the top down, so that TLHs carved from it need not be cleared.
+	 * Called by the memory maintenance thread with VM access.
+	 * @param maximumBytes the largest number of bytes to zero
+	 * @return the number of bytes of free memory processed, 0 if all of it is zeroed already
+	 */
+	virtual uintptr_t preZeroFreeMemory(MM_EnvironmentBase *env, uintptr_t maximumBytes) { return 0; }
+
+	/**
+	 * Forget which free memory has been zeroed, because the free list has been rebuilt.
+	 * Called with exclusive VM access at the end of every collection.
+	 */
+	virtual void resetPreZeroedMemory() {};
+
 	virtual bool completeFreelistRebuildRequired(MM_EnvironmentBase *env);
 
 	/* TODO: These methods imply knowledge of a "free list" for managing memory
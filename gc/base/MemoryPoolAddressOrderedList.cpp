@@ -41,6 +41,7 @@
 #include "LargeObjectAllocateStats.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 
 /**
  * Create and initialize a new instance of the receiver.
@@ -409,7 +410,7 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 MMINLINE void *
 MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
 {
-	MM_HeapLinkedFreeHeader  *currentFreeEntry, *previousFreeEntry, *recycleEntry;
+	MM_HeapLinkedFreeHeader  *currentFreeEntry, *previousFreeEntry, *nextFreeEntry, *recycleEntry;
 	uintptr_t candidateHintSize;
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
@@ -488,9 +489,11 @@ retry:
 
 	addrBase = (void *)currentFreeEntry;
 	recycleEntry = (MM_HeapLinkedFreeHeader *)(((uint8_t *)currentFreeEntry) + sizeInBytesRequired);
+	nextFreeEntry = currentFreeEntry->getNext();
 
-	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext())) {
+	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, nextFreeEntry)) {
 		updateHint(currentFreeEntry, recycleEntry);
+		updatePreZeroEntries(currentFreeEntry, recycleEntry, nextFreeEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		/* Adjust the free memory size and count */
@@ -502,6 +505,7 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		updatePreZeroEntries(currentFreeEntry, NULL, nextFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -529,7 +533,10 @@ fail_allocate:
 void *
 MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription)
 {
-	void * addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
+	void * addr = allocateFromQuickLists(env, allocDescription);
+	if (NULL == addr) {
+		addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
+	}
 
 	if (addr != NULL) {
 #if defined(OMR_GC_ALLOCATION_TAX)
@@ -545,6 +552,27 @@ MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_All
 	return addr;
 }
 
+void *
+MM_MemoryPoolAddressOrderedList::allocateQuickListChunk(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+{
+	return internalAllocate(env, sizeInBytesRequired, false, NULL);
+}
+
+void *
+MM_MemoryPoolAddressOrderedList::allocateReservationChunk(MM_EnvironmentBase *env, uintptr_t objectSize, uintptr_t objectCount)
+{
+	_heapLock.acquire();
+	void *addr = internalAllocate(env, objectSize * objectCount, false, NULL);
+	if (NULL != addr) {
+		/* the chunk was counted as a single allocation */
+		_allocCount += objectCount - 1;
+		_largeObjectAllocateStats->allocateObject(objectSize, objectCount);
+	}
+	_heapLock.release();
+
+	return addr;
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired)
 {
@@ -625,18 +653,21 @@ retry:
 		/* Recycle the remaining entry back onto the free list (if applicable) */
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+			updatePreZeroEntries(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop, entryNext);
 		} else {
 			/* Adjust the free memory size and count */
 			_freeMemorySize -= recycleEntrySize;
 			_freeEntryCount -= 1;
 
 			_allocDiscardedBytes += recycleEntrySize;
+			updatePreZeroEntries(freeEntry, NULL, entryNext);
 		}
 	} else {
 		/* If not recycling just update the free list pointer to the next free entry */
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
+		updatePreZeroEntries(freeEntry, NULL, entryNext);
 	}
 
 	if (lockingRequired) {
@@ -659,10 +690,15 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_Allocat
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
 {
 	void *tlhBase = NULL;
+	bool preZeroed = false;
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
+	/* the zeroed ranges must be checked under the same lock the TLH is carved with, as the memory maintenance thread moves them */
+	_heapLock.acquire();
+	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, false, _largeObjectAllocateStats)) {
 		tlhBase = addrBase;
+		preZeroed = (addrTop <= _preZeroedTop) || ((addrBase >= _preZeroRangeBase) && (addrTop <= _preZeroRangeTop));
 	}
+	_heapLock.release();
 
 	if (NULL != tlhBase) {
 #if defined(OMR_GC_ALLOCATION_TAX)
@@ -672,6 +708,7 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_Allocat
 #endif  /* OMR_GC_ALLOCATION_TAX */
 
 		allocDescription->setTLHAllocation(true);
+		allocDescription->setPreZeroedTLH(preZeroed);
 		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
 		allocDescription->setMemoryPool(this);
 	}
@@ -707,12 +744,122 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 
 	clearHints();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
+	_quickLists.clear();
 
 	_lastFreeEntry = NULL;
+	resetPreZeroedMemory();
 	resetFreeEntryAllocateStats(_largeObjectAllocateStats);
 	resetLargeObjectAllocateStats();
 }
 
+uintptr_t
+MM_MemoryPoolAddressOrderedList::preZeroFreeMemory(MM_EnvironmentBase *env, uintptr_t maximumBytes)
+{
+	uintptr_t zeroedBytes = 0;
+
+	_heapLock.acquire();
+
+	/* Resume the walk where the previous step stopped (the list is address ordered, so zeroing proceeds bottom up) */
+	MM_HeapLinkedFreeHeader *candidateEntry = (NULL != _preZeroEntry) ? _preZeroEntry : _heapFreeList;
+	while ((NULL != candidateEntry) && (0 == zeroedBytes)) {
+		uintptr_t entryBase = (uintptr_t)candidateEntry;
+		uintptr_t entryTop = (uintptr_t)candidateEntry->afterEnd();
+		if (entryTop > (uintptr_t)_preZeroedTop) {
+			_preZeroEntry = candidateEntry;
+
+			/* Zero the top of what is left of the entry, never its header */
+			uintptr_t zeroTop = entryTop;
+			if ((entryTop <= (uintptr_t)_preZeroRangeTop) && (entryTop > (uintptr_t)_preZeroRangeBase)) {
+				/* an earlier step already zeroed the top of this entry */
+				zeroTop = OMR_MAX((uintptr_t)_preZeroRangeBase, entryBase);
+			}
+			uintptr_t zeroBase = entryBase + _minimumFreeEntrySize;
+			if ((zeroTop > zeroBase) && ((zeroTop - zeroBase) > maximumBytes)) {
+				zeroBase = MM_Math::roundToCeiling(env->getObjectAlignmentInBytes(), zeroTop - maximumBytes);
+			}
+
+			if (zeroTop > zeroBase) {
+				/* Cut the range off the entry so it can not be allocated while it is zeroed without the lock */
+				uintptr_t reservedSize = entryTop - zeroBase;
+				_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(candidateEntry->getSize());
+				candidateEntry->setSize(zeroBase - entryBase);
+				_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(candidateEntry->getSize());
+				_freeMemorySize -= reservedSize;
+				_preZeroReservedEntry = candidateEntry;
+				_heapLock.release();
+
+				OMRZeroMemory((void *)zeroBase, zeroTop - zeroBase);
+
+				_heapLock.acquire();
+				returnPreZeroedChunk((void *)zeroBase, (void *)entryTop);
+				zeroedBytes = zeroTop - zeroBase;
+				/* the entry may have been consumed while the lock was released */
+				break;
+			} else {
+				/* What is left below the zeroed top is too small to be cut off, so zero it in place */
+				uintptr_t entryBody = entryBase + sizeof(MM_HeapLinkedFreeHeader);
+				if (zeroTop > entryBody) {
+					OMRZeroMemory((void *)entryBody, zeroTop - entryBody);
+					zeroedBytes = zeroTop - entryBody;
+				}
+				_preZeroedTop = (void *)entryTop;
+				_preZeroEntry = candidateEntry->getNext();
+				_preZeroRangeBase = NULL;
+				_preZeroRangeTop = NULL;
+			}
+		}
+		candidateEntry = candidateEntry->getNext();
+	}
+
+	_heapLock.release();
+
+	return zeroedBytes;
+}
+
+/**
+ * Give back a chunk cut off a free entry by preZeroFreeMemory() once it has been zeroed.
+ * The chunk extends the entry it was cut from if allocations left that entry in place, or
+ * goes back onto the free list as an entry of its own otherwise.
+ * @note the caller must hold _heapLock
+ */
+void
+MM_MemoryPoolAddressOrderedList::returnPreZeroedChunk(void *chunkBase, void *chunkTop)
+{
+	MM_HeapLinkedFreeHeader *reservedEntry = _preZeroReservedEntry;
+	uintptr_t chunkSize = (uintptr_t)chunkTop - (uintptr_t)chunkBase;
+	_preZeroReservedEntry = NULL;
+
+	if ((NULL != reservedEntry) && ((void *)reservedEntry->afterEnd() == chunkBase)) {
+		_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(reservedEntry->getSize());
+		reservedEntry->expandSize(chunkSize);
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(reservedEntry->getSize());
+		_freeMemorySize += chunkSize;
+		/* the entry grew, so hints past it may now skip a fitting entry */
+		updateHintsBeyondEntry(reservedEntry);
+	} else {
+		MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+		MM_HeapLinkedFreeHeader *nextFreeEntry = _heapFreeList;
+		while ((NULL != nextFreeEntry) && ((void *)nextFreeEntry < chunkBase)) {
+			previousFreeEntry = nextFreeEntry;
+			nextFreeEntry = nextFreeEntry->getNext();
+		}
+		if (!recycleHeapChunk(chunkBase, chunkTop, previousFreeEntry, nextFreeEntry)) {
+			/* too small to be a free entry, it is reclaimed by the next collection */
+			return;
+		}
+		_freeMemorySize += chunkSize;
+		_freeEntryCount += 1;
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(chunkSize);
+		updateHintsBeyondEntry((MM_HeapLinkedFreeHeader *)chunkBase);
+		if ((NULL != _preZeroEntry) && ((void *)_preZeroEntry > chunkBase)) {
+			_preZeroEntry = (MM_HeapLinkedFreeHeader *)chunkBase;
+		}
+	}
+
+	_preZeroRangeBase = chunkBase;
+	_preZeroRangeTop = chunkTop;
+}
+
 /**
  * As opposed to reset, which will empty out, this will fill out as if everything is free.
  * Returns the freelist entry created at the end of the given region
@@ -792,6 +939,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	resetPreZeroedMemory();
+
 	/* Handle the entries that are too small to make the free list */
 	if(expandSize < _minimumFreeEntrySize) {
 		abandonHeapChunk(lowAddress, highAddress);
@@ -899,6 +1048,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	/* the zeroing cursor may point at an entry about to be removed */
+	resetPreZeroedMemory();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -986,6 +1138,7 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
+	resetPreZeroedMemory();
 	while (currentFreeEntry != NULL) {
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
 		currentFreeEntry = currentFreeEntry->getNext();
@@ -1083,6 +1236,9 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* the zeroing cursor may point at an entry about to be removed */
+	resetPreZeroedMemory();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1437,6 +1593,7 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 {
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	resetPreZeroedMemory();
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1486,6 +1643,12 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	_heapLock.acquire();
 
+	void *preZeroedFrontier = (NULL != _preZeroEntry) ? (void *)_preZeroEntry->afterEnd() : _preZeroedTop;
+	if ((chunkBase < preZeroedFrontier) || ((chunkBase < _preZeroRangeTop) && (chunkTop > _preZeroRangeBase))) {
+		/* the returned chunk has been handed out, so its contents can no longer be assumed zero */
+		resetPreZeroedMemory();
+	}
+
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
@@ -1655,6 +1818,15 @@ MM_MemoryPoolAddressOrderedList::appendCollectorLargeAllocateStats()
 	_largeObjectCollectorAllocateStats = _largeObjectAllocateStats;
 }
 
+/**
+ * Free memory held by the quick-lists is carved out of the free list, but is still free.
+ */
+uintptr_t
+MM_MemoryPoolAddressOrderedList::getActualFreeMemorySize()
+{
+	return _freeMemorySize + _quickLists.getFreeBytes();
+}
+
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
 MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
@@ -51,6 +51,11 @@ private:
 	/* Basic free list support */
 	MM_LightweightNonReentrantLock _heapLock;
 	MM_HeapLinkedFreeHeader *_heapFreeList;
+	void *_preZeroedTop; /**< Free memory below this address is zero, but for the free list header at the start of each free entry (protected by _heapLock) */
+	MM_HeapLinkedFreeHeader *_preZeroEntry; /**< Lowest free entry not completely zeroed yet, where the next zeroing step resumes (NULL to walk from the head of the list) */
+	void *_preZeroRangeBase; /**< Base of the range most recently zeroed above _preZeroedTop; free memory in the range is zero, but for free list headers */
+	void *_preZeroRangeTop; /**< Top of the range most recently zeroed above _preZeroedTop */
+	MM_HeapLinkedFreeHeader *_preZeroReservedEntry; /**< Free entry whose top is being zeroed outside of the lock, followed through allocations carving it (NULL once consumed) */
 	
 	/* Hint support */
 	struct J9ModronAllocateHint* _hintActive;
@@ -77,8 +82,27 @@ private:
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
 	bool recycleHeapChunk(void *addrBase, void *addrTop, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry);	
+	void returnPreZeroedChunk(void *chunkBase, void *chunkTop);
+
+	/**
+	 * Follow the zeroing cursor and reservation when an allocation replaces a free entry by what is left of it.
+	 * @param oldFreeEntry the entry the allocation was carved from
+	 * @param newFreeEntry the recycled remainder of the entry, or NULL if nothing of it is left on the free list
+	 * @param nextFreeEntry the entry following oldFreeEntry on the free list
+	 */
+	MMINLINE void updatePreZeroEntries(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry)
+	{
+		if (oldFreeEntry == _preZeroEntry) {
+			_preZeroEntry = (NULL != newFreeEntry) ? newFreeEntry : nextFreeEntry;
+		}
+		if (oldFreeEntry == _preZeroReservedEntry) {
+			_preZeroReservedEntry = newFreeEntry;
+		}
+	}
 	
 protected:
+	virtual void *allocateQuickListChunk(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+
 public:
 	static MM_MemoryPoolAddressOrderedList *newInstance(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize); 
 	static MM_MemoryPoolAddressOrderedList *newInstance(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name);
@@ -90,6 +114,7 @@ public:
 	virtual void *allocateTLH(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
 	virtual void *collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired);
 	virtual void *collectorAllocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired);
+	virtual void *allocateReservationChunk(MM_EnvironmentBase *env, uintptr_t objectSize, uintptr_t objectCount);
 		
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -97,6 +122,15 @@ public:
 	virtual void reset(Cause cause = any);
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
 
+	virtual uintptr_t preZeroFreeMemory(MM_EnvironmentBase *env, uintptr_t maximumBytes);
+	virtual void resetPreZeroedMemory()
+	{
+		_preZeroedTop = NULL;
+		_preZeroEntry = NULL;
+		_preZeroRangeBase = NULL;
+		_preZeroRangeTop = NULL;
+	}
+
 #if defined(DEBUG)
 	virtual bool isValidListOrdering();
 #endif
@@ -134,6 +168,9 @@ public:
 	virtual void appendCollectorLargeAllocateStats();
 
 	virtual void mergeFreeEntryAllocateStats() {_largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeCountForVeryLargeEntries();}
+	virtual void mergeLargeObjectAllocateStats() { reportQuickListAllocations(_largeObjectAllocateStats); }
+
+	virtual uintptr_t getActualFreeMemorySize();
 	
 	virtual bool initializeSweepPool(MM_EnvironmentBase *env);
 	
@@ -152,6 +189,11 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_preZeroedTop(NULL)
+		,_preZeroEntry(NULL)
+		,_preZeroRangeBase(NULL)
+		,_preZeroRangeTop(NULL)
+		,_preZeroReservedEntry(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -160,6 +202,11 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_preZeroedTop(NULL)
+		,_preZeroEntry(NULL)
+		,_preZeroRangeBase(NULL)
+		,_preZeroRangeTop(NULL)
+		,_preZeroReservedEntry(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -181,6 +181,175 @@ MM_MemoryPoolAddressOrderedListBase::abandonMemoryInPool(MM_EnvironmentBase* env
 	abandonHeapChunk((MM_HeapLinkedFreeHeader*)address, (uint8_t*)address + size);
 }
 
+/****************************************
+ * Quick-lists
+ ****************************************
+ */
+
+/**
+ * Carve the quick-list entries for the most frequently allocated large object sizes out of the free list.
+ * The free memory budget (a percentage of the pool free memory) is shared between the top sizes of the
+ * averaged allocation profile, in proportion to their share of the allocated bytes.
+ */
+void
+MM_MemoryPoolAddressOrderedListBase::populateFreeEntryQuickLists(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_quickLists.clear();
+
+	/* a pool with a parent (such as either side of the LOA) is not profiled on its own */
+	if (!extensions->freeEntryQuickLists || !extensions->processLargeAllocateStats || (NULL != getParent()) || (NULL == _largeObjectAllocateStats)) {
+		return;
+	}
+
+	OMRSpaceSaving *spaceSaving = _largeObjectAllocateStats->getSpaceSavingSizesAveragePercent();
+	uintptr_t sizeCount = OMR_MIN(extensions->freeEntryQuickListSizes, spaceSavingGetCurSize(spaceSaving));
+	float totalPercent = 0.0;
+	for (uintptr_t i = 0; i < sizeCount; i++) {
+		totalPercent += _largeObjectAllocateStats->convertPercentUDATAToFloat(spaceSavingGetKthMostFreqCount(spaceSaving, i + 1));
+	}
+	if (0.0 >= totalPercent) {
+		return;
+	}
+
+	float budget = (float)(getActualFreeMemorySize() / 100 * extensions->freeEntryQuickListPercent);
+
+	/* carving goes through the allocation path, which must not count it as allocation by the mutators */
+	uintptr_t allocCount = _allocCount;
+	uintptr_t allocBytes = _allocBytes;
+	uintptr_t allocSearchCount = _allocSearchCount;
+
+	for (uintptr_t i = 0; i < sizeCount; i++) {
+		uintptr_t size = (uintptr_t)spaceSavingGetKthMostFreq(spaceSaving, i + 1);
+		float percent = _largeObjectAllocateStats->convertPercentUDATAToFloat(spaceSavingGetKthMostFreqCount(spaceSaving, i + 1));
+		uintptr_t entryCount = (uintptr_t)(budget * percent / totalPercent) / size;
+		if ((size < sizeof(MM_HeapLinkedFreeHeader)) || (0 == entryCount)) {
+			continue;
+		}
+
+		carveQuickListEntries(env, _quickLists.addList(size), size, entryCount);
+	}
+
+	_allocCount = allocCount;
+	_allocBytes = allocBytes;
+	_allocSearchCount = allocSearchCount;
+}
+
+/**
+ * Carve the size band lists of a large object area out of the free list.
+ * Frequently allocated sizes of the averaged profile are grouped by their size class. Each class becomes a band
+ * serving any size of the class, with entries as large as the largest frequent size in it, so repeated allocations
+ * of similar sizes are packed together instead of splitting the free list further. The budget is shared between
+ * the bands in proportion to their share of the allocated bytes.
+ */
+void
+MM_MemoryPoolAddressOrderedListBase::populateSizeBands(MM_EnvironmentBase *env, MM_LargeObjectAllocateStats *profile, uintptr_t minimumSize, uintptr_t budget)
+{
+	uintptr_t bandSizeClass[MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM];
+	uintptr_t bandSize[MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM];
+	float bandPercent[MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM];
+	uintptr_t bandCount = 0;
+	float totalPercent = 0.0;
+
+	_quickLists.clear();
+
+	OMRSpaceSaving *spaceSaving = profile->getSpaceSavingSizesAveragePercent();
+	uintptr_t sizeCount = spaceSavingGetCurSize(spaceSaving);
+	for (uintptr_t i = 0; i < sizeCount; i++) {
+		uintptr_t size = (uintptr_t)spaceSavingGetKthMostFreq(spaceSaving, i + 1);
+		if (size < minimumSize) {
+			continue;
+		}
+		float percent = profile->convertPercentUDATAToFloat(spaceSavingGetKthMostFreqCount(spaceSaving, i + 1));
+		uintptr_t sizeClass = profile->getSizeClassIndex(size);
+		uintptr_t band = 0;
+		while ((band < bandCount) && (bandSizeClass[band] != sizeClass)) {
+			band += 1;
+		}
+		if (band == bandCount) {
+			if (MM_FREE_ENTRY_QUICK_LISTS_MAXIMUM == bandCount) {
+				continue;
+			}
+			/* keep the bands sorted by size class, so that their size ranges are ordered as well */
+			while ((0 < band) && (bandSizeClass[band - 1] > sizeClass)) {
+				bandSizeClass[band] = bandSizeClass[band - 1];
+				bandSize[band] = bandSize[band - 1];
+				bandPercent[band] = bandPercent[band - 1];
+				band -= 1;
+			}
+			bandSizeClass[band] = sizeClass;
+			bandSize[band] = size;
+			bandPercent[band] = 0.0;
+			bandCount += 1;
+		}
+		bandSize[band] = OMR_MAX(bandSize[band], size);
+		bandPercent[band] += percent;
+		totalPercent += percent;
+	}
+	if (0.0 >= totalPercent) {
+		return;
+	}
+
+	/* carving goes through the allocation path, which must not count it as allocation by the mutators */
+	uintptr_t allocCount = _allocCount;
+	uintptr_t allocBytes = _allocBytes;
+	uintptr_t allocSearchCount = _allocSearchCount;
+
+	uintptr_t previousBandSize = 0;
+	for (uintptr_t band = 0; band < bandCount; band++) {
+		uintptr_t size = bandSize[band];
+		uintptr_t entryCount = (uintptr_t)((float)budget * bandPercent[band] / totalPercent) / size;
+		uintptr_t bandMinimumSize = OMR_MAX(profile->getSizeClassSizes(bandSizeClass[band]), OMR_MAX(minimumSize, previousBandSize + 1));
+		previousBandSize = size;
+		if (0 != entryCount) {
+			carveQuickListEntries(env, _quickLists.addList(size, bandMinimumSize), size, entryCount);
+		}
+	}
+
+	_allocCount = allocCount;
+	_allocBytes = allocBytes;
+	_allocSearchCount = allocSearchCount;
+}
+
+void
+MM_MemoryPoolAddressOrderedListBase::clearQuickLists(MM_EnvironmentBase *env)
+{
+	if (!_quickLists.isEmpty()) {
+		/* fold the allocations from the lists into the pool statistics before the lists go */
+		mergeLargeObjectAllocateStats();
+		_quickLists.clear();
+	}
+}
+
+/**
+ * Carve entryCount entries of the given size for the quick-list at the given index, in batches, halving the batch
+ * each time the free list cannot provide a contiguous chunk for it.
+ */
+void
+MM_MemoryPoolAddressOrderedListBase::carveQuickListEntries(MM_EnvironmentBase *env, uintptr_t index, uintptr_t size, uintptr_t entryCount)
+{
+	uintptr_t batchCount = entryCount;
+	while ((0 < entryCount) && (0 < batchCount)) {
+		batchCount = OMR_MIN(batchCount, entryCount);
+		void *chunk = allocateQuickListChunk(env, batchCount * size);
+		if (NULL == chunk) {
+			batchCount /= 2;
+		} else {
+			_quickLists.pushEntries(index, chunk, batchCount);
+			entryCount -= batchCount;
+		}
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedListBase::reportQuickListAllocations(MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+{
+	uintptr_t bytesAllocated = 0;
+	_allocCount += _quickLists.reportAllocations(largeObjectAllocateStats, &bytesAllocated);
+	_allocBytes += bytesAllocated;
+}
+
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
 MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry)
@@ -27,6 +27,8 @@
 //#include "omrcomp.h"
 #include "modronopt.h"
 
+#include "AllocateDescription.hpp"
+#include "FreeEntryQuickLists.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPool.hpp"
@@ -53,6 +55,7 @@ protected:
 	MM_SweepPoolState* _sweepPoolState;	/**< GC Sweep Pool State */
 	MM_SweepPoolManagerAddressOrderedListBase* _sweepPoolManager;		/**< pointer to SweepPoolManager class */
 	MM_HeapLinkedFreeHeader *_lastFreeEntry;							/**< address of the last free entry in the pool; valid after compact; NOT maintained during allocation */ 
+	MM_FreeEntryQuickLists _quickLists;									/**< lock-free lists of free entries for the most frequently allocated sizes, consulted before the free list */
 
 public:
 	
@@ -175,6 +178,27 @@ protected:
 	void connectFinalMemoryToPool(MM_EnvironmentBase *env, void *address, uintptr_t size);
 	void abandonMemoryInPool(MM_EnvironmentBase *env, void *address, uintptr_t size);
 
+	/**
+	 * Carve a chunk of memory out of the free list for the quick-lists, as an unlocked allocation would.
+	 * @param sizeInBytesRequired size of the chunk
+	 * @return the chunk, or NULL if no free entry is large enough
+	 */
+	virtual void *allocateQuickListChunk(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired) = 0;
+
+	/**
+	 * Carve entries of one size for a quick-list out of the free list.
+	 * @param index index of the quick-list
+	 * @param size size of the entries
+	 * @param entryCount number of entries wanted, fewer are carved if the free list runs out of large enough entries
+	 */
+	void carveQuickListEntries(MM_EnvironmentBase *env, uintptr_t index, uintptr_t size, uintptr_t entryCount);
+
+	/**
+	 * Fold allocations satisfied from the quick-lists since the last call into the pool allocation statistics.
+	 * @param largeObjectAllocateStats stats that the allocation sizes are reported to
+	 */
+	void reportQuickListAllocations(MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+
 
 	/**
 	 * Check, can free memory element be connected to memory pool
@@ -189,6 +213,19 @@ protected:
 	}
 	
 public:
+	/**
+	 * Try to satisfy an object allocation from the quick-lists, without taking any lock.
+	 * @return the allocated memory, or NULL if the allocation must go to the free list
+	 */
+	MMINLINE void *allocateFromQuickLists(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+	{
+		void *addr = _quickLists.allocate(allocDescription->getContiguousBytes());
+		if (NULL != addr) {
+			allocDescription->setQuickListAllocation(true);
+		}
+		return addr;
+	}
+
 	virtual void acquireResetLock(MM_EnvironmentBase* env);
 	virtual void releaseResetLock(MM_EnvironmentBase* env);
 
@@ -231,6 +268,29 @@ public:
 	virtual void printCurrentFreeList(MM_EnvironmentBase* env, const char* area)=0;
 
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase* env)=0;
+
+	virtual void populateFreeEntryQuickLists(MM_EnvironmentBase *env);
+
+	/**
+	 * Replace the quick-lists with size band lists, for the large object area. Must be called while the world is stopped.
+	 * @param profile averaged allocation profile the bands are built from
+	 * @param minimumSize smallest allocation size served by the pool
+	 * @param budget number of free bytes that may be carved into band entries
+	 */
+	void populateSizeBands(MM_EnvironmentBase *env, MM_LargeObjectAllocateStats *profile, uintptr_t minimumSize, uintptr_t budget);
+
+	/**
+	 * Drop the quick-lists before the next sweep, such as when the range of the pool shrinks. Entries left on
+	 * the lists are reclaimed by the next sweep. Must be called while the world is stopped.
+	 */
+	void clearQuickLists(MM_EnvironmentBase *env);
+
+	/**
+	 * Carve a chunk for objectCount consecutive objects of objectSize bytes out of the free list, taking the pool lock.
+	 * The objects are reported to the allocation statistics as if they had been allocated one by one.
+	 * @return the chunk, or NULL if no free entry is large enough
+	 */
+	virtual void *allocateReservationChunk(MM_EnvironmentBase *env, uintptr_t objectSize, uintptr_t objectCount) = 0;
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
 #endif
@@ -36,6 +36,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceRegionIterator.hpp"
+#include "HeapLinkedFreeHeader.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "LargeObjectAllocateStats.hpp"
 
@@ -374,7 +375,7 @@ MM_MemoryPoolLargeObjects::calculateTargetLOARatio(MM_EnvironmentBase* env, uint
 	/*
 	 * shift elements to make room for current loa free Ratio
 	 */
-	for (int i = _extensions->loaFreeHistorySize; i > 0 ; i--){
+	for (int i = _extensions->loaFreeHistorySize - 1; i > 0 ; i--){
 		_loaFreeRatioHistory[i] = _loaFreeRatioHistory[i-1];
 	}
 	if (0 == _loaSize) {
@@ -545,6 +546,24 @@ MM_MemoryPoolLargeObjects::allocateObject(MM_EnvironmentBase* env, MM_AllocateDe
 	void* addr = NULL;
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
 
+	/* A thread repeating the size its LOA reservation was taken for is served from it without any lock */
+	if (sizeInBytesRequired == env->_loaReservationSize) {
+		addr = allocateFromLOAReservation(env, allocDescription);
+		if (NULL != addr) {
+			return addr;
+		}
+	}
+
+	/* The LOA size bands were carved for the frequent large sizes, they are used before the SOA free list */
+	if (_extensions->loaSizeBands && (sizeInBytesRequired >= _extensions->largeObjectMinimumSize)) {
+		addr = _memoryPoolLargeObjects->allocateFromQuickLists(env, allocDescription);
+		if (NULL != addr) {
+			setLOAObjectAllocation(env, allocDescription);
+			env->_loaLastAllocationSize = sizeInBytesRequired;
+			return addr;
+		}
+	}
+
 	/* First we try to allocate ALL objects in the SOA, even large ones
 	 * provided we have not already had a AF for a smaller object this
 	 * cycle.
@@ -560,7 +579,12 @@ MM_MemoryPoolLargeObjects::allocateObject(MM_EnvironmentBase* env, MM_AllocateDe
 
 			/* Retry allocation in LOA ..if we have one */
 			if (_loaSize > 0) {
-				addr = _memoryPoolLargeObjects->allocateObject(env, allocDescription);
+				if ((1 < _extensions->loaReservationCount) && (sizeInBytesRequired == env->_loaLastAllocationSize)) {
+					addr = reserveLOAChunk(env, allocDescription);
+				}
+				if (NULL == addr) {
+					addr = _memoryPoolLargeObjects->allocateObject(env, allocDescription);
+				}
 
 				if (addr != NULL) {
 					allocDescription->setLOAAllocation(true);
@@ -573,9 +597,95 @@ MM_MemoryPoolLargeObjects::allocateObject(MM_EnvironmentBase* env, MM_AllocateDe
 		}
 	}
 
+	/* Remember the size so that a repeat of it from the LOA takes a reservation */
+	if ((NULL != addr) && (sizeInBytesRequired >= _extensions->largeObjectMinimumSize)) {
+		env->_loaLastAllocationSize = sizeInBytesRequired;
+	}
+
+	return addr;
+}
+
+/**
+ * Allocate the next object of the thread's LOA reservation, without taking any lock.
+ * The rest of the reservation is kept formatted as a hole, so that the heap stays walkable. A reservation
+ * does not survive a global collection: the sweep has already returned its unused part to the pool.
+ * @return the object, or NULL if the reservation has been dropped
+ */
+void*
+MM_MemoryPoolLargeObjects::allocateFromLOAReservation(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription)
+{
+	if (env->_loaReservationGCCount != _extensions->globalGCStats.gcCount) {
+		env->_loaReservationSize = 0;
+		return NULL;
+	}
+
+	void* addr = env->_loaReservationAlloc;
+	void* next = (void*)((uintptr_t)addr + env->_loaReservationSize);
+	if (next < env->_loaReservationTop) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(next, (uintptr_t)env->_loaReservationTop - (uintptr_t)next);
+		env->_loaReservationAlloc = next;
+	} else {
+		env->_loaReservationSize = 0;
+	}
+
+	allocDescription->setLOAReservationAllocation(true);
+	setLOAObjectAllocation(env, allocDescription);
+
+	return addr;
+}
+
+/**
+ * Carve a reservation for the next _extensions->loaReservationCount objects of the requested size out of the
+ * LOA, and allocate the first of them. The count is halved until the reservation fits. Any reservation still held by the thread is abandoned, its unused part
+ * is reclaimed by the next sweep.
+ * @return the object, or NULL if the LOA has no free entry large enough for the reservation
+ */
+void*
+MM_MemoryPoolLargeObjects::reserveLOAChunk(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription)
+{
+	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+	uintptr_t objectCount = _extensions->loaReservationCount;
+	void* addr = NULL;
+
+	/* A nearly full LOA may still fit a smaller reservation */
+	while ((NULL == addr) && (1 < objectCount)) {
+		addr = _memoryPoolLargeObjects->allocateReservationChunk(env, sizeInBytesRequired, objectCount);
+		if (NULL == addr) {
+			objectCount /= 2;
+		}
+	}
+
+	if (NULL != addr) {
+		void* next = (void*)((uintptr_t)addr + sizeInBytesRequired);
+		env->_loaReservationSize = sizeInBytesRequired;
+		env->_loaReservationAlloc = next;
+		env->_loaReservationTop = (void*)((uintptr_t)addr + (sizeInBytesRequired * objectCount));
+		env->_loaReservationGCCount = _extensions->globalGCStats.gcCount;
+		MM_HeapLinkedFreeHeader::fillWithHoles(next, (uintptr_t)env->_loaReservationTop - (uintptr_t)next);
+
+		setLOAObjectAllocation(env, allocDescription);
+	}
+
 	return addr;
 }
 
+/**
+ * Describe an object allocated from a LOA size band or reservation as the LOA pool would have described it.
+ */
+void
+MM_MemoryPoolLargeObjects::setLOAObjectAllocation(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription)
+{
+#if defined(OMR_GC_ALLOCATION_TAX)
+	if (_extensions->payAllocationTax) {
+		allocDescription->setAllocationTaxSize(allocDescription->getBytesRequested());
+	}
+#endif /* OMR_GC_ALLOCATION_TAX */
+	allocDescription->setTLHAllocation(false);
+	allocDescription->setNurseryAllocation(false);
+	allocDescription->setLOAAllocation(true);
+	allocDescription->setMemoryPool(_memoryPoolLargeObjects);
+}
+
 void*
 MM_MemoryPoolLargeObjects::allocateTLH(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription,
 									   uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop)
@@ -1067,6 +1177,9 @@ MM_MemoryPoolLargeObjects::redistributeFreeMemory(MM_EnvironmentBase* env, uintp
 	_currentLOABase = determineLOABase(env, _soaSize);
 
 	if (oldLOABase < _currentLOABase) {
+		/* Size band entries may now be below the LOA base, they must not be counted as LOA free memory */
+		_memoryPoolLargeObjects->clearQuickLists(env);
+
 		/* Take chunks away from LOA and give to SOA */
 		_memoryPoolLargeObjects->removeFreeEntriesWithinRange(env, oldLOABase, _currentLOABase,
 															  _memoryPoolSmallObjects->getMinimumFreeEntrySize(),
@@ -1139,6 +1252,18 @@ MM_MemoryPoolLargeObjects::determineLOABase(MM_EnvironmentBase* env, uintptr_t s
 	return NULL;
 }
 
+/**
+ * Carve the size band lists of the LOA out of its free list, from the averaged allocation profile of both areas.
+ */
+void
+MM_MemoryPoolLargeObjects::populateFreeEntryQuickLists(MM_EnvironmentBase* env)
+{
+	if (_extensions->loaSizeBands && _extensions->processLargeAllocateStats && (0 < _loaSize)) {
+		uintptr_t budget = _memoryPoolLargeObjects->getActualFreeMemorySize() / 100 * _extensions->loaSizeBandPercent;
+		_memoryPoolLargeObjects->populateSizeBands(env, _largeObjectAllocateStats, _extensions->largeObjectMinimumSize, budget);
+	}
+}
+
 void
 MM_MemoryPoolLargeObjects::mergeFreeEntryAllocateStats()
 {
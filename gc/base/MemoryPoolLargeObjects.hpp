@@ -116,6 +116,10 @@ private:
 	void resetLOASize(MM_EnvironmentBase*, double newLOARatio);
 	void redistributeFreeMemory(MM_EnvironmentBase*, uintptr_t newOldAreaSize);
 
+	void* allocateFromLOAReservation(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
+	void* reserveLOAChunk(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
+	void setLOAObjectAllocation(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
+
 protected:
 public:
 	static MM_MemoryPoolLargeObjects* newInstance(MM_EnvironmentBase* env, MM_MemoryPoolAddressOrderedListBase* largeObjectArea, MM_MemoryPoolAddressOrderedListBase* smallObjectArea);
@@ -152,6 +156,10 @@ public:
 
 	virtual void reset(Cause cause = any);
 
+	/* TLHs are only carved from the small object area */
+	virtual uintptr_t preZeroFreeMemory(MM_EnvironmentBase* env, uintptr_t maximumBytes) { return _memoryPoolSmallObjects->preZeroFreeMemory(env, maximumBytes); }
+	virtual void resetPreZeroedMemory() { _memoryPoolSmallObjects->resetPreZeroedMemory(); }
+
 	virtual void expandWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress, bool canCoalesce);
 	virtual void* contractWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress);
 	virtual bool abandonHeapChunk(void* addrBase, void* addrTop);
@@ -181,6 +189,11 @@ public:
 
 	virtual void moveHeap(MM_EnvironmentBase* env, void* srcBase, void* srcTop, void* dstBase);
 
+	/**
+	 * Carve the LOA size band lists (enabled with the -Xgc:loaSizeBands option).
+	 */
+	virtual void populateFreeEntryQuickLists(MM_EnvironmentBase* env);
+
 	/**
 	 * Merge the free entry stats from both children pools.
 	 */
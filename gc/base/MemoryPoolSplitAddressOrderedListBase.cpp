@@ -253,7 +253,10 @@ MM_MemoryPoolSplitAddressOrderedListBase::tearDown(MM_EnvironmentBase* env)
 void*
 MM_MemoryPoolSplitAddressOrderedListBase::allocateObject(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription)
 {
-	void* addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStatsForFreeList);
+	void* addr = allocateFromQuickLists(env, allocDescription);
+	if (NULL == addr) {
+		addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStatsForFreeList);
+	}
 
 	if (addr != NULL) {
 		if (env->getExtensions()->payAllocationTax) {
@@ -267,6 +270,27 @@ MM_MemoryPoolSplitAddressOrderedListBase::allocateObject(MM_EnvironmentBase* env
 	return addr;
 }
 
+void*
+MM_MemoryPoolSplitAddressOrderedListBase::allocateQuickListChunk(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired)
+{
+	return internalAllocate(env, sizeInBytesRequired, false, NULL);
+}
+
+void*
+MM_MemoryPoolSplitAddressOrderedListBase::allocateReservationChunk(MM_EnvironmentBase* env, uintptr_t objectSize, uintptr_t objectCount)
+{
+	lock(env);
+	void* addr = internalAllocate(env, objectSize * objectCount, false, NULL);
+	if (NULL != addr) {
+		/* the chunk was counted as a single allocation, the objects are kept with the first free list like quick-list allocations */
+		_allocCount += objectCount - 1;
+		_largeObjectAllocateStatsForFreeList[0].allocateObject(objectSize, objectCount);
+	}
+	unlock(env);
+
+	return addr;
+}
+
 void*
 MM_MemoryPoolSplitAddressOrderedListBase::collectorAllocate(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription, bool lockingRequired)
 {
@@ -336,6 +360,7 @@ MM_MemoryPoolSplitAddressOrderedListBase::reset(Cause cause)
 		/* initialize frequent allocates for each free list based on cummulative large object stats for the pool */
 		resetFreeEntryAllocateStats(&_largeObjectAllocateStatsForFreeList[i]);
 	}
+	_quickLists.clear();
 	_lastFreeEntry = NULL;
 	resetFreeEntryAllocateStats(_largeObjectAllocateStats);
 	resetLargeObjectAllocateStats();
@@ -817,6 +842,8 @@ MM_MemoryPoolSplitAddressOrderedListBase::getActualFreeMemorySize()
 	for (uintptr_t i = 0; i < _heapFreeListCountExtended; ++i) {
 		result += _heapFreeLists[i]._freeSize;
 	}
+	/* free memory held by the quick-lists is carved out of the free lists, but is still free */
+	result += _quickLists.getFreeBytes();
 	return result;
 }
 
@@ -864,6 +891,9 @@ MM_MemoryPoolSplitAddressOrderedListBase::mergeTlhAllocateStats()
 void
 MM_MemoryPoolSplitAddressOrderedListBase::mergeLargeObjectAllocateStats()
 {
+	/* quick-list allocations are kept with the first free list, so they survive repeated merges until the next reset */
+	reportQuickListAllocations(&_largeObjectAllocateStatsForFreeList[0]);
+
 	_largeObjectAllocateStats->resetCurrent();
 
 	for (uintptr_t i = 0; i < _heapFreeListCountExtended; ++i) {
@@ -1211,12 +1211,11 @@ MM_MemorySubSpace::maxContraction(MM_EnvironmentBase* env)
 uintptr_t
 MM_MemorySubSpace::maxContractionInSpace(MM_EnvironmentBase* env)
 {
-	uintptr_t max = _currentSize - _minimumSize;
-
 	/* Is memory space already at minimum size then we cant contrac anymore */
-	if (max == 0) {
+	if (_currentSize <= _minimumSize) {
 		return 0;
 	} else {
+		uintptr_t max = _currentSize - _minimumSize;
 		if (_parent) {
 			return OMR_MIN(_parent->maxContractionInSpace(env), max);
 		}
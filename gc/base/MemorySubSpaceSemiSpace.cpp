@@ -23,6 +23,7 @@
 
 #include "omrcfg.h"
 #include "modronopt.h"
+#include "gcutils.h"
 
 #include "AllocateDescription.hpp"
 #include "Collector.hpp"
@@ -38,6 +39,7 @@
 #include "MemorySubSpaceRegionIterator.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "PhysicalSubArena.hpp"
+#include "mmprivatehook.h"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -45,6 +47,12 @@
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
+/* Weights given to a new sample when updating the averages of the pause target controller. A pause above
+ * the average is weighted more heavily so that the controller reacts quickly when the pause target is missed.
+ */
+#define PAUSE_TARGET_WEIGHT_INCREASE 0.5
+#define PAUSE_TARGET_WEIGHT_DECREASE 0.2
+
 /****************************************
  * Allocation
  ****************************************
@@ -968,6 +976,188 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Adjust the sub space memory and the adaptive tenure age to meet the scavenge pause and overhead targets.
+ * The pause of a scavenge is predicted to scale with the size of the nursery, and the time spent scavenging
+ * to scale inversely with it. The nursery contracts when the average pause is above target, and expands
+ * when the time spent scavenging is above target as far as the predicted pause stays within target. The
+ * tenure age is lowered when the pause is still above target after the nursery shrank, and raised when the
+ * pause is well within target. The decision is reported by performResize() once it has been applied.
+ */
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	MM_ScavengerStats *scavengerStats = &extensions->scavengerStats;
+	bool doPauseTargetSizing = true;
+	bool debug = extensions->debugDynamicNewSpaceSizing;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(debug) {
+		omrtty_printf("New space pause target check:\n");
+	}
+
+	/* the wall clock might be shifted backwards externally */
+	if ((scavengerStats->_startTime < _lastScavengeEndTime) || (scavengerStats->_endTime < scavengerStats->_startTime)) {
+		if(debug) {
+			omrtty_printf("\tClock shifted backwards - ABORTING\n");
+		}
+		doPauseTargetSizing = false;
+	}
+
+	uint64_t pauseTime = omrtime_hires_delta(scavengerStats->_startTime, scavengerStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t intervalTime = omrtime_hires_delta(_lastScavengeEndTime, scavengerStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	bool haveInterval = (1 != scavengerStats->_gcCount) && (0 != intervalTime);
+
+	if (0 == pauseTime) {
+		if(debug) {
+			omrtty_printf("\tScavenge time 0 - ABORTING\n");
+		}
+		doPauseTargetSizing = false;
+	}
+
+	_lastScavengeEndTime = scavengerStats->_endTime;
+
+	if (doPauseTargetSizing) {
+		double pauseTarget = (double)extensions->scavengerPauseTarget;
+		double overheadTarget = (double)extensions->scavengerOverheadTarget / 100.0;
+		uintptr_t currentSize = getCurrentSize();
+		uintptr_t tenureAge = extensions->scvTenureAdaptiveTenureAge;
+		HeapResizeType resizeType = HEAP_NO_RESIZE;
+		uintptr_t amount = 0;
+		PauseTargetReason reason = PAUSE_TARGET_WITHIN_TARGETS;
+
+		/* The nursery may have been resized since the previous decision (or a requested resize may have failed):
+		 * rescale the averages to the current size before folding in the new sample
+		 */
+		bool shrunk = false;
+		if (0 != _pauseTargetNurserySize) {
+			double sizeRatio = (double)currentSize / (double)_pauseTargetNurserySize;
+			_averageScavengePauseTime *= sizeRatio;
+			_averageScavengeTimeRatio /= sizeRatio;
+			shrunk = (currentSize < _pauseTargetNurserySize);
+		}
+		_pauseTargetNurserySize = currentSize;
+
+		/* The first sample seeds the averages */
+		double weight = 1.0;
+		if (0.0 != _averageScavengePauseTime) {
+			weight = ((double)pauseTime > _averageScavengePauseTime) ? PAUSE_TARGET_WEIGHT_INCREASE : PAUSE_TARGET_WEIGHT_DECREASE;
+		}
+		_averageScavengePauseTime = ((double)pauseTime * weight) + (_averageScavengePauseTime * (1.0 - weight));
+
+		if (haveInterval) {
+			double timeRatio = (double)pauseTime / (double)intervalTime;
+			weight = (timeRatio > _averageScavengeTimeRatio) ? PAUSE_TARGET_WEIGHT_INCREASE : PAUSE_TARGET_WEIGHT_DECREASE;
+			_averageScavengeTimeRatio = (timeRatio * weight) + (_averageScavengeTimeRatio * (1.0 - weight));
+		}
+
+		double averagePauseTime = _averageScavengePauseTime;
+		double averageTimeRatio = _averageScavengeTimeRatio;
+
+		if(debug) {
+			omrtty_printf("\tPause:%llu us average:%lf us target:%zu us  time ratio average:%lf target:%lf\n",
+				pauseTime, averagePauseTime, extensions->scavengerPauseTarget, averageTimeRatio, overheadTarget);
+		}
+
+		if (averagePauseTime > pauseTarget) {
+			reason = PAUSE_TARGET_PAUSE_TOO_HIGH;
+
+			/* The semispaces contract in pairs of regions, so a nursery with less room than that (such as one
+			 * whose minimum and maximum sizes are the same) cannot shrink
+			 */
+			uintptr_t maximumContraction = 0;
+			if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env)) {
+				maximumContraction = MM_Math::roundToFloor(2 * regionSize, maxContractionInSpace(env));
+			}
+
+			if (0 != maximumContraction) {
+				/* Contract to the size predicted to meet the pause target */
+				double contractionFactor = 1.0 - (pauseTarget / averagePauseTime);
+				contractionFactor = OMR_MIN(contractionFactor, extensions->dnssMaximumContraction);
+				contractionFactor = OMR_MAX(contractionFactor, extensions->dnssMinimumContraction);
+
+				_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(currentSize * contractionFactor));
+				_contractionSize = MM_Math::roundToCeiling(2 * regionSize, _contractionSize);
+				_contractionSize = OMR_MIN(_contractionSize, maximumContraction);
+				resizeType = HEAP_CONTRACT;
+				amount = _contractionSize;
+				extensions->heap->getResizeStats()->setLastContractReason(SCAV_PAUSE_TOO_HIGH);
+			}
+
+			if (shrunk && extensions->scvTenureStrategyAdaptive && (extensions->scvTenureAdaptiveTenureAge > OBJECT_HEADER_AGE_MIN)) {
+				/* Contracting has not brought the pause down enough - copy long lived objects fewer times before tenuring them */
+				extensions->scvTenureAdaptiveTenureAge -= 1;
+			}
+		} else if (haveInterval && (averageTimeRatio > overheadTarget)) {
+			/* Expanding divides the scavenge frequency, and multiplies the predicted pause, by the same factor */
+			double desiredExpansionFactor = (averageTimeRatio / overheadTarget) - 1.0;
+			double allowedExpansionFactor = (pauseTarget / averagePauseTime) - 1.0;
+			double expansionFactor = OMR_MIN(desiredExpansionFactor, allowedExpansionFactor);
+			expansionFactor = OMR_MIN(expansionFactor, extensions->dnssMaximumExpansion);
+			expansionFactor = OMR_MAX(expansionFactor, extensions->dnssMinimumExpansion);
+
+			reason = (allowedExpansionFactor < desiredExpansionFactor) ? PAUSE_TARGET_EXPANSION_LIMITED_BY_PAUSE : PAUSE_TARGET_OVERHEAD_TOO_HIGH;
+
+			uintptr_t desiredExpansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(currentSize * expansionFactor));
+			uintptr_t expansionSize = MM_Math::roundToCeiling(2 * regionSize, desiredExpansionSize);
+			if ((averagePauseTime * (double)(currentSize + expansionSize) / (double)currentSize) > pauseTarget) {
+				/* Rounding up to regions must not push the predicted pause over the target */
+				expansionSize = MM_Math::roundToFloor(2 * regionSize, desiredExpansionSize);
+			}
+
+			if ((0 != expansionSize)
+					&& (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+				_expansionSize = expansionSize;
+				resizeType = HEAP_EXPAND;
+				amount = _expansionSize;
+				extensions->heap->getResizeStats()->setLastExpandReason(SCAV_OVERHEAD_TOO_HIGH);
+			}
+		} else if ((averagePauseTime * 2.0) < pauseTarget) {
+			/* Well within the pause target - age objects longer so that fewer short lived objects are tenured */
+			if (extensions->scvTenureStrategyAdaptive && (extensions->scvTenureAdaptiveTenureAge < OBJECT_HEADER_AGE_MAX)) {
+				extensions->scvTenureAdaptiveTenureAge += 1;
+			}
+		}
+
+		if(debug) {
+			omrtty_printf("\tDecision - %s resize type:%zu amount:%zu tenure age:%zu -> %zu\n\n",
+				getPauseTargetReasonAsString(reason), (uintptr_t)resizeType, amount, tenureAge, extensions->scvTenureAdaptiveTenureAge);
+		}
+
+		/* The physical sub arena may not be able to resize by the amount decided (or at all), so the decision is
+		 * reported with the resize actually applied
+		 */
+		_pauseTargetPauseTime = pauseTime;
+		_pauseTargetTenureAge = tenureAge;
+		_pauseTargetReason = reason;
+	}
+}
+
+void
+MM_MemorySubSpaceSemiSpace::reportPauseTargetDecision(MM_EnvironmentBase *env, uint64_t pauseTime, double averagePauseTime, double averageTimeRatio, HeapResizeType resizeType, uintptr_t amount, uintptr_t tenureAge, PauseTargetReason reason)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	TRIGGER_J9HOOK_MM_PRIVATE_SCAVENGE_PAUSE_TARGET_DECISION(
+		_extensions->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_SCAVENGE_PAUSE_TARGET_DECISION,
+		pauseTime,
+		(uint64_t)averagePauseTime,
+		(uint64_t)_extensions->scavengerPauseTarget,
+		(float)(averageTimeRatio * 100.0),
+		_extensions->scavengerOverheadTarget,
+		(uintptr_t)resizeType,
+		amount,
+		getCurrentSize(),
+		tenureAge,
+		_extensions->scvTenureAdaptiveTenureAge,
+		(uintptr_t)reason);
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
@@ -984,7 +1174,11 @@ MM_MemorySubSpaceSemiSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDesc
 		flip(env, MM_MemorySubSpaceSemiSpace::restore_tilt_after_percolate);
 	} else {
 		checkSubSpaceMemoryPostCollectTilt(env);
-		checkSubSpaceMemoryPostCollectResize(env);
+		if (_extensions->isScavengerPauseTargetEnabled()) {
+			checkSubSpaceMemoryPostCollectPauseTarget(env);
+		} else {
+			checkSubSpaceMemoryPostCollectResize(env);
+		}
 	}
 	env->popVMstate(oldVMState);
 }
@@ -1032,14 +1226,26 @@ MM_MemorySubSpaceSemiSpace::performResize(MM_EnvironmentBase *env, MM_AllocateDe
 		}
 	}
 	
+	HeapResizeType resizeType = HEAP_NO_RESIZE;
+	uintptr_t resizeAmount = 0;
 	if (0 != _expansionSize) {
-		expand(env, _expansionSize);
+		resizeAmount = expand(env, _expansionSize);
+		resizeType = HEAP_EXPAND;
 	} else if (0 != _contractionSize) {
-		contract(env, _contractionSize);
+		resizeAmount = contract(env, _contractionSize);
+		resizeType = HEAP_CONTRACT;
 	}
 
 	_expansionSize = 0;
 	_contractionSize = 0;
+
+	if (0 != _pauseTargetPauseTime) {
+		if (0 == resizeAmount) {
+			resizeType = HEAP_NO_RESIZE;
+		}
+		reportPauseTargetDecision(env, _pauseTargetPauseTime, _averageScavengePauseTime, _averageScavengeTimeRatio, resizeType, resizeAmount, _pauseTargetTenureAge, _pauseTargetReason);
+		_pauseTargetPauseTime = 0;
+	}
 	
 	env->popVMstate(oldVMState);
 
@@ -75,6 +75,11 @@ private:
 
 	double _averageScavengeTimeRatio;
 	uint64_t _lastScavengeEndTime;
+	double _averageScavengePauseTime; /**< weighted average scavenge pause in microseconds, maintained by the pause target controller */
+	uintptr_t _pauseTargetNurserySize; /**< nursery size at the previous pause target controller decision */
+	uint64_t _pauseTargetPauseTime; /**< pause of the scavenge the pending pause target decision was made for (0 if none is pending) */
+	uintptr_t _pauseTargetTenureAge; /**< tenure age before the pending pause target decision */
+	PauseTargetReason _pauseTargetReason; /**< reason for the pending pause target decision */
 
 	double _desiredSurvivorSpaceRatio;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -99,6 +104,8 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	void checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env);
+	void reportPauseTargetDecision(MM_EnvironmentBase *env, uint64_t pauseTime, double averagePauseTime, double averageTimeRatio, HeapResizeType resizeType, uintptr_t amount, uintptr_t tenureAge, PauseTargetReason reason);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
@@ -188,6 +195,11 @@ public:
 		,_tiltedAverageBytesFlippedDelta(0)
 		,_averageScavengeTimeRatio(0.0)
 		,_lastScavengeEndTime(0)
+		,_averageScavengePauseTime(0.0)
+		,_pauseTargetNurserySize(0)
+		,_pauseTargetPauseTime(0)
+		,_pauseTargetTenureAge(0)
+		,_pauseTargetReason(PAUSE_TARGET_WITHIN_TARGETS)
 		,_desiredSurvivorSpaceRatio(0.0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)		
 		,_bytesAllocatedDuringConcurrent(0)
@@ -213,6 +213,23 @@ MM_NUMAManager::getMaximumNodeNumber() const
 	return _maximumNodeNumber;
 }
 
+uintptr_t
+MM_NUMAManager::getAffinityLeaderIndex(uintptr_t j9NodeNumber) const
+{
+	uintptr_t result = UDATA_MAX;
+
+	if (0 != j9NodeNumber) {
+		for (uintptr_t i = 0; i < _affinityLeaderCount; i++) {
+			if (j9NodeNumber == _affinityLeaders[i].j9NodeNumber) {
+				result = i;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
 J9MemoryNodeDetail const*
 MM_NUMAManager::getAffinityLeaders(uintptr_t *arrayLength) const
 {
@@ -105,6 +105,13 @@ public:
 	 */
 	uintptr_t getMaximumNodeNumber() const;
 
+	/**
+	 * Find the position of the given node in the affinity leader array.
+	 * @param j9NodeNumber[in] The j9NodeNumber of the node to look up (0 implies no node)
+	 * @return The index of the node in the affinity leader array or UDATA_MAX if the node is not an affinity leader
+	 */
+	uintptr_t getAffinityLeaderIndex(uintptr_t j9NodeNumber) const;
+
 	/**
 	 * Returns access to the array of nodes which the receiver has determined are to act as affinity leaders.
 	 * NOTE:  The returned array should NOT be modified!
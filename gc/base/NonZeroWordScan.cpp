@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "NonZeroWordScan.hpp"
+
+#if defined(OMR_GC_NONZERO_WORD_SCAN_VECTOR)
+#include <immintrin.h>
+#endif /* OMR_GC_NONZERO_WORD_SCAN_VECTOR */
+
+MM_NonZeroWordScan::FindNonZeroWordFunction MM_NonZeroWordScan::_findNonZeroWord = MM_NonZeroWordScan::resolveAndFindNonZeroWord;
+
+uintptr_t *
+MM_NonZeroWordScan::findNonZeroWordScalar(uintptr_t *word, uintptr_t *top)
+{
+	while ((word < top) && (0 == *word)) {
+		word += 1;
+	}
+	return word;
+}
+
+#if defined(OMR_GC_NONZERO_WORD_SCAN_VECTOR)
+/**
+ * Skip zero words two 128-bit vectors at a time, then locate the non-zero word with the scalar loop.
+ */
+__attribute__((target("sse4.1")))
+static uintptr_t *
+findNonZeroWordSSE41(uintptr_t *word, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(__m128i) / sizeof(uintptr_t);
+
+	while ((uintptr_t)(top - word) >= (2 * wordsPerVector)) {
+		__m128i bits = _mm_or_si128(_mm_loadu_si128((const __m128i *)word), _mm_loadu_si128((const __m128i *)(word + wordsPerVector)));
+		if (!_mm_testz_si128(bits, bits)) {
+			break;
+		}
+		word += 2 * wordsPerVector;
+	}
+	return MM_NonZeroWordScan::findNonZeroWordScalar(word, top);
+}
+
+/**
+ * Skip zero words two 256-bit vectors at a time, then locate the non-zero word with the scalar loop.
+ */
+__attribute__((target("avx2")))
+static uintptr_t *
+findNonZeroWordAVX2(uintptr_t *word, uintptr_t *top)
+{
+	const uintptr_t wordsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+
+	while ((uintptr_t)(top - word) >= (2 * wordsPerVector)) {
+		__m256i bits = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)word), _mm256_loadu_si256((const __m256i *)(word + wordsPerVector)));
+		if (!_mm256_testz_si256(bits, bits)) {
+			break;
+		}
+		word += 2 * wordsPerVector;
+	}
+	if ((uintptr_t)(top - word) >= wordsPerVector) {
+		__m256i bits = _mm256_loadu_si256((const __m256i *)word);
+		if (_mm256_testz_si256(bits, bits)) {
+			word += wordsPerVector;
+		}
+	}
+	return MM_NonZeroWordScan::findNonZeroWordScalar(word, top);
+}
+#endif /* OMR_GC_NONZERO_WORD_SCAN_VECTOR */
+
+MM_NonZeroWordScan::FindNonZeroWordFunction
+MM_NonZeroWordScan::getImplementation(Implementation implementation)
+{
+	FindNonZeroWordFunction function = NULL;
+
+	switch (implementation) {
+	case SCAN_SCALAR:
+		function = findNonZeroWordScalar;
+		break;
+#if defined(OMR_GC_NONZERO_WORD_SCAN_VECTOR)
+	case SCAN_SSE41:
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("sse4.1")) {
+			function = findNonZeroWordSSE41;
+		}
+		break;
+	case SCAN_AVX2:
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			function = findNonZeroWordAVX2;
+		}
+		break;
+#endif /* OMR_GC_NONZERO_WORD_SCAN_VECTOR */
+	default:
+		break;
+	}
+
+	return function;
+}
+
+MM_NonZeroWordScan::Implementation
+MM_NonZeroWordScan::selectImplementation()
+{
+	uintptr_t implementation = SCAN_IMPLEMENTATION_COUNT - 1;
+	while ((SCAN_SCALAR != implementation) && (NULL == getImplementation((Implementation)implementation))) {
+		implementation -= 1;
+	}
+	return (Implementation)implementation;
+}
+
+MM_NonZeroWordScan::Implementation
+MM_NonZeroWordScan::getSelectedImplementation()
+{
+	return selectImplementation();
+}
+
+/**
+ * Initial value of the dispatch pointer: select the best implementation for this processor and install it.
+ * Racing threads all install the same implementation.
+ */
+uintptr_t *
+MM_NonZeroWordScan::resolveAndFindNonZeroWord(uintptr_t *word, uintptr_t *top)
+{
+	_findNonZeroWord = getImplementation(selectImplementation());
+	return _findNonZeroWord(word, top);
+}
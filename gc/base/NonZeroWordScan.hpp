@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(NONZEROWORDSCAN_HPP_)
+#define NONZEROWORDSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/* The vector scanners rely on GCC/Clang target attributes and cpu feature builtins */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define OMR_GC_NONZERO_WORD_SCAN_VECTOR
+#endif /* (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) */
+
+/**
+ * Bulk search for the first non-zero word in a range.
+ *
+ * The heap map and the card table are mostly zero (no marks, clean cards) where their walkers spend their time,
+ * so both skip zero runs through this scanner; see MM_HeapMapScan and MM_CardTableScan. On x86 the run is skipped
+ * with 128-bit (SSE4.1) or 256-bit (AVX2) tests, selected once at runtime from the cpu features; other platforms
+ * use the scalar loop.
+ * @ingroup GC_Base
+ */
+class MM_NonZeroWordScan
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Scanner implementations, in increasing order of preference.
+	 */
+	enum Implementation {
+		SCAN_SCALAR = 0,
+		SCAN_SSE41,
+		SCAN_AVX2,
+		SCAN_IMPLEMENTATION_COUNT
+	};
+
+	typedef uintptr_t *(*FindNonZeroWordFunction)(uintptr_t *word, uintptr_t *top);
+
+private:
+	static FindNonZeroWordFunction _findNonZeroWord; /**< selected implementation, resolved on first use */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Find the first non-zero word in a range, with the implementation selected for this processor.
+	 * @param word first word to examine
+	 * @param top first word past the range
+	 * @return the first word in [word, top) which is not zero, or top if there is none
+	 */
+	static MMINLINE uintptr_t *
+	findNonZeroWord(uintptr_t *word, uintptr_t *top)
+	{
+		return _findNonZeroWord(word, top);
+	}
+
+	/**
+	 * Reference implementation of findNonZeroWord(), one word at a time.
+	 */
+	static uintptr_t *findNonZeroWordScalar(uintptr_t *word, uintptr_t *top);
+
+	/**
+	 * Fetch a specific scanner implementation, for benchmarking and testing.
+	 * @return the implementation, or NULL if it is not supported by this build or processor
+	 */
+	static FindNonZeroWordFunction getImplementation(Implementation implementation);
+
+	/**
+	 * @return the implementation selected for this processor
+	 */
+	static Implementation getSelectedImplementation();
+
+private:
+	static Implementation selectImplementation();
+	static uintptr_t *resolveAndFindNonZeroWord(uintptr_t *word, uintptr_t *top);
+};
+
+#endif /* NONZEROWORDSCAN_HPP_ */
@@ -62,6 +62,8 @@ MM_Packet::initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previ
 	_currentPtr = _baseAddress;
 	
 	_owner = NULL;
+	/* not on any packet list yet */
+	_sublistIndex = UDATA_MAX;
 
 	return true;
 }
@@ -33,8 +33,15 @@ MM_PacketList::initialize(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->packetListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	_sublistsPerNode = extensions->packetListSplit;
+	Assert_MM_true(0 < _sublistsPerNode);
+
+	/* when NUMA is available, give each affinity leader its own group of sublists */
+	_nodeCount = 1;
+	if (extensions->numaAwareWorkPackets) {
+		_nodeCount = OMR_MAX(1, extensions->_numaManager.getAffinityLeaderCount());
+	}
+	_sublistCount = _nodeCount * _sublistsPerNode;
 
 	_sublists = (struct PacketSublist *)extensions->getForge()->allocate(sizeof(struct PacketSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -67,10 +74,37 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 }
 
 void 
-MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
+MM_PacketList::pushList(MM_EnvironmentBase *env, MM_Packet *head, MM_Packet *tail, uintptr_t count)
+{
+	/* push each run of packets which belong to the same sublist in one go, so they stay with their NUMA node */
+	MM_Packet *runHead = head;
+	uintptr_t runIndex = getHomeSublistIndex(env, head);
+	uintptr_t runCount = 0;
+	uintptr_t pushedCount = 0;
+	MM_Packet *current = head;
+
+	while (NULL != current) {
+		/* pushing a run relinks its tail, so find the next packet first */
+		MM_Packet *next = (tail == current) ? NULL : current->_next;
+		uintptr_t nextIndex = (NULL == next) ? UDATA_MAX : getHomeSublistIndex(env, next);
+
+		runCount += 1;
+		if (nextIndex != runIndex) {
+			pushListOnSublist(runIndex, runHead, current, runCount);
+			pushedCount += runCount;
+			runHead = next;
+			runIndex = nextIndex;
+			runCount = 0;
+		}
+		current = next;
+	}
+	Assert_MM_true(count == pushedCount);
+}
+
+void
+MM_PacketList::pushListOnSublist(uintptr_t index, MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
-	/* just push everything on the first list */
-	PacketSublist *list = &_sublists[0];
+	PacketSublist *list = &_sublists[index];
 	MM_Packet *current = head;
 	uintptr_t i;
 	
@@ -82,11 +116,12 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 		list->_head->_previous = tail;
 	}
 	tail->_next = list->_head;
+	head->_previous = NULL;
 	list->_head = head;
 	incrementCount(count);
 	
 	for (i = 0; i < count; ++i) {
-		current->setSublistIndex(0);
+		current->setSublistIndex(index);
 		current = current->_next;
 	}
 
@@ -187,7 +222,7 @@ MM_PacketList::getHead()
 	uintptr_t count = 0;
 	
 	if (popList(&head, &tail, &count)) {
-		pushList(head, tail, count);
+		pushListOnSublist(0, head, tail, count);
 		result = _sublists[0]._head;
 	}
 
@@ -53,6 +53,8 @@ private:
 	struct PacketSublist *_sublists;	/**< An array of PacketSublist structures which is _sublistCount elements long */
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA nodes the sublists are grouped by (1 if the lists are not NUMA-aware) */
+	uintptr_t _sublistsPerNode; /**< the number of sublists owned by each NUMA node (_sublistCount == _nodeCount * _sublistsPerNode) */
 	volatile uintptr_t _count;  /**< Number of items in the list */
 	
 /* Functionality Section */
@@ -100,7 +102,91 @@ private:
 	MMINLINE uintptr_t
 	getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return (getNodeIndex(env) * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
+	}
+
+	/**
+	 * Determine which group of sublists belongs to the NUMA node of the specified environment
+	 *
+	 * @param env the current environment
+	 *
+	 * @return the index of the node's group of sublists
+	 */
+	MMINLINE uintptr_t
+	getNodeIndex(MM_EnvironmentBase *env)
+	{
+		return env->_workPacketNodeIndex % _nodeCount;
+	}
+
+	/**
+	 * Determine the sublist a packet should be pushed back onto: the one it was last on,
+	 * or the calling thread's if it has never been on a list.
+	 *
+	 * @param env the current environment
+	 * @param packet the packet to push
+	 *
+	 * @return an index into the _sublists array
+	 */
+	MMINLINE uintptr_t
+	getHomeSublistIndex(MM_EnvironmentBase *env, MM_Packet *packet)
+	{
+		uintptr_t index = packet->getSublistIndex();
+		if (index >= _sublistCount) {
+			index = getSublistIndex(env);
+		}
+		return index;
+	}
+
+	/**
+	 * Push a list of packets onto one sublist.
+	 *
+	 * @param index the index of the sublist in the _sublists array
+	 * @param head The first entry in the list
+	 * @param tail The last entry in the list
+	 * @param count The number of entries in the list
+	 */
+	void pushListOnSublist(uintptr_t index, MM_Packet *head, MM_Packet *tail, uintptr_t count);
+
+	/**
+	 * Pop a packet from one of the sublists of the given node.
+	 *
+	 * @param nodeIndex the node whose sublists are searched
+	 * @param firstSublist the offset, within the node's sublists, to start searching from
+	 *
+	 * @return a packet or NULL if all of the node's sublists are empty
+	 */
+	MMINLINE MM_Packet *
+	popFromNode(uintptr_t nodeIndex, uintptr_t firstSublist)
+	{
+		MM_Packet *packet = NULL;
+		uintptr_t offset = firstSublist;
+
+		for (uintptr_t i = 0; i < _sublistsPerNode; i++) {
+			PacketSublist *list = &_sublists[(nodeIndex * _sublistsPerNode) + offset];
+
+			if (NULL != list->_head) {
+				list->_lock.acquire();
+				if (NULL != list->_head) {
+					packet = list->_head;
+					list->_head = packet->_next;
+					decrementCount(1);
+					if (NULL == list->_head) {
+						list->_tail = NULL;
+					} else {
+						list->_head->_previous = NULL;
+					}
+				}
+				list->_lock.release();
+
+				if (NULL != packet) {
+					break;
+				}
+			}
+
+			offset = (offset + 1) % _sublistsPerNode;
+		}
+
+		return packet;
 	}
 		
 protected:
@@ -112,12 +198,14 @@ public:
 	
 	/**
 	 * Push a list of packets onto this packet list.
+	 * Each packet goes back onto the sublist it was last on, so that it stays with its NUMA node.
+	 * Packets which have never been on a list go onto the calling thread's sublist.
 	 * 
 	 * @param head The first entry in the list
 	 * @param tail The last entry in the list
 	 * @param count The number of entries in the list
 	 */
-	void pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count);
+	void pushList(MM_EnvironmentBase *env, MM_Packet *head, MM_Packet *tail, uintptr_t count);
 	
 	/**
 	 * Pop all of the entries from this packetlist into the references
@@ -162,42 +250,37 @@ public:
 	
 	/**
 	 * Pop a packet off of the packetList.
+	 * The sublists of the calling thread's NUMA node are searched first, and
+	 * the sublists of remote nodes only once the local ones are exhausted.
 	 *
 	 * @return packet The packet to put on the list
 	 */
 	MMINLINE MM_Packet *pop(MM_EnvironmentBase *env)
 	{
-		uintptr_t index = getSublistIndex(env);
-		MM_Packet *packet = NULL;
-
-		for (uintptr_t i = 0; i < _sublistCount; i++) {
-			PacketSublist *list = &_sublists[index];
+		uintptr_t localNode = getNodeIndex(env);
+		uintptr_t firstSublist = env->getEnvironmentId() % _sublistsPerNode;
+		MM_Packet *packet = popFromNode(localNode, firstSublist);
 
-			if (NULL != list->_head) {
-				list->_lock.acquire();
-				if (NULL != list->_head) {
-					packet = list->_head;
-					list->_head = packet->_next;
-					decrementCount(1);
-					if (NULL == list->_head) {
-						list->_tail = NULL;
-					} else {
-						list->_head->_previous = NULL;
-					}		
-				}
-				list->_lock.release();
-
-				if (NULL != packet) {
-					break;
-				}
-			}
-			
-			index = (index + 1) %  _sublistCount;
+		for (uintptr_t i = 1; (NULL == packet) && (i < _nodeCount); i++) {
+			packet = popFromNode((localNode + i) % _nodeCount, firstSublist);
 		}
 
 		return packet;
 	}
-	
+
+	/**
+	 * Determine if the specified packet was last put on a sublist owned by
+	 * a NUMA node other than that of the calling thread.
+	 *
+	 * @param packet a packet popped from the receiver
+	 *
+	 * @return true if the packet came from a remote node's sublist, false otherwise
+	 */
+	MMINLINE bool isFromRemoteNode(MM_EnvironmentBase *env, MM_Packet *packet)
+	{
+		return (packet->getSublistIndex() / _sublistsPerNode) != getNodeIndex(env);
+	}
+
 	/**
 	 * Check to see if the list is empty
 	 *
@@ -234,6 +317,8 @@ public:
 		MM_BaseNonVirtual()
 		,_sublists(NULL)
 		,_sublistCount(0)
+		,_nodeCount(1)
+		,_sublistsPerNode(0)
 		,_count(0)
 	{
 		_typeId = __FUNCTION__;
@@ -76,6 +76,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setSlaveID(slaveID);
 	/* Enviroment initialization specific for GC threads (after slave ID is set) */
 	env->initializeGCThread();
+	dispatcher->assignWorkPacketNode(env);
 
 	/* Signal that the thread was created succesfully */
 	slaveInfo->slaveFlags = SLAVE_INFO_FLAG_OK;
@@ -151,15 +152,35 @@ void
 MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env) 
 {
 	uintptr_t slaveID = env->getSlaveID();
+	bool canPark = true;
 	
 	setThreadInitializationComplete(env);
 	
 	omrthread_monitor_enter(_slaveThreadMutex);
 
 	while(slave_status_dying != _statusTable[slaveID]) {
-		/* Wait for a task to be dispatched to the slave thread */
+		/* Wait for a task to be dispatched to the slave thread. The thread parks rather than waiting on
+		 * the mutex, so that dispatching a task wakes only the threads reserved for it (see wakeUpThreads()).
+		 * An unpark which comes before the park is not lost, and spurious returns are caught by the loop.
+		 */
 		while(slave_status_waiting == _statusTable[slaveID]) {
-			omrthread_monitor_wait(_slaveThreadMutex);
+			if (canPark) {
+				omrthread_monitor_exit(_slaveThreadMutex);
+				intptr_t parkResult = omrthread_park(0, 0);
+				omrthread_monitor_enter(_slaveThreadMutex);
+				/* Park returns at once while the thread is interrupted, clear the interrupt so that the next park blocks.
+				 * An abort cannot be cleared, an aborted thread waits on the mutex like it did before threads parked.
+				 */
+				if (J9THREAD_INTERRUPTED == parkResult) {
+					omrthread_clear_interrupted();
+				} else if (J9THREAD_PRIORITY_INTERRUPTED == parkResult) {
+					canPark = (0 != omrthread_clear_priority_interrupted());
+				}
+			} else {
+				_slaveThreadsWaitingOnMutex += 1;
+				omrthread_monitor_wait(_slaveThreadMutex);
+				_slaveThreadsWaitingOnMutex -= 1;
+			}
 		}
 
 		if(slave_status_reserved == _statusTable[slaveID]) {
@@ -270,6 +291,10 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if (!initializePhaseTimelines(env, _threadCountMaximum)) {
+		goto error_no_memory;
+	}
+
 	return true;
 
 error_no_memory:
@@ -309,6 +334,7 @@ MM_ParallelDispatcher::startUpThreads()
 				J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
 		if (threadForkResult != 0) {
 			/* Thread creation failed - for safety sake, set the shutdown flag to true */
+			_threadTable[slaveThreadCount] = NULL;
 			goto error;
 		}
 		do {
@@ -319,6 +345,8 @@ MM_ParallelDispatcher::startUpThreads()
 		} while (!slaveInfo.slaveFlags);
 
 		if(slaveInfo.slaveFlags != SLAVE_INFO_FLAG_OK ) {
+			/* The thread has exited, it must not be woken up by the shutdown */
+			_threadTable[slaveThreadCount] = NULL;
 			goto error;
 		}
 
@@ -368,7 +396,7 @@ MM_ParallelDispatcher::shutDownThreads()
 	/* making them the master in a single threaded GC */
 	_threadCount = 1;
 
-	wakeUpThreads(_threadShutdownCount);
+	wakeUpThreads(_threadCountMaximum);
 	omrthread_monitor_exit(_slaveThreadMutex);
 
 	omrthread_monitor_enter(_dispatcherMonitor);
@@ -379,15 +407,23 @@ MM_ParallelDispatcher::shutDownThreads()
 }
 
 /**
- * Wake up at least the first <code>count</code> slave threads.
- * In this implementation, since slaveThreadEntryPoint() allows a thread to
- * go back to sleep if it wasn't selected, we can wake them all up. This
- * may not apply to all subclasses though.
+ * Wake up the first <code>count</code> slave threads.
+ * Each slave thread parks while it waits for a task (see slaveEntryPoint()), so only
+ * the threads reserved for the task are woken; the others stay parked.
+ * @note The caller must hold the _slaveThreadMutex
  */
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
-	omrthread_monitor_notify_all(_slaveThreadMutex);	
+	for (uintptr_t index = 0; index < count; index++) {
+		/* the master thread is the caller, unless the dispatcher started one */
+		if (NULL != _threadTable[index]) {
+			omrthread_unpark(_threadTable[index]);
+		}
+	}
+	if (0 != _slaveThreadsWaitingOnMutex) {
+		omrthread_monitor_notify_all(_slaveThreadMutex);
+	}
 }
 
 /**
@@ -418,6 +454,26 @@ MM_ParallelDispatcher::recomputeActiveThreadCount(MM_EnvironmentBase *env)
 	_activeThreadCount = adjustThreadCount(_threadCount);
 }
 
+uintptr_t
+MM_ParallelDispatcher::adjustThreadCountForWork(uintptr_t maxThreadCount, uintptr_t expectedWorkSize)
+{
+	uintptr_t toReturn = maxThreadCount;
+	uintptr_t minimumWorkPerThread = _extensions->gcThreadMinimumWork;
+
+	/* As with the heap size, a user specified number of gc threads is used, unless the minimum work is specified as well */
+	bool threadCountForced = _extensions->gcThreadCountForced && !_extensions->gcThreadMinimumWorkForced;
+	if (!threadCountForced && (0 != minimumWorkPerThread) && (UDATA_MAX != expectedWorkSize)) {
+		/* Threads beyond the amount of work available only add to the synchronization and stall time of the task */
+		uintptr_t maximumThreadsForWork = (expectedWorkSize > minimumWorkPerThread) ? expectedWorkSize / minimumWorkPerThread : 1;
+		if (maximumThreadsForWork < maxThreadCount) {
+			Trc_MM_ParallelDispatcher_adjustThreadCount_smallWork(maximumThreadsForWork, expectedWorkSize);
+			toReturn = maximumThreadsForWork;
+		}
+	}
+
+	return toReturn;
+}
+
 uintptr_t 
 MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 {
@@ -464,6 +520,7 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 		 * a GC cycle. It may not be safe to do so at the beginning of a task
 		 */	
 		recomputeActiveThreadCount(env);
+		_activeThreadCount = adjustThreadCountForWork(_activeThreadCount, task->getExpectedWorkSize());
 	}
 
 	task->setThreadCount(_activeThreadCount);
@@ -541,6 +598,27 @@ MM_ParallelDispatcher::setThreadInitializationComplete(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_dispatcherMonitor);
 }
 
+void
+MM_ParallelDispatcher::assignWorkPacketNode(MM_EnvironmentBase *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t nodeCount = numaManager->getAffinityLeaderCount();
+	uintptr_t nodeIndex = 0;
+
+	if (_extensions->numaAwareWorkPackets && (1 < nodeCount)) {
+		nodeIndex = UDATA_MAX;
+		if (numaManager->isPhysicalNUMASupported()) {
+			nodeIndex = numaManager->getAffinityLeaderIndex(env->getNumaAffinity());
+		}
+		if (UDATA_MAX == nodeIndex) {
+			/* no (usable) affinity - spread the threads evenly across the nodes */
+			nodeIndex = env->getSlaveID() % nodeCount;
+		}
+	}
+
+	env->_workPacketNodeIndex = nodeIndex;
+}
+
 void
 MM_ParallelDispatcher::reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount)
 {
@@ -72,6 +72,7 @@ protected:
 	
 	bool _slaveThreadsReservedForGC;  /**< States whether or not the slave threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
+	uintptr_t _slaveThreadsWaitingOnMutex; /**< number of idle slave threads waiting on _slaveThreadMutex because they can no longer park (see slaveEntryPoint()) */
 
 	uintptr_t _threadCountMaximum; /**< maximum threadcount - this is the size of the thread tables etc */
 	uintptr_t _threadCount; /**< number of threads currently forked */
@@ -106,13 +107,36 @@ protected:
 	
 	virtual void acceptTask(MM_EnvironmentBase *env);
 	virtual void completeTask(MM_EnvironmentBase *env);
+	/**
+	 * Wake up the idle slave threads _threadTable[0..count) by unparking them. Unlike a notify of
+	 * _slaveThreadMutex, threads at or above count are not woken: a subclass which changes the status
+	 * of another slave thread must wake it, by including it in count or by overriding this method.
+	 * Threads waiting on _slaveThreadMutex because they cannot park are notified as well.
+	 * @note The caller must hold the _slaveThreadMutex
+	 */
 	virtual void wakeUpThreads(uintptr_t count);
 
 	virtual void recomputeActiveThreadCount(MM_EnvironmentBase *env);
 	
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
+
+	/**
+	 * Choose the NUMA node whose work packet lists the given GC thread will prefer.
+	 * The thread's own node affinity is used when NUMA is physically supported, otherwise
+	 * threads are spread round-robin across the affinity leaders.
+	 */
+	void assignWorkPacketNode(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Limit the number of threads a task is dispatched to by the amount of work it expects,
+	 * so that each thread has at least -Xgc:gcThreadMinimumWork= bytes to process.
+	 * @param maxThreadCount the number of threads the task could be dispatched to
+	 * @param expectedWorkSize the work the task expects, see MM_Task::getExpectedWorkSize()
+	 * @return the number of threads to dispatch the task to
+	 */
+	uintptr_t adjustThreadCountForWork(uintptr_t maxThreadCount, uintptr_t expectedWorkSize);
 	
 public:
 	virtual bool startUpThreads();
@@ -144,6 +168,7 @@ public:
 		,_synchronizeMutex(NULL)
 		,_slaveThreadsReservedForGC(false)
 		,_inShutdown(false)
+		,_slaveThreadsWaitingOnMutex(0)
 		,_threadCountMaximum(1)
 		,_threadCount(1)
 		,_activeThreadCount(1)
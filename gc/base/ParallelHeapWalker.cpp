@@ -52,6 +52,7 @@ private:
 	MM_HeapWalkerObjectFunc _function;
 	void *_userData;
 	uintptr_t _walkFlags;
+	bool _markMapPrepared; /**< True if the heap was prepared for this walk, so the mark map holds every object in the heap */
 
 	MM_ParallelHeapWalker *_heapWalker;
 
@@ -69,11 +70,52 @@ public:
 	/*
 	 * Create a ParallelObjectAndVMSlotsDoTask object.
 	 */
-	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel)
+	MM_ParallelObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool markMapPrepared)
 		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
 		, _function(function)
 		, _userData(userData)
 		, _walkFlags(walkFlags)
+		, _markMapPrepared(markMapPrepared)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Task walking the heap in parallel for MM_ParallelHeapWalker::allObjectsBatchDo()
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectBatchDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapWalkerObjectBatchFunc _function;
+	void *_userData;
+	uintptr_t _walkFlags;
+	bool _markMapPrepared; /**< True if the heap was prepared for this walk, so the mark map holds every object in the heap */
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelObjectBatchDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool markMapPrepared)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _walkFlags(walkFlags)
+		, _markMapPrepared(markMapPrepared)
 		, _heapWalker(heapWalker)
 	{
 		_typeId = __FUNCTION__;
@@ -100,19 +142,14 @@ MM_ParallelHeapWalker::newInstance(MM_ParallelGlobalGC *globalCollector, MM_Mark
  * Walk through all live objects of the heap in parallel and apply the provided function.
  */
 void
-MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool markMapPrepared)
 {
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Entry(env->getLanguageVMThread());
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
 	/* determine the size of the segment chunks to use for parallel walks */
-	uintptr_t threadCount = env->_currentTask->getThreadCount();
 	uintptr_t heapChunkFactor = 1;
-	if ((threadCount > 1) && _markMap->isMarkMapValid()) {
-		heapChunkFactor = threadCount * 8;
-	}
-	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
-	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+	uintptr_t parallelChunkSize = getParallelChunkSize(env, markMapPrepared, &heapChunkFactor);
 
 	/* Perform the parallel object heap iteration */
 	uintptr_t objectsWalked = 0;
@@ -137,6 +174,70 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked);
 }
 
+/**
+ * Walk through all live objects of the heap in parallel, collecting them into a buffer on each thread
+ * and applying the provided function to each batch of objects.
+ */
+void
+MM_ParallelHeapWalker::allObjectsBatchDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool markMapPrepared)
+{
+	Trc_MM_ParallelHeapWalker_allObjectsBatchDoParallel_Entry(env->getLanguageVMThread());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	uintptr_t heapChunkFactor = 1;
+	uintptr_t parallelChunkSize = getParallelChunkSize(env, markMapPrepared, &heapChunkFactor);
+
+	uintptr_t objectsWalked = 0;
+	uintptr_t batchCount = 0;
+	omrobjectptr_t batch[PARALLEL_HEAP_WALKER_BATCH_SIZE];
+	MM_Heap *heap = extensions->heap;
+	MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
+			uintptr_t batchSize = 0;
+			omrobjectptr_t object = NULL;
+			while ((object = objectHeapIterator.nextObject()) != NULL) {
+				batch[batchSize] = object;
+				batchSize += 1;
+				if (PARALLEL_HEAP_WALKER_BATCH_SIZE == batchSize) {
+					function(omrVMThread, region, batch, batchSize, userData);
+					objectsWalked += batchSize;
+					batchCount += 1;
+					batchSize = 0;
+				}
+			}
+			/* batches do not span regions */
+			if (0 != batchSize) {
+				function(omrVMThread, region, batch, batchSize, userData);
+				objectsWalked += batchSize;
+				batchCount += 1;
+			}
+		}
+	}
+	regionManager->unlock();
+	Trc_MM_ParallelHeapWalker_allObjectsBatchDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor, parallelChunkSize, objectsWalked, batchCount);
+}
+
+uintptr_t
+MM_ParallelHeapWalker::getParallelChunkSize(MM_EnvironmentBase *env, bool markMapPrepared, uintptr_t *heapChunkFactor)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+
+	*heapChunkFactor = 1;
+	if ((threadCount > 1) && (markMapPrepared || _markMap->isMarkMapValid())) {
+		*heapChunkFactor = threadCount * 8;
+	}
+	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / *heapChunkFactor;
+	return MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+}
+
 /**
  * Walk through all live objects of the heap and apply the provided function.
  * If parallel is set to true, task is dispatched to GC threads and walks the heap segments in parallel,
@@ -151,18 +252,45 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 			_globalCollector->prepareHeapForWalk(env);
 		}
 
-		MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, parallel);
+		MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, parallel, prepareHeapForWalk);
+		/* The walk visits every object of the whole active heap */
+		objectDoTask.setExpectedWorkSize(env->getExtensions()->heap->getActiveMemorySize());
 		env->getExtensions()->dispatcher->run(env, &objectDoTask);
 	} else {
 		MM_HeapWalker::allObjectsDo(env, function, userData, walkFlags, parallel, prepareHeapForWalk);
 	}
 }
 
+/**
+ * Walk through all live objects of the heap on the GC threads, applying the provided function to batches of objects.
+ */
+void
+MM_ParallelHeapWalker::allObjectsBatchDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+	}
+
+	MM_ParallelObjectBatchDoTask objectBatchDoTask(env, this, function, userData, walkFlags, prepareHeapForWalk);
+	objectBatchDoTask.setExpectedWorkSize(env->getExtensions()->heap->getActiveMemorySize());
+	env->getExtensions()->dispatcher->run(env, &objectBatchDoTask);
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
 void
 MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
-	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
+	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags, _markMapPrepared);
+}
+
+/**
+ * gets the heap walker and calls the actual batched walk
+ */
+void
+MM_ParallelObjectBatchDoTask::run(MM_EnvironmentBase *env)
+{
+	_heapWalker->allObjectsBatchDoParallel(env, _function, _userData, _walkFlags, _markMapPrepared);
 }
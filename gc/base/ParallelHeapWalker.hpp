@@ -32,6 +32,16 @@ class MM_EnvironmentBase;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+/* Number of objects a thread collects before passing them to the function of a batched walk */
+#define PARALLEL_HEAP_WALKER_BATCH_SIZE 256
+
+/**
+ * Function applied by a batched walk to the objects walked, a batch at a time. The objects of a batch all belong
+ * to the same region, in address order. The function is called by all of the threads walking the heap at the same
+ * time, so it must be thread safe.
+ */
+typedef void (*MM_HeapWalkerObjectBatchFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t *, uintptr_t, void *);
+
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
@@ -47,12 +57,19 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Determine the size of the chunks the regions are divided into for a parallel walk: regions are only divided
+	 * if the mark map holds every object in the heap, as it is used to find the first object of each chunk.
+	 * @param markMapPrepared[in] True if the heap was prepared for this walk, otherwise the mark map is used only while it is valid
+	 */
+	uintptr_t getParallelChunkSize(MM_EnvironmentBase *env, bool markMapPrepared, uintptr_t *heapChunkFactor);
 protected:
 public:	
 	/**
 	 * Walk through all live objects of the heap in parallel and apply the provided function.
+	 * @param markMapPrepared[in] True if the heap was prepared for this walk
 	 */
-	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
+	void allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool markMapPrepared = false);
 
 	/**
 	 * Walk through all live objects of the heap and apply the provided function.
@@ -61,6 +78,21 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Walk through all live objects of the heap in parallel, collecting them into a buffer on each thread
+	 * and applying the provided function to each batch of objects.
+	 * @param markMapPrepared[in] True if the heap was prepared for this walk
+	 */
+	void allObjectsBatchDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool markMapPrepared);
+
+	/**
+	 * Walk through all live objects of the heap on the GC threads, applying the provided function to batches of
+	 * up to PARALLEL_HEAP_WALKER_BATCH_SIZE objects. The regions are divided into chunks which the threads walk
+	 * in parallel, so the function must be thread safe; batching keeps its synchronization off the per object path.
+	 * The caller must have exclusive VM access.
+	 */
+	void allObjectsBatchDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectBatchFunc function, void *userData, uintptr_t walkFlags, bool prepareHeapForWalk);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +117,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelObjectBatchDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
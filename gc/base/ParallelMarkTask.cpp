@@ -31,6 +31,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "MarkingScheme.hpp"
+#include "PhaseTimeline.hpp"
 #include "WorkStack.hpp"
 
 
@@ -43,14 +44,28 @@ MM_ParallelMarkTask::getVMStateID()
 void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
-	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
+	MM_PhaseTimeline *timeline = env->_phaseTimeline;
+
+	env->_workStack.prepareForParallelWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
 
 	_markingScheme->markLiveObjectsInit(env, _initMarkMap);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "mark init");
+	}
 	_markingScheme->markLiveObjectsRoots(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "mark roots");
+	}
 	_markingScheme->markLiveObjectsScan(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "mark scan");
+	}
 	_markingScheme->markLiveObjectsComplete(env);
 
 	env->_workStack.flush(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "mark complete");
+	}
 }
 
 void
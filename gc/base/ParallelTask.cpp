@@ -30,6 +30,7 @@
 #include "AtomicOperations.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
+#include "PhaseTimeline.hpp"
 
 #include "ModronAssertions.h"
 
@@ -77,6 +78,10 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_PhaseTimeline *timeline = env->_phaseTimeline;
+		uint64_t stallStartTime = (NULL != timeline) ? omrtime_hires_clock() : 0;
+
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -105,6 +110,9 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
+		if (NULL != timeline) {
+			timeline->record(MM_PhaseTimeline::event_sync_stall, id, stallStartTime, omrtime_hires_clock());
+		}
 	}
 
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
@@ -114,11 +122,18 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id)
 {
 	bool isMasterThread = false;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_PhaseTimeline *timeline = env->_phaseTimeline;
+	uint64_t stallStartTime = 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
+		if (NULL != timeline) {
+			stallStartTime = omrtime_hires_clock();
+		}
+
 		volatile uintptr_t index = _synchronizeIndex;
 
 		omrthread_monitor_enter(_synchronizeMutex);
@@ -161,6 +176,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, c
 	}
 
 done:
+	if ((NULL != timeline) && (1 < _totalThreadCount)) {
+		timeline->record(MM_PhaseTimeline::event_sync_stall, id, stallStartTime, omrtime_hires_clock());
+	}
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Exit(env->getLanguageVMThread());
 	return isMasterThread;	
 }
@@ -169,11 +187,18 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
 {
 	bool isReleasedThread = false;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_PhaseTimeline *timeline = env->_phaseTimeline;
+	uint64_t stallStartTime = 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
+		if (NULL != timeline) {
+			stallStartTime = omrtime_hires_clock();
+		}
+
 		volatile uintptr_t index = _synchronizeIndex;
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
 
@@ -208,6 +233,9 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	}
 
 done:
+	if ((NULL != timeline) && (1 < _totalThreadCount)) {
+		timeline->record(MM_PhaseTimeline::event_sync_stall, id, stallStartTime, omrtime_hires_clock());
+	}
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Exit(env->getLanguageVMThread());
 	return isReleasedThread;
 }
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include <stdarg.h>
+
+#include "omrport.h"
+
+#include "PhaseTimelineRecorder.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/* Longest formatted trace text, excluding names */
+#define PHASE_TIMELINE_TRACE_TEXT_MAXIMUM 256
+
+static const char *eventCategories[] = {
+	"task", /* event_task */
+	"phase", /* event_phase */
+	"sync-stall", /* event_sync_stall */
+	"work-stall", /* event_work_stall */
+	"complete-stall" /* event_complete_stall */
+};
+
+MM_PhaseTimelineRecorder *
+MM_PhaseTimelineRecorder::newInstance(MM_EnvironmentBase *env, uintptr_t threadCount)
+{
+	MM_PhaseTimelineRecorder *recorder = (MM_PhaseTimelineRecorder *)env->getForge()->allocate(sizeof(MM_PhaseTimelineRecorder), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != recorder) {
+		new(recorder) MM_PhaseTimelineRecorder(threadCount);
+		if (!recorder->initialize(env)) {
+			recorder->kill(env);
+			recorder = NULL;
+		}
+	}
+	return recorder;
+}
+
+void
+MM_PhaseTimelineRecorder::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_PhaseTimelineRecorder::initialize(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_timelines = (MM_PhaseTimeline *)env->getForge()->allocate(_timelineCount * sizeof(MM_PhaseTimeline), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _timelines) {
+		_timelineCount = 0;
+		return false;
+	}
+	for (uintptr_t slaveID = 0; slaveID < _timelineCount; slaveID++) {
+		new(&_timelines[slaveID]) MM_PhaseTimeline();
+	}
+	for (uintptr_t slaveID = 0; slaveID < _timelineCount; slaveID++) {
+		if (!_timelines[slaveID].initialize(env, extensions->gcPhaseTimelineSize)) {
+			return false;
+		}
+	}
+
+	_baseTime = omrtime_hires_clock();
+
+	if (NULL != extensions->gcPhaseTraceFileName) {
+		_traceFile = omrfile_open(extensions->gcPhaseTraceFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _traceFile) {
+			omrtty_printf("Failed to open GC phase trace file %s\n", extensions->gcPhaseTraceFileName);
+			return false;
+		}
+		writeTraceText(env, "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GC\"}}");
+		for (uintptr_t slaveID = 0; slaveID < _timelineCount; slaveID++) {
+			writeTraceText(env, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"GC thread %zu\"}}", slaveID, slaveID);
+		}
+	}
+
+	return true;
+}
+
+void
+MM_PhaseTimelineRecorder::tearDown(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (-1 != _traceFile) {
+		/* events recorded by concurrent tasks since the last collection */
+		flush(env);
+		writeTraceText(env, "\n]\n");
+		flushTraceBuffer(env);
+		omrfile_close(_traceFile);
+		_traceFile = -1;
+	}
+
+	if (NULL != _timelines) {
+		for (uintptr_t slaveID = 0; slaveID < _timelineCount; slaveID++) {
+			_timelines[slaveID].tearDown(env);
+		}
+		env->getForge()->free(_timelines);
+		_timelines = NULL;
+	}
+}
+
+void
+MM_PhaseTimelineRecorder::flush(MM_EnvironmentBase *env)
+{
+	for (uintptr_t slaveID = 0; slaveID < _timelineCount; slaveID++) {
+		MM_PhaseTimeline *timeline = &_timelines[slaveID];
+		if (-1 != _traceFile) {
+			writeTraceEvents(env, slaveID, timeline);
+		}
+		timeline->reset();
+	}
+	if (-1 != _traceFile) {
+		flushTraceBuffer(env);
+	}
+}
+
+void
+MM_PhaseTimelineRecorder::writeTraceEvents(MM_EnvironmentBase *env, uintptr_t slaveID, MM_PhaseTimeline *timeline)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	for (uintptr_t index = 0; index < timeline->getCount(); index++) {
+		MM_PhaseTimeline::Event *event = timeline->getEvent(index);
+		uint64_t startNanos = omrtime_hires_delta(_baseTime, event->startTime, OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		uint64_t durationNanos = omrtime_hires_delta(event->startTime, event->endTime, OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+		writeTraceText(env, ",\n{\"name\":\"");
+		writeTraceString(env, event->name);
+		writeTraceText(env, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%llu.%03llu,\"dur\":%llu.%03llu,\"pid\":1,\"tid\":%zu}",
+			eventCategories[event->type], startNanos / 1000, startNanos % 1000, durationNanos / 1000, durationNanos % 1000, slaveID);
+	}
+	if (0 != timeline->getDroppedCount()) {
+		uint64_t nowNanos = omrtime_hires_delta(_baseTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		writeTraceText(env, ",\n{\"name\":\"events dropped\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%llu.%03llu,\"pid\":1,\"tid\":%zu,\"args\":{\"count\":%zu}}",
+			nowNanos / 1000, nowNanos % 1000, slaveID, timeline->getDroppedCount());
+	}
+}
+
+void
+MM_PhaseTimelineRecorder::writeTraceString(MM_EnvironmentBase *env, const char *string)
+{
+	for (const char *cursor = string; '\0' != *cursor; cursor++) {
+		if ((_traceBufferUsed + 2) > sizeof(_traceBuffer)) {
+			flushTraceBuffer(env);
+		}
+		char c = *cursor;
+		if (('"' == c) || ('\\' == c)) {
+			_traceBuffer[_traceBufferUsed++] = '\\';
+			_traceBuffer[_traceBufferUsed++] = c;
+		} else if ((unsigned char)c >= ' ') {
+			_traceBuffer[_traceBufferUsed++] = c;
+		}
+	}
+}
+
+void
+MM_PhaseTimelineRecorder::writeTraceText(MM_EnvironmentBase *env, const char *format, ...)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if ((_traceBufferUsed + PHASE_TIMELINE_TRACE_TEXT_MAXIMUM) > sizeof(_traceBuffer)) {
+		flushTraceBuffer(env);
+	}
+
+	va_list args;
+	va_start(args, format);
+	_traceBufferUsed += omrstr_vprintf(_traceBuffer + _traceBufferUsed, sizeof(_traceBuffer) - _traceBufferUsed, format, args);
+	va_end(args);
+}
+
+void
+MM_PhaseTimelineRecorder::flushTraceBuffer(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 != _traceBufferUsed) {
+		omrfile_write(_traceFile, _traceBuffer, _traceBufferUsed);
+		_traceBufferUsed = 0;
+	}
+}
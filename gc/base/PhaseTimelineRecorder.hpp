@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(PHASETIMELINERECORDER_HPP_)
+#define PHASETIMELINERECORDER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+#include "PhaseTimeline.hpp"
+
+class MM_EnvironmentBase;
+
+#define PHASE_TIMELINE_TRACE_BUFFER_SIZE 4096
+
+/**
+ * Owns the phase timelines of the GC threads of a dispatcher, one per slave ID. A thread records into its
+ * timeline while it runs a task (see MM_Task::accept()); the timelines are flushed at the start and at the end
+ * of every collection, so that between the two they describe only the collection. Flushing appends the
+ * events to the trace file, if one was requested with -Xgc:gcPhaseTraceFile=, in the Chrome trace event JSON
+ * array format, which Perfetto and chrome://tracing load even when the closing bracket is missing.
+ * @ingroup GC_Base_Core
+ */
+class MM_PhaseTimelineRecorder : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	MM_PhaseTimeline *_timelines; /**< timelines indexed by slave ID */
+	uintptr_t _timelineCount; /**< number of entries in _timelines */
+	intptr_t _traceFile; /**< trace file descriptor, -1 if no trace is written */
+	uint64_t _baseTime; /**< hi-res clock value trace timestamps are relative to */
+	char _traceBuffer[PHASE_TIMELINE_TRACE_BUFFER_SIZE]; /**< trace output not yet written to the file */
+	uintptr_t _traceBufferUsed; /**< number of bytes used in _traceBuffer */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Append the events of a timeline to the trace.
+	 */
+	void writeTraceEvents(MM_EnvironmentBase *env, uintptr_t slaveID, MM_PhaseTimeline *timeline);
+
+	/**
+	 * Append a string to the trace, escaping it as a JSON string body.
+	 */
+	void writeTraceString(MM_EnvironmentBase *env, const char *string);
+
+	/**
+	 * Append formatted text to the trace.
+	 */
+	void writeTraceText(MM_EnvironmentBase *env, const char *format, ...);
+
+	/**
+	 * Write the buffered trace output to the file.
+	 */
+	void flushTraceBuffer(MM_EnvironmentBase *env);
+
+protected:
+public:
+	static MM_PhaseTimelineRecorder *newInstance(MM_EnvironmentBase *env, uintptr_t threadCount);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Append the recorded events to the trace file, then reset all timelines.
+	 * Must only be called while no task is running.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getTimelineCount() { return _timelineCount; }
+	MMINLINE MM_PhaseTimeline *getTimeline(uintptr_t slaveID) { return &_timelines[slaveID]; }
+
+	MM_PhaseTimelineRecorder(uintptr_t threadCount) :
+		MM_BaseNonVirtual()
+		,_timelines(NULL)
+		,_timelineCount(threadCount)
+		,_traceFile(-1)
+		,_baseTime(0)
+		,_traceBufferUsed(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PHASETIMELINERECORDER_HPP_ */
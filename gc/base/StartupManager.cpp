@@ -37,19 +37,104 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACTSUMMARYCHUNKSIZE "-Xgc:compactSummaryChunkSize="
+#define OMR_XGCCOMPACTSUMMARYCHUNKSIZE_LENGTH 29
+#define OMR_XGCCOMPACTSUMMARYTABLE "-Xgc:compactSummaryTable"
+#define OMR_XGCCOMPACTSUMMARYTABLE_LENGTH 24
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
 #define OMR_GCPOLICY_GENCON "gencon"
 #define OMR_GCPOLICY_GENCON_LENGTH 6
+#define OMR_XGCSCVHOTFIELDCOPYDEPTH "-Xgc:scvHotFieldCopyDepth="
+#define OMR_XGCSCVHOTFIELDCOPYDEPTH_LENGTH 26
+#define OMR_XGCSCVHOTFIELDCOPY "-Xgc:scvHotFieldCopy"
+#define OMR_XGCSCVHOTFIELDCOPY_LENGTH 20
+#define OMR_XGCSCVTENUREDECAYWINDOW "-Xgc:scvTenureDecayWindow="
+#define OMR_XGCSCVTENUREDECAYWINDOW_LENGTH 26
+#define OMR_XGCSCVTENURESTRATEGYDECAY "-Xgc:scvTenureStrategyDecay"
+#define OMR_XGCSCVTENURESTRATEGYDECAY_LENGTH 27
+#define OMR_XGCSCVREMEMBEREDSETCARDS "-Xgc:scvRememberedSetCards"
+#define OMR_XGCSCVREMEMBEREDSETCARDS_LENGTH 26
+#define OMR_XGCSCVPAUSETARGET "-Xgc:scvPauseTarget="
+#define OMR_XGCSCVPAUSETARGET_LENGTH 20
+#define OMR_XGCSCVOVERHEADTARGET "-Xgc:scvOverheadTarget="
+#define OMR_XGCSCVOVERHEADTARGET_LENGTH 23
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCONCURRENTEVACUATIONAREASIZE "-Xgc:concurrentEvacuationAreaSize="
+#define OMR_XGCCONCURRENTEVACUATIONAREASIZE_LENGTH 34
+#define OMR_XGCCONCURRENTEVACUATIONLIVETHRESHOLD "-Xgc:concurrentEvacuationLiveThreshold="
+#define OMR_XGCCONCURRENTEVACUATIONLIVETHRESHOLD_LENGTH 39
+#define OMR_XGCCONCURRENTEVACUATIONMAXAREAS "-Xgc:concurrentEvacuationMaxAreas="
+#define OMR_XGCCONCURRENTEVACUATIONMAXAREAS_LENGTH 34
+#define OMR_XGCCONCURRENTEVACUATION "-Xgc:concurrentEvacuation"
+#define OMR_XGCCONCURRENTEVACUATION_LENGTH 25
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCLAZYSWEEP "-Xgc:lazySweep"
+#define OMR_XGCLAZYSWEEP_LENGTH 14
+#define OMR_XGCALLOCATIONMAGAZINES "-Xgc:allocationMagazines="
+#define OMR_XGCALLOCATIONMAGAZINES_LENGTH 25
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #define OMR_XVERBOSEGCLOG "-Xverbosegclog:"
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCVERBOSERINGBUFFERSIZE "-Xgc:verboseRingBufferSize="
+#define OMR_XGCVERBOSERINGBUFFERSIZE_LENGTH 27
+#define OMR_XGCGCPHASETIMELINESIZE "-Xgc:gcPhaseTimelineSize="
+#define OMR_XGCGCPHASETIMELINESIZE_LENGTH 25
+#define OMR_XGCGCPHASETIMELINE "-Xgc:gcPhaseTimeline"
+#define OMR_XGCGCPHASETIMELINE_LENGTH 20
+#define OMR_XGCGCPHASETRACEFILE "-Xgc:gcPhaseTraceFile="
+#define OMR_XGCGCPHASETRACEFILE_LENGTH 22
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#define OMR_XGCGCTHREADMINIMUMWORK "-Xgc:gcThreadMinimumWork="
+#define OMR_XGCGCTHREADMINIMUMWORK_LENGTH 25
+#define OMR_XGCNONUMAAWAREWORKPACKETS "-Xgc:noNumaAwareWorkPackets"
+#define OMR_XGCNONUMAAWAREWORKPACKETS_LENGTH 27
+#define OMR_XGCWORKSTEALINGDEQUESIZE "-Xgc:workStealingDequeSize="
+#define OMR_XGCWORKSTEALINGDEQUESIZE_LENGTH 27
+#define OMR_XGCWORKSTEALINGDEQUE "-Xgc:workStealingDeque"
+#define OMR_XGCWORKSTEALINGDEQUE_LENGTH 22
+#define OMR_XGCMARKINGPREFETCHDEPTH "-Xgc:markingPrefetchDepth="
+#define OMR_XGCMARKINGPREFETCHDEPTH_LENGTH 26
+#define OMR_XGCMARKMAPCACHE "-Xgc:markMapCache"
+#define OMR_XGCMARKMAPCACHE_LENGTH 17
+#define OMR_XGCTLHADAPTIVEREFRESHINTERVAL "-Xgc:tlhAdaptiveRefreshInterval="
+#define OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH 32
+#define OMR_XGCTLHADAPTIVESIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLHADAPTIVESIZING_LENGTH 22
+#define OMR_XGCFREEENTRYQUICKLISTSIZES "-Xgc:freeEntryQuickListSizes="
+#define OMR_XGCFREEENTRYQUICKLISTSIZES_LENGTH 29
+#define OMR_XGCFREEENTRYQUICKLISTPERCENT "-Xgc:freeEntryQuickListPercent="
+#define OMR_XGCFREEENTRYQUICKLISTPERCENT_LENGTH 31
+#define OMR_XGCFREEENTRYQUICKLISTS "-Xgc:freeEntryQuickLists"
+#define OMR_XGCFREEENTRYQUICKLISTS_LENGTH 24
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+#define OMR_XGCLOASIZEBANDPERCENT "-Xgc:loaSizeBandPercent="
+#define OMR_XGCLOASIZEBANDPERCENT_LENGTH 24
+#define OMR_XGCLOASIZEBANDS "-Xgc:loaSizeBands"
+#define OMR_XGCLOASIZEBANDS_LENGTH 17
+#define OMR_XGCLOARESERVATIONCOUNT "-Xgc:loaReservationCount="
+#define OMR_XGCLOARESERVATIONCOUNT_LENGTH 25
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+#define OMR_XGCHEAPHUGEPAGES "-Xgc:heapHugePages="
+#define OMR_XGCHEAPHUGEPAGES_LENGTH 19
+#define OMR_HEAPHUGEPAGES_TRANSPARENT "transparent"
+#define OMR_HEAPHUGEPAGES_EXPLICIT "explicit"
+#define OMR_HEAPHUGEPAGES_NONE "none"
+#define OMR_XGCMEMORYMAINTENANCERATE "-Xgc:memoryMaintenanceRate="
+#define OMR_XGCMEMORYMAINTENANCERATE_LENGTH 27
+#define OMR_XGCMEMORYMAINTENANCE "-Xgc:memoryMaintenance"
+#define OMR_XGCMEMORYMAINTENANCE_LENGTH 22
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH 32
+#define OMR_XGCALLOCATIONSAMPLINGTOPSITES "-Xgc:allocationSamplingTopSites="
+#define OMR_XGCALLOCATIONSAMPLINGTOPSITES_LENGTH 32
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -263,6 +348,15 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->compactOnGlobalGC = 0;
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
+	} else if (0 == strncmp(option, OMR_XGCCOMPACTSUMMARYCHUNKSIZE, OMR_XGCCOMPACTSUMMARYCHUNKSIZE_LENGTH)) {
+		uintptr_t chunkSize = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCCOMPACTSUMMARYCHUNKSIZE_LENGTH, &chunkSize)) {
+			result = false;
+		} else {
+			extensions->compactSummaryChunkSize = chunkSize;
+		}
+	} else if (0 == strncmp(option, OMR_XGCCOMPACTSUMMARYTABLE, OMR_XGCCOMPACTSUMMARYTABLE_LENGTH)) {
+		extensions->compactSummaryTable = true;
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
@@ -276,6 +370,41 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSERINGBUFFERSIZE, OMR_XGCVERBOSERINGBUFFERSIZE_LENGTH)) {
+		uintptr_t ringBufferSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCVERBOSERINGBUFFERSIZE_LENGTH, &ringBufferSize) || (0 == ringBufferSize)) {
+			result = false;
+		} else {
+			extensions->verboseRingBufferSize = ringBufferSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCGCPHASETIMELINESIZE, OMR_XGCGCPHASETIMELINESIZE_LENGTH)) {
+		uintptr_t timelineSize = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCGCPHASETIMELINESIZE_LENGTH, &timelineSize)) || (0 == timelineSize)) {
+			result = false;
+		} else {
+			extensions->gcPhaseTimelineSize = timelineSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCGCPHASETIMELINE, OMR_XGCGCPHASETIMELINE_LENGTH)) {
+		extensions->gcPhaseTimeline = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCGCPHASETRACEFILE, OMR_XGCGCPHASETRACEFILE_LENGTH)) {
+		const char *traceFileName = option + OMR_XGCGCPHASETRACEFILE_LENGTH;
+		if (NULL != extensions->gcPhaseTraceFileName) {
+			extensions->getForge()->free(extensions->gcPhaseTraceFileName);
+			extensions->gcPhaseTraceFileName = NULL;
+		}
+		if ('\0' != *traceFileName) {
+			extensions->gcPhaseTraceFileName = (char *)extensions->getForge()->allocate(strlen(traceFileName) + 1, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		}
+		if (NULL == extensions->gcPhaseTraceFileName) {
+			result = false;
+		} else {
+			strcpy(extensions->gcPhaseTraceFileName, traceFileName);
+			extensions->gcPhaseTimeline = true;
+		}
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -287,6 +416,97 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCVHOTFIELDCOPYDEPTH, OMR_XGCSCVHOTFIELDCOPYDEPTH_LENGTH)) {
+		uintptr_t depth = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCVHOTFIELDCOPYDEPTH_LENGTH, &depth)) {
+			result = false;
+		} else {
+			extensions->scavengerHotFieldCopyDepth = depth;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCVHOTFIELDCOPY, OMR_XGCSCVHOTFIELDCOPY_LENGTH)) {
+		extensions->scavengerHotFieldCopy = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCVTENUREDECAYWINDOW, OMR_XGCSCVTENUREDECAYWINDOW_LENGTH)) {
+		uintptr_t window = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCVTENUREDECAYWINDOW_LENGTH, &window)) {
+			result = false;
+		} else {
+			extensions->scvTenureDecayWindow = window;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCVTENURESTRATEGYDECAY, OMR_XGCSCVTENURESTRATEGYDECAY_LENGTH)) {
+		extensions->scvTenureStrategyDecay = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCVREMEMBEREDSETCARDS, OMR_XGCSCVREMEMBEREDSETCARDS_LENGTH)) {
+		extensions->scavengerRememberedSetCards = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCVPAUSETARGET, OMR_XGCSCVPAUSETARGET_LENGTH)) {
+		uintptr_t pauseTarget = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCVPAUSETARGET_LENGTH, &pauseTarget)) {
+			result = false;
+		} else {
+			/* specified in milliseconds, kept in microseconds */
+			extensions->scavengerPauseTarget = pauseTarget * 1000;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCVOVERHEADTARGET, OMR_XGCSCVOVERHEADTARGET_LENGTH)) {
+		uintptr_t overheadTarget = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSCVOVERHEADTARGET_LENGTH, &overheadTarget)) || (0 == overheadTarget) || (overheadTarget > 100)) {
+			result = false;
+		} else {
+			extensions->scavengerOverheadTarget = overheadTarget;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTEVACUATIONAREASIZE, OMR_XGCCONCURRENTEVACUATIONAREASIZE_LENGTH)) {
+		uintptr_t areaSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCCONCURRENTEVACUATIONAREASIZE_LENGTH, &areaSize) || (0 == areaSize)) {
+			result = false;
+		} else {
+			extensions->concurrentEvacuationAreaSize = areaSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTEVACUATIONLIVETHRESHOLD, OMR_XGCCONCURRENTEVACUATIONLIVETHRESHOLD_LENGTH)) {
+		uintptr_t threshold = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCONCURRENTEVACUATIONLIVETHRESHOLD_LENGTH, &threshold)) || (threshold > 100)) {
+			result = false;
+		} else {
+			extensions->concurrentEvacuationLiveThreshold = threshold;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTEVACUATIONMAXAREAS, OMR_XGCCONCURRENTEVACUATIONMAXAREAS_LENGTH)) {
+		uintptr_t maxAreas = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCCONCURRENTEVACUATIONMAXAREAS_LENGTH, &maxAreas)) {
+			result = false;
+		} else {
+			extensions->concurrentEvacuationMaxAreas = maxAreas;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENTEVACUATION, OMR_XGCCONCURRENTEVACUATION_LENGTH)) {
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		extensions->concurrentEvacuation = true;
+#else /* OMR_GC_LARGE_OBJECT_AREA */
+		/* evacuation withdraws the free entries of the areas it evacuates through the LOA aware memory pool API */
+		result = false;
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCLAZYSWEEP, OMR_XGCLAZYSWEEP_LENGTH)) {
+		extensions->lazySweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATIONMAGAZINES, OMR_XGCALLOCATIONMAGAZINES_LENGTH)) {
+		uintptr_t magazineCount = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCALLOCATIONMAGAZINES_LENGTH, &magazineCount)) {
+			result = false;
+		} else {
+			extensions->allocationMagazineCount = magazineCount;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -295,6 +515,111 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
+	} else if (0 == strncmp(option, OMR_XGCGCTHREADMINIMUMWORK, OMR_XGCGCTHREADMINIMUMWORK_LENGTH)) {
+		uintptr_t minimumWork = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCGCTHREADMINIMUMWORK_LENGTH, &minimumWork)) {
+			result = false;
+		} else {
+			extensions->gcThreadMinimumWork = minimumWork;
+			extensions->gcThreadMinimumWorkForced = true;
+		}
+	} else if (0 == strncmp(option, OMR_XGCNONUMAAWAREWORKPACKETS, OMR_XGCNONUMAAWAREWORKPACKETS_LENGTH)) {
+		extensions->numaAwareWorkPackets = false;
+	} else if (0 == strncmp(option, OMR_XGCWORKSTEALINGDEQUESIZE, OMR_XGCWORKSTEALINGDEQUESIZE_LENGTH)) {
+		uintptr_t dequeSize = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCWORKSTEALINGDEQUESIZE_LENGTH, &dequeSize)) {
+			result = false;
+		} else {
+			extensions->workStealingDequeSize = dequeSize;
+		}
+	} else if (0 == strncmp(option, OMR_XGCWORKSTEALINGDEQUE, OMR_XGCWORKSTEALINGDEQUE_LENGTH)) {
+		extensions->workStealingDeque = true;
+	} else if (0 == strncmp(option, OMR_XGCMARKINGPREFETCHDEPTH, OMR_XGCMARKINGPREFETCHDEPTH_LENGTH)) {
+		uintptr_t prefetchDepth = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCMARKINGPREFETCHDEPTH_LENGTH, &prefetchDepth)) || (prefetchDepth > MAXIMUM_MARKING_PREFETCH_DEPTH)) {
+			result = false;
+		} else {
+			extensions->markingPrefetchDepth = prefetchDepth;
+		}
+	} else if (0 == strncmp(option, OMR_XGCMARKMAPCACHE, OMR_XGCMARKMAPCACHE_LENGTH)) {
+		extensions->markMapCache = true;
+	} else if (0 == strncmp(option, OMR_XGCTLHADAPTIVEREFRESHINTERVAL, OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH)) {
+		uintptr_t refreshInterval = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCTLHADAPTIVEREFRESHINTERVAL_LENGTH, &refreshInterval)) || (0 == refreshInterval)) {
+			result = false;
+		} else {
+			extensions->tlhAdaptiveRefreshInterval = refreshInterval;
+		}
+	} else if (0 == strncmp(option, OMR_XGCTLHADAPTIVESIZING, OMR_XGCTLHADAPTIVESIZING_LENGTH)) {
+		extensions->tlhAdaptiveSizing = true;
+	} else if (0 == strncmp(option, OMR_XGCFREEENTRYQUICKLISTSIZES, OMR_XGCFREEENTRYQUICKLISTSIZES_LENGTH)) {
+		uintptr_t quickListSizes = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCFREEENTRYQUICKLISTSIZES_LENGTH, &quickListSizes)) || (quickListSizes > MAXIMUM_FREE_ENTRY_QUICK_LIST_SIZES)) {
+			result = false;
+		} else {
+			extensions->freeEntryQuickListSizes = quickListSizes;
+		}
+	} else if (0 == strncmp(option, OMR_XGCFREEENTRYQUICKLISTPERCENT, OMR_XGCFREEENTRYQUICKLISTPERCENT_LENGTH)) {
+		uintptr_t quickListPercent = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCFREEENTRYQUICKLISTPERCENT_LENGTH, &quickListPercent)) || (quickListPercent > 100)) {
+			result = false;
+		} else {
+			extensions->freeEntryQuickListPercent = quickListPercent;
+		}
+	} else if (0 == strncmp(option, OMR_XGCFREEENTRYQUICKLISTS, OMR_XGCFREEENTRYQUICKLISTS_LENGTH)) {
+		extensions->freeEntryQuickLists = true;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	} else if (0 == strncmp(option, OMR_XGCLOASIZEBANDPERCENT, OMR_XGCLOASIZEBANDPERCENT_LENGTH)) {
+		uintptr_t sizeBandPercent = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCLOASIZEBANDPERCENT_LENGTH, &sizeBandPercent)) || (sizeBandPercent > 100)) {
+			result = false;
+		} else {
+			extensions->loaSizeBandPercent = sizeBandPercent;
+		}
+	} else if (0 == strncmp(option, OMR_XGCLOASIZEBANDS, OMR_XGCLOASIZEBANDS_LENGTH)) {
+		extensions->loaSizeBands = true;
+	} else if (0 == strncmp(option, OMR_XGCLOARESERVATIONCOUNT, OMR_XGCLOARESERVATIONCOUNT_LENGTH)) {
+		uintptr_t reservationCount = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCLOARESERVATIONCOUNT_LENGTH, &reservationCount)) {
+			result = false;
+		} else {
+			extensions->loaReservationCount = reservationCount;
+		}
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+	} else if (0 == strncmp(option, OMR_XGCHEAPHUGEPAGES, OMR_XGCHEAPHUGEPAGES_LENGTH)) {
+		char *hugePages = option + OMR_XGCHEAPHUGEPAGES_LENGTH;
+		if (0 == strcmp(hugePages, OMR_HEAPHUGEPAGES_TRANSPARENT)) {
+			extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_TRANSPARENT;
+		} else if (0 == strcmp(hugePages, OMR_HEAPHUGEPAGES_EXPLICIT)) {
+			extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_EXPLICIT;
+		} else if (0 == strcmp(hugePages, OMR_HEAPHUGEPAGES_NONE)) {
+			extensions->heapHugePages = MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE;
+		} else {
+			result = false;
+		}
+	} else if (0 == strncmp(option, OMR_XGCMEMORYMAINTENANCERATE, OMR_XGCMEMORYMAINTENANCERATE_LENGTH)) {
+		uintptr_t maintenanceRate = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCMEMORYMAINTENANCERATE_LENGTH, &maintenanceRate)) || (0 == maintenanceRate)) {
+			result = false;
+		} else {
+			extensions->memoryMaintenanceRate = maintenanceRate;
+		}
+	} else if (0 == strncmp(option, OMR_XGCMEMORYMAINTENANCE, OMR_XGCMEMORYMAINTENANCE_LENGTH)) {
+		extensions->memoryMaintenance = true;
+	} else if (0 == strncmp(option, OMR_XGCALLOCATIONSAMPLINGINTERVAL, OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH)) {
+		uintptr_t samplingInterval = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH, &samplingInterval)) {
+			result = false;
+		} else {
+			extensions->allocationSamplingInterval = samplingInterval;
+		}
+	} else if (0 == strncmp(option, OMR_XGCALLOCATIONSAMPLINGTOPSITES, OMR_XGCALLOCATIONSAMPLINGTOPSITES_LENGTH)) {
+		uintptr_t topSites = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCALLOCATIONSAMPLINGTOPSITES_LENGTH, &topSites)) || (0 == topSites)) {
+			result = false;
+		} else {
+			extensions->allocationSamplingTopSites = topSites;
+		}
 	} else {
 		/* unknown option */
 		result = false;
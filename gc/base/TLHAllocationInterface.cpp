@@ -206,10 +206,28 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
 		_stats._allocationBytes += allocDescription->getContiguousBytes();
 		_stats._allocationCount += 1;
+		if (allocDescription->isQuickListAllocation()) {
+			_stats._quickListAllocationCount += 1;
+		}
+		if (allocDescription->isLOAReservationAllocation()) {
+			_stats._loaReservationAllocationCount += 1;
+		}
 
 	}
 
-	env->_oolTraceAllocationBytes += (_stats.bytesAllocated() - _bytesAllocatedBase); /* Increment by bytes allocated */
+	uintptr_t bytesAllocated = _stats.bytesAllocated() - _bytesAllocatedBase;
+	env->_oolTraceAllocationBytes += bytesAllocated; /* Increment by bytes allocated */
+
+	/* TLH bytes are counted when the TLH is refreshed, so the sampled allocations are those which refresh the TLH.
+	 * The sample is taken once the object is initialized, when the language can report its type. */
+	uintptr_t samplingInterval = env->getExtensions()->allocationSamplingInterval;
+	if (0 != samplingInterval) {
+		env->_allocationSamplingBytes += bytesAllocated;
+		if ((env->_allocationSamplingBytes >= samplingInterval) && (NULL != result)) {
+			env->_pendingAllocationSampleBytes = env->_allocationSamplingBytes;
+			env->_allocationSamplingBytes = 0;
+		}
+	}
 
 	return result;
 }
@@ -290,15 +308,32 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
+	if (!extensions->tlhAdaptiveSizing) {
+		mergeStats(env);
+	}
+
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	if (extensions->tlhAdaptiveSizing) {
+		/* Flush the TLHs before merging so that the memory they waste is reported with this cycle */
+		mergeStats(env);
+	}
+}
+
+/**
+ * Merge this thread's allocation stats into the global stats and start counting afresh.
+ */
+void
+MM_TLHAllocationInterface::mergeStats(MM_EnvironmentBase *env)
+{
+	env->getExtensions()->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
@@ -328,6 +363,8 @@ MM_TLHAllocationInterface::restartCache(MM_EnvironmentBase *env)
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.restart(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	_owningEnv->restartTLHAllocationRate();
 }
 
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
@@ -92,6 +92,7 @@ protected:
 
 private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
+	void mergeStats(MM_EnvironmentBase *env);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
 	/**
@@ -91,6 +91,9 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 
 	/* Any previous cache to clear  ? */
 	if (NULL != memoryPool) {
+		if (NULL != _objectAllocationInterface) {
+			_objectAllocationInterface->getAllocationStats()->_tlhWastedBytes += (uintptr_t)getTop() - (uintptr_t)getRealAlloc();
+		}
 		memoryPool->abandonTlhHeapChunk(getRealAlloc(), getTop());
 		reportClearCache(env);
 	}
@@ -142,9 +145,59 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* A thread that was handed less than one refresh worth of TLH since the last collection is mostly
+		 * idle: shrink its refresh size to what it actually used so it does not sit on a large TLH.
+		 * Busy threads keep the size their allocation rate earned them.
+		 */
+		uintptr_t bytesSinceRestart = _objectAllocationInterface->getOwningEnv()->_tlhBytesSinceRestart;
+		if (bytesSinceRestart < refreshSize) {
+			uintptr_t idleSize = MM_Math::roundToCeiling(extensions->tlhMinimumSize, OMR_MAX(bytesSinceRestart, extensions->tlhMinimumSize));
+			if (idleSize < refreshSize) {
+				refreshSize = idleSize;
+				_objectAllocationInterface->getAllocationStats()->_tlhRefreshSizeDecreases += 1;
+			}
+		}
+		_tlh->refreshSize = refreshSize;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
 };
 
+/**
+ * Move the refresh size towards the amount of memory this thread allocates in
+ * tlhAdaptiveRefreshInterval microseconds, as measured by its environment.
+ * Growth is geometric so that allocation heavy threads quickly stop refreshing,
+ * shrinking only happens once the target falls below half the current size.
+ */
+void
+MM_TLHAllocationSupport::adaptRefreshSize(MM_EnvironmentBase *env, MM_AllocationStats *stats)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	uintptr_t allocationRate = env->_tlhAllocationRate;
+
+	if (0 == allocationRate) {
+		/* no rate sample yet */
+		return;
+	}
+
+	uintptr_t refreshSize = getRefreshSize();
+	uintptr_t targetSize = (uintptr_t)(((uint64_t)allocationRate * extensions->tlhAdaptiveRefreshInterval) / 1000);
+	/* keep refresh sizes a multiple of the minimum TLH size so that TLHs stay object aligned */
+	targetSize = MM_Math::roundToCeiling(extensions->tlhMinimumSize, OMR_MAX(targetSize, extensions->tlhMinimumSize));
+	targetSize = OMR_MIN(targetSize, extensions->tlhMaximumSize);
+
+	if (targetSize > refreshSize) {
+		uintptr_t grownSize = OMR_MAX(refreshSize * 2, refreshSize + extensions->tlhIncrementSize);
+		setRefreshSize(OMR_MIN(grownSize, targetSize));
+		stats->_tlhRefreshSizeIncreases += 1;
+	} else if (targetSize < (refreshSize / 2)) {
+		/* the refresh size may have been bumped off the minimum size grid by tlhIncrementSize, so halving it needs rounding too */
+		setRefreshSize(OMR_MAX(targetSize, MM_Math::roundToCeiling(extensions->tlhMinimumSize, refreshSize / 2)));
+		stats->_tlhRefreshSizeDecreases += 1;
+	}
+}
+
 /**
  * Refresh the TLH.
  */
@@ -171,6 +224,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	if (extensions->tlhAdaptiveSizing && (NULL != getBase())) {
+		env->updateTLHAllocationRate((uintptr_t)getRealAlloc() - (uintptr_t)getBase());
+	}
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -235,6 +292,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		MM_AllocationContext *ac = env->getAllocationContext();
 		MM_MemorySpace *memorySpace = _objectAllocationInterface->getOwningEnv()->getMemorySpace();
 
+		allocDescription->setPreZeroedTLH(false);
 		if (NULL != ac) {
 			/* ensure that we are allowed to use the AI in this configuration in the Tarok case */
 			/* allocation contexts currently aren't supported with generational schemes */
@@ -251,7 +309,15 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 				if (0 != extensions->batchClearTLH) {
 					void *base = getBase();
 					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					if (allocDescription->isPreZeroedTLH()) {
+						/* the memory maintenance thread already zeroed everything but the free entry header */
+						memset(base, 0, OMR_MIN(sizeof(MM_HeapLinkedFreeHeader), (uintptr_t)top - (uintptr_t)base));
+						if (0 < getSize()) {
+							stats->_tlhRefreshCountPreZeroed += 1;
+						}
+					} else {
+						OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					}
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -283,9 +349,12 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (extensions->tlhAdaptiveSizing) {
+				env->_tlhBytesSinceRestart += getSize();
+				adaptRefreshSize(env, stats);
+			} else if (getRefreshSize() < tlhMaximumSize) {
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
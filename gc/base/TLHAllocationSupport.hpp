@@ -43,6 +43,7 @@
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
 class MM_AllocateDescription;
+class MM_AllocationStats;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_ObjectAllocationInterface;
@@ -137,6 +138,7 @@ private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void restart(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+	void adaptRefreshSize(MM_EnvironmentBase *env, MM_AllocationStats *stats);
 
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
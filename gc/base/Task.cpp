@@ -26,7 +26,9 @@
 
 #include "Task.hpp"
 
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
+#include "PhaseTimelineRecorder.hpp"
 
 void
 MM_Task::accept(MM_EnvironmentBase *env)
@@ -38,6 +40,13 @@ MM_Task::accept(MM_EnvironmentBase *env)
 	} else {
 		Assert_MM_true(J9VMSTATE_GC_DISPATCHER_IDLE == oldVMstate);
 	}
+
+	/* the thread records into the timeline of its slave ID until the task completes */
+	MM_PhaseTimelineRecorder *phaseTimelineRecorder = _dispatcher->getPhaseTimelineRecorder();
+	if (NULL != phaseTimelineRecorder) {
+		env->_phaseTimeline = phaseTimelineRecorder->getTimeline(env->getSlaveID());
+		env->_phaseTimeline->taskStarted(env);
+	}
 	
 	/* do task-specific setup */
 	setup(env);
@@ -78,6 +87,11 @@ MM_Task::complete(MM_EnvironmentBase *env)
 	
 	/* do task-specific cleanup */
 	cleanup(env);
+
+	if (NULL != env->_phaseTimeline) {
+		env->_phaseTimeline->taskCompleted(env, getBaseVirtualTypeId());
+		env->_phaseTimeline = NULL;
+	}
 }
 
 bool 
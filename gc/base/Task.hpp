@@ -53,6 +53,7 @@ protected:
 	MM_Dispatcher *_dispatcher;
 
 	uintptr_t _oldVMstate; /**< the vmState at the start of the task */
+	uintptr_t _expectedWorkSize; /**< bytes of work the task expects to process, UDATA_MAX if not known */
 	
 public:
 	virtual void setup(MM_EnvironmentBase *env);
@@ -76,6 +77,18 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * The work the task expects to process bounds the number of threads worth dispatching it to.
+	 * @return bytes of work the task expects to process, or UDATA_MAX if not known
+	 */
+	MMINLINE uintptr_t getExpectedWorkSize() { return _expectedWorkSize; }
+
+	/**
+	 * Set the work the task expects to process, before the task is dispatched.
+	 * @param expectedWorkSize bytes of work the task expects to process
+	 */
+	MMINLINE void setExpectedWorkSize(uintptr_t expectedWorkSize) { _expectedWorkSize = expectedWorkSize; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
@@ -157,7 +170,8 @@ public:
 	MM_Task(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher) :
 		MM_BaseVirtual(),
 		_dispatcher(dispatcher),
-		_oldVMstate(0)
+		_oldVMstate(0),
+		_expectedWorkSize(UDATA_MAX)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -198,6 +198,7 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 
 	if (0 < commitSize) {
 		success = omrvmem_commit_memory(commitBase, commitSize, &_identifier) != 0;
+		_hugePageBackedSizeValid = false;
 	}
 
 	if (success) {
@@ -251,6 +252,7 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 		/* There is still memory to decommit, calculate size */
 		uintptr_t decommitSize = ((uintptr_t)decommitTop) - ((uintptr_t)decommitBase);
 		result = omrvmem_decommit_memory(decommitBase, decommitSize, &_identifier) == 0;
+		_hugePageBackedSizeValid = false;
 	}
 
 	return result;
@@ -299,3 +301,21 @@ MM_VirtualMemory::setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t b
 	}
 	return didSetAffinity;
 }
+
+uintptr_t
+MM_VirtualMemory::getHugePageBackedSize()
+{
+	if (!_hugePageBackedSizeValid) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		uintptr_t hugePageBackedSize = 0;
+		uintptr_t heapSize = (uintptr_t)_heapTop - (uintptr_t)_heapBase;
+
+		if ((0 == heapSize) || (0 != omrvmem_get_huge_page_backed_size(_heapBase, heapSize, &_identifier, &hugePageBackedSize))) {
+			/* not supported on this platform, or the mapping could not be inspected */
+			hugePageBackedSize = 0;
+		}
+		_hugePageBackedSize = hugePageBackedSize;
+		_hugePageBackedSizeValid = true;
+	}
+	return _hugePageBackedSize;
+}
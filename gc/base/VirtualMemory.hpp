@@ -58,6 +58,8 @@ private:
 	uintptr_t _mode; /**< requested memory mode (memory flags combination) */
 	uintptr_t _consumerCount; /**< number of memory consumers attached to this virtual memory instance */
 	J9PortVmemIdentifier _identifier;
+	uintptr_t _hugePageBackedSize; /**< Bytes of the heap backed by huge pages, as last read from the port library */
+	bool _hugePageBackedSizeValid; /**< False until _hugePageBackedSize has been read since the last commit or decommit */
 
 protected:
 	MM_GCExtensionsBase* _extensions;
@@ -93,6 +95,8 @@ protected:
 		, _mode(mode)
 		, _consumerCount(0)
 		, _identifier()
+		, _hugePageBackedSize(0)
+		, _hugePageBackedSizeValid(false)
 		, _extensions(env->getExtensions())
 		, _baseAddress(NULL)
 		, _heapAlignment(heapAlignment)
@@ -117,6 +121,14 @@ protected:
 	 */
 	virtual bool setNumaAffinity(uintptr_t numaNode, void* address, uintptr_t byteAmount);
 
+	/**
+	 * Return the number of bytes between heap base and heap top currently backed by huge pages.
+	 * Used for reporting only; 0 is returned where the platform cannot tell.
+	 * Reading the backing can be expensive (on Linux it parses /proc/self/smaps), so the size is read once
+	 * after each commit or decommit and cached until the next one.
+	 */
+	uintptr_t getHugePageBackedSize();
+
 	/**
 	 * Return the heap base of the virtual memory object.
 	 */
@@ -33,6 +33,7 @@
 #include "Heap.hpp"
 #include "Packet.hpp"
 #include "PacketList.hpp"
+#include "PhaseTimeline.hpp"
 #include "Task.hpp"
 #include "WorkPackets.hpp"
 #include "WorkPacketOverflow.hpp"
@@ -120,6 +121,24 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->workStealingDeque) {
+		/* one deque for each thread that can take part in a parallel task */
+		uintptr_t dequeCount = _extensions->gcThreadCount;
+		_deques = (MM_WorkStealingDeque *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque) * dequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _deques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			new(&_deques[i]) MM_WorkStealingDeque();
+		}
+		_dequeCount = dequeCount;
+		for (uintptr_t i = 0; i < dequeCount; i++) {
+			if (!_deques[i].initialize(env, _extensions->workStealingDequeSize)) {
+				return false;
+			}
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -205,7 +224,7 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	}
 
 	
-	_emptyPacketList.pushList(headPtr, tailPtr, _packetsPerBlock);
+	_emptyPacketList.pushList(env, headPtr, tailPtr, _packetsPerBlock);
 
 	_packetsBlocksTop++;
 	_activePackets += _packetsPerBlock;
@@ -224,6 +243,15 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _deques) {
+		for (uintptr_t i = 0; i < _dequeCount; i++) {
+			_deques[i].tearDown(env);
+		}
+		env->getForge()->free(_deques);
+		_deques = NULL;
+		_dequeCount = 0;
+	}
+
 	for(uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if(NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -426,13 +454,20 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
  * @return Pointer to an input packet
  */
 MM_Packet *
-MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
+MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env, bool *dequeWorkAvailable)
 {
 	MM_Packet *packet = NULL;
 	bool doneFlag = false;
 	volatile uintptr_t doneIndex = _inputListDoneIndex;
 	bool mustSyncThreadsAndExit = (NULL != env->_currentTask) && env->_currentTask->shouldYieldFromTask(env);
 	
+	/* busy threads only hand deque work to packets periodically, so poll their deques rather than wait for a notify */
+	bool pollDeques = (NULL != dequeWorkAvailable) && (NULL != _deques);
+
+	if (NULL != dequeWorkAvailable) {
+		*dequeWorkAvailable = false;
+	}
+
 	while(!doneFlag) {
 		if (!mustSyncThreadsAndExit) {
 			while (inputPacketAvailable(env)) {
@@ -455,6 +490,10 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 				omrthread_monitor_notify_all(_inputListMonitor);
 			} else {
 				while(mustSyncThreadsAndExit || (!inputPacketAvailable(env) && (_inputListDoneIndex == doneIndex))) {
+					if (pollDeques && !mustSyncThreadsAndExit && isDequeWorkAvailable(env)) {
+						*dequeWorkAvailable = true;
+						break;
+					}
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitStartTime, waitEndTime;
 					OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
@@ -462,15 +501,25 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 					
 					/* This is where all the GC threads end up synchronizing when waiting for work */
-					omrthread_monitor_wait(_inputListMonitor);
+					if (pollDeques) {
+						omrthread_monitor_wait_timed(_inputListMonitor, _dequePollMillis, 0);
+					} else {
+						omrthread_monitor_wait(_inputListMonitor);
+					}
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					waitEndTime = omrtime_hires_clock();
 
 					if (_inputListDoneIndex != doneIndex) {
 						env->_workPacketStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+						if (NULL != env->_phaseTimeline) {
+							env->_phaseTimeline->record(MM_PhaseTimeline::event_complete_stall, "work packets", waitStartTime, waitEndTime);
+						}
 					} else {
 						env->_workPacketStats.addToWorkStallTime(waitStartTime, waitEndTime);
+						if (NULL != env->_phaseTimeline) {
+							env->_phaseTimeline->record(MM_PhaseTimeline::event_work_stall, "work packets", waitStartTime, waitEndTime);
+						}
 					}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
@@ -489,8 +538,16 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 		doneFlag = (_inputListDoneIndex != doneIndex);
 		if(!doneFlag) {
 			_inputListWaitCount -= 1;
+		} else if (pollDeques) {
+			/* the work is done, whatever was seen in a deque has since been taken by its owner */
+			*dequeWorkAvailable = false;
 		}
 		omrthread_monitor_exit(_inputListMonitor);
+
+		if (pollDeques && *dequeWorkAvailable) {
+			/* let the caller steal from the deque and then wait again if that fails */
+			return NULL;
+		}
 	}
 
 	assume0(NULL == packet);
@@ -674,6 +731,32 @@ MM_WorkPackets::getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots)
 	}
 }
 
+bool
+MM_WorkPackets::isDequeWorkAvailable(MM_EnvironmentBase *env)
+{
+	uintptr_t slaveID = env->getSlaveID();
+
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		if ((i != slaveID) && !_deques[i].isEmpty()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+MM_WorkStealingDeque *
+MM_WorkPackets::getDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+
+	if (env->getSlaveID() < _dequeCount) {
+		deque = &_deques[env->getSlaveID()];
+	}
+
+	return deque;
+}
+
 /**
  * Get a packet from the given list
  * 
@@ -691,6 +774,11 @@ MM_WorkPackets::getPacket(MM_EnvironmentBase *env, MM_PacketList *list)
 		return NULL;
 	}
 	
+	if ((&_emptyPacketList != list) && list->isFromRemoteNode(env, packet)) {
+		/* this thread's node ran out of work and had to take a packet filled on another node */
+		env->_markStats._remoteStealCount += 1;
+	}
+
 	packet->setOwner(env);
 
 	return packet;
@@ -38,6 +38,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -89,10 +90,22 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkStealingDeque *_deques; /**< Per-thread work stealing deques, indexed by slave ID (NULL unless -Xgc:workStealingDeque is specified) */
+	uintptr_t _dequeCount; /**< The number of elements in _deques */
+
+	enum {
+		_dequePollMillis = 1 /**< How often a thread waiting for an input packet checks the deques of busy threads for work to steal */
+	};
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
 
+	/**
+	 * Returns true if the deque of any thread other than the caller holds work that could be stolen
+	 */
+	bool isDequeWorkAvailable(MM_EnvironmentBase *env);
+
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
@@ -112,7 +125,15 @@ public:
 
 	static uintptr_t getSlotsInPacket() { return _slotsInPacket; }
 	MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
-	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
+	/**
+	 * Get an input packet, waiting for one to become available. Returns NULL once every thread in the
+	 * task is waiting and no work remains.
+	 * @param env[in] The thread requesting the packet
+	 * @param dequeWorkAvailable[out] If not NULL, the wait is also abandoned (and NULL returned) when the deque
+	 * of a busy thread holds work, so that the caller can steal it. Set to true in that case, false otherwise.
+	 * @return Pointer to an input packet, or NULL
+	 */
+	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env, bool *dequeWorkAvailable = NULL);
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -146,6 +167,22 @@ public:
 		return _inputListWaitCount;
 	}
 
+	/**
+	 * Returns the work stealing deque of the given thread, which must be taking part in a parallel task.
+	 * @return the deque, or NULL if the deque scheme is not enabled
+	 */
+	MM_WorkStealingDeque *getDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Returns the deque at the given index (used by threads looking for a deque to steal from)
+	 */
+	MMINLINE MM_WorkStealingDeque *getDeque(uintptr_t index) { return &_deques[index]; }
+
+	/**
+	 * Returns the number of work stealing deques (0 if the deque scheme is not enabled)
+	 */
+	MMINLINE uintptr_t getDequeCount() { return _dequeCount; }
+
 	/**
 	 * Returns number of non-empty packets 
 	 */
@@ -224,7 +261,9 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_deques(NULL),
+		_dequeCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -62,6 +62,15 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 	}
 }
 
+void
+MM_WorkStack::prepareForParallelWork(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
+{
+	prepareForWork(env, workPackets);
+	Assert_MM_true(NULL == _deque);
+	_deque = workPackets->getDeque(env);
+	Assert_MM_true((NULL == _deque) || _deque->isEmpty());
+}
+
 /**
  * Flush stack object
  * 
@@ -71,6 +80,10 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 void
 MM_WorkStack::flush(MM_EnvironmentBase *env)
 {
+	if(NULL != _deque) {
+		spillDeque(env);
+		_deque = NULL;
+	}
 	if(NULL != _inputPacket) {
 		_workPackets->putPacket(env, _inputPacket);
 		_inputPacket = NULL;
@@ -163,6 +176,10 @@ MM_WorkStack::popNoWaitFailed(MM_EnvironmentBase *env)
 			void* result = _inputPacket->pop(env);
 			return result;
 		}
+
+		if(NULL != _deque) {
+			return stealFromDeques(env);
+		}
 	}
 
 	return NULL;
@@ -233,10 +250,31 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 			void* result = _inputPacket->pop(env);
 			return result;
 		}
+
+		/* Try to take work directly from the deques of busy threads before blocking */
+		if(NULL != _deque) {
+			void* result = stealFromDeques(env);
+			if(NULL != result) {
+				return result;
+			}
+		}
 	}
 
 	/* Nothing is immediately available, wait for an input packet to arrive */
-	_inputPacket = _workPackets->getInputPacket(env);
+	if((NULL != _deque) && tryRetrieveInputPacket) {
+		/* while waiting, keep stealing from busy threads whose deques hold work */
+		bool dequeWorkAvailable = false;
+		_inputPacket = _workPackets->getInputPacket(env, &dequeWorkAvailable);
+		while((NULL == _inputPacket) && dequeWorkAvailable) {
+			void* result = stealFromDeques(env);
+			if(NULL != result) {
+				return result;
+			}
+			_inputPacket = _workPackets->getInputPacket(env, &dequeWorkAvailable);
+		}
+	} else {
+		_inputPacket = _workPackets->getInputPacket(env);
+	}
 	if(NULL != _inputPacket) {
 		/* Any entry on the _inputPacket list must have at least 1 entry */
 		void* result = _inputPacket->pop(env);
@@ -297,3 +335,62 @@ MM_WorkStack::flushOutputPacket(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_WorkStack::shareDequeWork(MM_EnvironmentBase *env)
+{
+	if (0 < _workPackets->getThreadWaitCount()) {
+		/* other threads are blocked waiting for packets - hand them the oldest half of the deque */
+		uintptr_t shareCount = _deque->getSize() / 2;
+		uintptr_t shared = 0;
+		void *element = NULL;
+		while ((shared < shareCount) && (NULL != (element = _deque->steal()))) {
+			pushToPacket(env, element);
+			shared += 1;
+		}
+		flushOutputPacket(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.dequeElementsShared += shared;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+}
+
+void
+MM_WorkStack::spillDeque(MM_EnvironmentBase *env)
+{
+	void *element = NULL;
+	while (NULL != (element = _deque->pop())) {
+		pushToPacket(env, element);
+	}
+}
+
+void *
+MM_WorkStack::stealFromDeques(MM_EnvironmentBase *env)
+{
+	void *result = NULL;
+	uintptr_t dequeCount = _workPackets->getDequeCount();
+	uintptr_t slaveID = env->getSlaveID();
+
+	for (uintptr_t i = 1; (NULL == result) && (i < dequeCount); i++) {
+		MM_WorkStealingDeque *victim = _workPackets->getDeque((slaveID + i) % dequeCount);
+		if (!victim->isEmpty() && (NULL != (result = victim->steal()))) {
+			/* take a few more elements while the victim is known to have work to amortize the search,
+			 * but no more than the receiver's deque (which may be smaller than the batch) can hold
+			 */
+			uintptr_t stolen = 1;
+			uintptr_t batch = OMR_MIN((uintptr_t)_dequeStealBatch, _deque->getCapacity() - _deque->getSize() + 1);
+			void *element = NULL;
+			while ((stolen < batch) && (NULL != (element = victim->steal()))) {
+				if (!_deque->push(element)) {
+					/* a stolen element must never be dropped */
+					pushToPacket(env, element);
+				}
+				stolen += 1;
+			}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.dequeElementsStolen += stolen;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+	}
+
+	return result;
+}
@@ -33,6 +33,7 @@
 
 #include "BaseNonVirtual.hpp"
 #include "Packet.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_WorkPackets;
@@ -45,10 +46,16 @@ class MM_WorkStack : public MM_BaseNonVirtual
 {
 /* data members */
 private:
+	enum {
+		_dequeShareInterval = 64, /**< The deque size from which work is handed to threads starved for work */
+		_dequeStealBatch = 16 /**< The maximum number of elements taken from a victim's deque in one steal */
+	};
+
 	MM_WorkPackets *_workPackets;
 	MM_Packet *_inputPacket;
 	MM_Packet *_outputPacket;
 	MM_Packet *_deferredPacket;
+	MM_WorkStealingDeque *_deque; /**< The thread's work stealing deque, when the deque scheme is in use for this unit of work (NULL otherwise) */
 	
 	uintptr_t 		_pushCount;
 
@@ -85,6 +92,41 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Push an element to the output packet, bypassing the work stealing deque
+	 * @param env[in] The thread which owns the work stack
+	 * @param element[in] The element to push
+	 */
+	MMINLINE void pushToPacket(MM_EnvironmentBase *env, void *element)
+	{
+		if(_outputPacket && (_outputPacket->push(env, element))) {
+			_pushCount++;
+		} else {
+			pushFailed(env, element);
+		}
+	}
+
+	/**
+	 * Called on a push whenever the deque holds at least _dequeShareInterval elements. If other threads are
+	 * starved for work, move the oldest half of the deque into a work packet that waiting threads can pick up.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void shareDequeWork(MM_EnvironmentBase *env);
+
+	/**
+	 * Move every element of the deque into work packets (the deque must not hold work once the thread stops marking)
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void spillDeque(MM_EnvironmentBase *env);
+
+	/**
+	 * Steal a small batch of elements from the deque of another thread. The first element is returned
+	 * and the rest are pushed onto the receiver's (empty) deque.
+	 * @param env[in] The thread which owns the work stack
+	 * @return reference or NULL if no work could be stolen
+	 */
+	void *stealFromDeques(MM_EnvironmentBase *env);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -93,6 +135,15 @@ public:
 	 * @param workPackets[in] The work packets we want the receiver to use during the mark
 	 */
 	void prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
+
+	/**
+	 * Ensures that this work stack is backing onto the given workPackets and, if the work stealing deque
+	 * scheme is enabled, attaches the deque the thread will push to and idle threads will steal from.
+	 * Only threads participating in a parallel task may use a deque.
+	 * @param env[in] The thread which owns the work stack
+	 * @param workPackets[in] The work packets we want the receiver to use during the mark
+	 */
+	void prepareForParallelWork(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	void flush(MM_EnvironmentBase *env);
 
 	/**
@@ -143,11 +194,16 @@ public:
 	 */
 	MMINLINE void push(MM_EnvironmentBase *env, void *element)
 	{
-		if(_outputPacket && (_outputPacket->push(env, element))) {
-			_pushCount++;
-		} else {
-			pushFailed(env, element);
+		if (NULL != _deque) {
+			if (_deque->push(element)) {
+				_pushCount++;
+				if (_deque->getSize() >= _dequeShareInterval) {
+					shareDequeWork(env);
+				}
+				return;
+			}
 		}
+		pushToPacket(env, element);
 	}
 
 	/**
@@ -158,7 +214,10 @@ public:
 	 */
 	MMINLINE void push(MM_EnvironmentBase *env, void *element1, void *element2)
 	{
-		if(_outputPacket && (_outputPacket->push(env, element1, element2))) {
+		if (NULL != _deque) {
+			push(env, element1);
+			push(env, element2);
+		} else if(_outputPacket && (_outputPacket->push(env, element1, element2))) {
 			_pushCount += 2;
 		} else {
 			pushFailed(env, element1, element2);
@@ -180,7 +239,9 @@ public:
 	{
 		void *result;
 
-		if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
+		if((NULL != _deque) && (NULL != (result = _deque->pop()))) {
+			return result;
+		} else if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
 			return result;
 		} else {
 			return popFailed(env);
@@ -202,7 +263,9 @@ public:
 	{
 		void *result;
 
-		if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
+		if((NULL != _deque) && (NULL != (result = _deque->pop()))) {
+			return result;
+		} else if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
 			return result;
 		} else {
 			return popNoWaitFailed(env);
@@ -217,7 +280,8 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_deque(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
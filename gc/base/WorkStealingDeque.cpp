@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omr.h"
+
+#include "WorkStealingDeque.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+bool
+MM_WorkStealingDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	_capacity = 1;
+	while (_capacity < capacity) {
+		_capacity <<= 1;
+	}
+	_mask = _capacity - 1;
+	_top = 0;
+	_bottom = 0;
+
+	_buffer = (void * volatile *)env->getForge()->allocate(_capacity * sizeof(void *), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+
+	return NULL != _buffer;
+}
+
+void
+MM_WorkStealingDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free((void *)_buffer);
+		_buffer = NULL;
+	}
+}
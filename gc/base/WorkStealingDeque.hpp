@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omr.h"
+#include "omrcomp.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Fixed capacity, lock-free, single-owner work stealing deque (Chase-Lev).
+ * The owning thread pushes and pops at the bottom while any other thread may steal from the top.
+ * The deque does not grow: a failed push tells the owner to spill the element elsewhere (ie. to a work packet).
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+/* data members */
+private:
+	void * volatile *_buffer; /**< Circular array of elements, _capacity entries long */
+	uintptr_t _capacity; /**< Number of entries in _buffer (a power of two) */
+	uintptr_t _mask; /**< _capacity - 1, used to wrap indices into _buffer */
+	volatile uintptr_t _top; /**< Index of the oldest element, advanced by thieves (and the owner on the last element) */
+	volatile uintptr_t _bottom; /**< Index one past the newest element, only written by the owner */
+
+/* function members */
+public:
+	/**
+	 * Allocate the element buffer.
+	 * @param env[in] The current thread
+	 * @param capacity[in] The minimum number of elements the deque must hold (rounded up to a power of two)
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the (approximate, when observed by a thief) number of elements in the deque
+	 */
+	MMINLINE uintptr_t getSize()
+	{
+		intptr_t size = (intptr_t)(_bottom - _top);
+		return (0 < size) ? (uintptr_t)size : 0;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == getSize(); }
+
+	/**
+	 * @return the number of elements the deque holds when full
+	 */
+	MMINLINE uintptr_t getCapacity() { return _capacity; }
+
+	/**
+	 * Push an element onto the bottom of the deque. May only be called by the owning thread.
+	 * @param element[in] The element to push
+	 * @return true if the element was pushed, false if the deque is full
+	 */
+	MMINLINE bool push(void *element)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & _mask] = element;
+		/* the element must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed element. May only be called by the owning thread.
+	 * @return the element, or NULL if the deque is empty (or the last element was lost to a thief)
+	 */
+	MMINLINE void *pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the claim on the bottom element must be visible before top is examined */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		void *element = NULL;
+
+		if (0 <= (intptr_t)(bottom - top)) {
+			element = _buffer[bottom & _mask];
+			if (bottom == top) {
+				/* last element - race any thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					element = NULL;
+				}
+				_bottom = top + 1;
+			}
+		} else {
+			_bottom = top;
+		}
+
+		return element;
+	}
+
+	/**
+	 * Steal the oldest element. May be called by any thread.
+	 * @return the element, or NULL if the deque is empty or another thread won the race for the element
+	 */
+	MMINLINE void *steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readBarrier();
+		uintptr_t bottom = _bottom;
+		void *element = NULL;
+
+		if (0 < (intptr_t)(bottom - top)) {
+			element = _buffer[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				element = NULL;
+			}
+		}
+
+		return element;
+	}
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque() :
+		MM_BaseNonVirtual(),
+		_buffer(NULL),
+		_capacity(0),
+		_mask(0),
+		_top(0),
+		_bottom(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -158,6 +158,27 @@ getPercolateReasonAsString(PercolateReason mode)
 		return "unknown";
 	}
 }
+
+/**
+ * Return the reason for a scavenger pause target sizing decision as a string
+ * @param reason reason code
+ */
+const char *
+getPauseTargetReasonAsString(PauseTargetReason reason)
+{
+	switch(reason) {
+	case PAUSE_TARGET_WITHIN_TARGETS:
+		return "pause and overhead within targets";
+	case PAUSE_TARGET_PAUSE_TOO_HIGH:
+		return "pause above target";
+	case PAUSE_TARGET_OVERHEAD_TOO_HIGH:
+		return "overhead above target";
+	case PAUSE_TARGET_EXPANSION_LIMITED_BY_PAUSE:
+		return "overhead above target, expansion limited by pause target";
+	default:
+		return "unknown";
+	}
+}
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 /**
@@ -180,6 +201,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case SCAV_PAUSE_TOO_HIGH:
+		return "scavenge pause above target";
 	default:
 		return "unknown";
 	}
@@ -205,6 +228,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "satisfy allocation request";
 	case FORCED_NURSERY_EXPAND:
 		return "forced nursery expand";
+	case SCAV_OVERHEAD_TOO_HIGH:
+		return "scavenge overhead above target";
 	default:
 		return "unknown";
 	}
@@ -52,6 +52,7 @@ const char *getGCReasonAsString(GCReason reason);
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 const char *getPercolateReasonAsString(PercolateReason mode);
+const char *getPauseTargetReasonAsString(PauseTargetReason reason);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 const char *getExpandReasonAsString(ExpandReason reason);
@@ -30,6 +30,8 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "MagazineDepotSegregated.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "ModronAssertions.h"
 #include "RegionPoolSegregated.hpp"
@@ -92,6 +94,13 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (1 < env->getExtensions()->allocationMagazineCount) {
+		_magazineDepot = MM_MagazineDepotSegregated::newInstance(env);
+		if (NULL == _magazineDepot) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -123,6 +132,11 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 		_perContextLargeFullRegions = NULL;
 	}
 
+	if (NULL != _magazineDepot) {
+		_magazineDepot->kill(env);
+		_magazineDepot = NULL;
+	}
+
 	MM_AllocationContext::tearDown(env);
 }
 
@@ -166,6 +180,11 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 	flushArraylet(env);
 	_regionPool->getArrayletSweepRegions()->enqueue(_perContextArrayletFullRegions);
 
+	/* the cells of the parked magazines are holes, left for the sweep */
+	if (NULL != _magazineDepot) {
+		_magazineDepot->flush(env);
+	}
+
 	unlockContext();
 }
 
@@ -267,20 +286,44 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 	/* BEN TODO 1429: The object allocation interface base class should define all API used by this method such that casting would be unnecessary. */
 	MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
+	uintptr_t preAllocateSize = replenishSize;
 	uintptr_t preAllocatedBytes = 0;
 
+	if ((NULL != _magazineDepot) && segregatedAllocationInterface->cachedAllocationsEnabled(env)) {
+		/* Load the spare magazine of the thread or else a full magazine of the depot, neither needs the region locks */
+		uintptr_t magazineBytes = 0;
+		uintptr_t *magazine = segregatedAllocationInterface->takeSpareMagazine(env, sizeClass, &magazineBytes);
+		if (NULL == magazine) {
+			magazine = _magazineDepot->popMagazine(env, sizeClass, &magazineBytes);
+		}
+		if (NULL != magazine) {
+			/* The magazine may have been carved before the current marking started, pre-mark its cells as the ACL path does */
+			if (shouldPreMarkSmallCells(env)) {
+				MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)env->getExtensions()->heapRegionManager->tableDescriptorForAddress(magazine);
+				_markingScheme->preMarkSmallCells(env, region, magazine, magazineBytes);
+			}
+			segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, magazine, magazineBytes);
+			return (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+		}
+		/* Both are empty, refill them along with the cache */
+		preAllocateSize = replenishSize * env->getExtensions()->allocationMagazineCount;
+	}
+
 	while (!done) {
 
 		/* If we have a region, attempt to replenish the ACL's cache */
 		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
 		if (NULL != region) {
 			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
-			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, sizeClasses->getCellSize(sizeClass), replenishSize, &preAllocatedBytes);
+			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, sizeClasses->getCellSize(sizeClass), preAllocateSize, &preAllocatedBytes);
 			if (NULL != cellList) {
 				Assert_MM_true(preAllocatedBytes > 0);
 				if (shouldPreMarkSmallCells(env)) {
 					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
 				}
+				if (preAllocateSize != replenishSize) {
+					preAllocatedBytes = distributeMagazines(env, sizeClass, cellList, preAllocatedBytes, replenishSize);
+				}
 				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
 				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
 				done = true;
@@ -303,10 +346,13 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 			if (!tryAllocateRegionFromSmallSizeClass(env, sizeClass)) {
 				/* Attempt to get a region by sweeping */
 				if (!trySweepAndAllocateRegionFromSmallSizeClass(env, sizeClass, &sweepCount, &sweepStartTime)) {
-					/* Attempt to get an unused region */
-					if (!tryAllocateFromRegionPool(env, sizeClass)) {
-						/* Really out of regions */
-						done = true;
+					/* Attempt to get an unused region, sweeping regions of other size classes left unswept by a lazy sweep to free one */
+					while (!tryAllocateFromRegionPool(env, sizeClass)) {
+						if (!_regionPool->lazySweepForFreeRegion(env)) {
+							/* Really out of regions */
+							done = true;
+							break;
+						}
 					}
 				}
 			}
@@ -318,6 +364,37 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 
 }
 
+void
+MM_AllocationContextSegregated::returnMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t magazineBytes)
+{
+	if (NULL != _magazineDepot) {
+		_magazineDepot->pushMagazines(env, sizeClass, cells, magazineBytes, magazineBytes);
+	}
+}
+
+uintptr_t
+MM_AllocationContextSegregated::distributeMagazines(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsBytes, uintptr_t magazineBytes)
+{
+	MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
+	uintptr_t cellSize = env->getExtensions()->defaultSizeClasses->getCellSize(sizeClass);
+
+	magazineBytes = OMR_MAX(cellSize, magazineBytes - (magazineBytes % cellSize));
+	if (cellsBytes <= magazineBytes) {
+		return cellsBytes;
+	}
+
+	uintptr_t *spare = (uintptr_t *)((uintptr_t)cells + magazineBytes);
+	uintptr_t spareBytes = OMR_MIN(magazineBytes, cellsBytes - magazineBytes);
+	segregatedAllocationInterface->setSpareMagazine(env, sizeClass, spare, spareBytes);
+
+	uintptr_t parkedBytes = cellsBytes - magazineBytes - spareBytes;
+	if (0 != parkedBytes) {
+		_magazineDepot->pushMagazines(env, sizeClass, (uintptr_t *)((uintptr_t)spare + spareBytes), parkedBytes, magazineBytes);
+	}
+
+	return magazineBytes;
+}
+
 #if defined(OMR_GC_ARRAYLETS)
 uintptr_t *
 MM_AllocationContextSegregated::allocateArraylet(MM_EnvironmentBase *env, omrarrayptr_t parent)
@@ -371,6 +448,11 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 		excess = (2 * excess) + 1;
 	}
 
+	/* Regions freed by a lazy sweep are only coalesced once an allocation failure completes the sweep, so only a single region request can use them here */
+	while ((region == NULL) && (1 == neededRegions) && _regionPool->lazySweepForFreeRegion(env)) {
+		region = _regionPool->allocateFromRegionPool(env, neededRegions, OMR_SIZECLASSES_LARGE, MAX_UINT);
+	}
+
 	uintptr_t *result = (region == NULL) ? NULL : (uintptr_t *)region->getLowAddress();
 
 	/* Flush the large page right away. */
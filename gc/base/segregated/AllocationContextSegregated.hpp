@@ -38,6 +38,7 @@
 class MM_GlobalAllocationManagerSegregated;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
+class MM_MagazineDepotSegregated;
 class MM_HeapRegionDescriptorSegregated;
 class MM_SegregatedMarkingScheme;
 class MM_RegionPoolSegregated;
@@ -61,6 +62,7 @@ private:
 	MM_HeapRegionQueue *_perContextSmallFullRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context Regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
+	MM_MagazineDepotSegregated *_magazineDepot; /**< Full magazines of small cells shared by the threads of the context, NULL if magazines are disabled. */
 
 /* Methods */
 public:
@@ -103,6 +105,11 @@ public:
 
 	uintptr_t *preAllocateSmall(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
 
+	/**
+	 * Park a full magazine a thread no longer needs in the depot, for the other threads of the context.
+	 */
+	void returnMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t magazineBytes);
+
 	virtual uintptr_t *allocateLarge(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
 
 	void setMarkingScheme(MM_SegregatedMarkingScheme *markingScheme) { _markingScheme = markingScheme; }
@@ -122,6 +129,7 @@ protected:
 		, _count(0)
 		, _perContextArrayletFullRegions(NULL)
 		, _perContextLargeFullRegions(NULL)
+		, _magazineDepot(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -133,6 +141,13 @@ protected:
 	void flushSmall(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	void flushArraylet(MM_EnvironmentBase *env);
 
+	/**
+	 * Split freshly pre-allocated cells into magazines: the first one is returned to be loaded in the allocation cache,
+	 * the next one becomes the spare magazine of the thread and the others are parked in the depot.
+	 * @return the size in bytes of the first magazine
+	 */
+	uintptr_t distributeMagazines(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsBytes, uintptr_t magazineBytes);
+
 	virtual bool shouldPreMarkSmallCells(MM_EnvironmentBase *env);
 
 	virtual bool trySweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *sweepCount, uint64_t *sweepStartTime);
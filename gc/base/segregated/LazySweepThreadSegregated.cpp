@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrutil.h"
+#include "ModronAssertions.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "RegionPoolSegregated.hpp"
+
+#include "LazySweepThreadSegregated.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* How long the thread waits before sweeping again, when it had to stop before the lazy sweep was complete */
+#define LAZY_SWEEP_THREAD_RETRY_MILLIS 10
+
+MM_LazySweepThreadSegregated::MM_LazySweepThreadSegregated(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _lazySweepMutex(NULL)
+	, _threadState(STATE_ERROR)
+	, _extensions(env->getExtensions())
+	, _regionPool(NULL)
+{
+	_typeId = __FUNCTION__;
+}
+
+uintptr_t
+MM_LazySweepThreadSegregated::lazy_sweep_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	MM_LazySweepThreadSegregated *lazySweepThread = (MM_LazySweepThreadSegregated *)info;
+	/* jump into the thread procedure and wait for work.  This method will NOT return */
+	lazySweepThread->lazySweepThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_LazySweepThreadSegregated::lazy_sweep_thread_proc(void *info)
+{
+	MM_LazySweepThreadSegregated *lazySweepThread = (MM_LazySweepThreadSegregated *)info;
+	MM_GCExtensionsBase *extensions = lazySweepThread->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(lazy_sweep_thread_proc2, info,
+			((MM_ParallelDispatcher *)extensions->dispatcher)->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+bool
+MM_LazySweepThreadSegregated::initialize()
+{
+	bool success = true;
+	if (omrthread_monitor_init_with_name(&_lazySweepMutex, 0, "MM_LazySweepThreadSegregated::_lazySweepMutex")) {
+		success = false;
+	}
+
+
+	return success;
+}
+
+void
+MM_LazySweepThreadSegregated::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _lazySweepMutex) {
+		omrthread_monitor_destroy(_lazySweepMutex);
+		_lazySweepMutex = NULL;
+	}
+	_regionPool = NULL;
+}
+
+bool
+MM_LazySweepThreadSegregated::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of this thread so that we eliminate any timing hole where it might notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_lazySweepMutex);
+	_threadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		lazy_sweep_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _threadState) {
+			omrthread_monitor_wait(_lazySweepMutex);
+		}
+		success = (STATE_ERROR != _threadState);
+	} else {
+		_threadState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_lazySweepMutex);
+
+	return success;
+}
+
+void
+MM_LazySweepThreadSegregated::shutdown()
+{
+	if ((NULL != _lazySweepMutex) && (STATE_ERROR != _threadState)) {
+		/* tell the thread to shut down and then wait for it to exit */
+		omrthread_monitor_enter(_lazySweepMutex);
+		while (STATE_TERMINATED != _threadState) {
+			_threadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_lazySweepMutex);
+			omrthread_monitor_wait(_lazySweepMutex);
+		}
+		omrthread_monitor_exit(_lazySweepMutex);
+	}
+}
+
+void
+MM_LazySweepThreadSegregated::resume(MM_RegionPoolSegregated *regionPool)
+{
+	omrthread_monitor_enter(_lazySweepMutex);
+	if ((STATE_WAITING == _threadState) || (STATE_SWEEPING == _threadState)) {
+		_regionPool = regionPool;
+		_threadState = STATE_SWEEP_REQUESTED;
+		omrthread_monitor_notify(_lazySweepMutex);
+	}
+	omrthread_monitor_exit(_lazySweepMutex);
+}
+
+void
+MM_LazySweepThreadSegregated::lazySweepThreadEntryPoint()
+{
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "Lazy Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_lazySweepMutex);
+	if (NULL == omrVMThread) {
+		/* we failed to attach so notify the creating thread that we should fail to start up */
+		_threadState = STATE_ERROR;
+		omrthread_monitor_notify(_lazySweepMutex);
+		omrthread_exit(_lazySweepMutex);
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	_threadState = STATE_WAITING;
+	omrthread_monitor_notify(_lazySweepMutex);
+
+	while (STATE_TERMINATION_REQUESTED != _threadState) {
+		if (STATE_SWEEP_REQUESTED == _threadState) {
+			MM_RegionPoolSegregated *regionPool = _regionPool;
+			_threadState = STATE_SWEEPING;
+			omrthread_monitor_exit(_lazySweepMutex);
+
+			/* sweeping needs VM access, so that a collection (which starts by completing the sweep itself) waits for the region in hand */
+			env->acquireVMAccess();
+			bool complete = regionPool->completeLazySweep(env, true);
+			env->releaseVMAccess();
+
+			omrthread_monitor_enter(_lazySweepMutex);
+			if (STATE_SWEEPING == _threadState) {
+				if (complete) {
+					_threadState = STATE_WAITING;
+				} else {
+					/* exclusive VM access was requested, or allocating threads hold the last regions: rather than spinning on
+					 * VM access, block until a collection resumes the thread, or try again once the request is likely served
+					 */
+					omrthread_monitor_wait_timed(_lazySweepMutex, LAZY_SWEEP_THREAD_RETRY_MILLIS, 0);
+					if (STATE_SWEEPING == _threadState) {
+						_threadState = STATE_SWEEP_REQUESTED;
+					}
+				}
+			}
+		} else {
+			omrthread_monitor_wait(_lazySweepMutex);
+		}
+	}
+
+	_threadState = STATE_TERMINATED;
+	omrthread_monitor_notify(_lazySweepMutex);
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	omrthread_exit(_lazySweepMutex);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
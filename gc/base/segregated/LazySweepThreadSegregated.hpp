@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(LAZYSWEEPTHREADSEGREGATED_HPP_)
+#define LAZYSWEEPTHREADSEGREGATED_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_RegionPoolSegregated;
+
+/**
+ * Background thread sweeping the small regions a lazy sweep leaves unswept at the end of a segregated heap collection,
+ * so that allocating threads rarely have to sweep on their own. The thread sweeps with VM access, and gives it up as
+ * soon as exclusive VM access is requested; the collection then completes the sweep itself, in the pause.
+ * @ingroup GC_Modron_Realtime
+ */
+class MM_LazySweepThreadSegregated : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	typedef enum LazySweepThreadState
+	{
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_SWEEP_REQUESTED,
+		STATE_SWEEPING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} LazySweepThreadState;
+	omrthread_monitor_t _lazySweepMutex; /**< Protects _threadState and is waited on by the thread when it has nothing to sweep, or has to stop sweeping */
+	volatile LazySweepThreadState _threadState; /**< The state of the background thread (protected by _lazySweepMutex) */
+	MM_GCExtensionsBase *_extensions; /**< The GC extensions */
+	MM_RegionPoolSegregated *_regionPool; /**< The region pool holding the unswept regions (protected by _lazySweepMutex, set on resume) */
+
+/*
+ * Function members
+ */
+public:
+	/**
+	 * Early initialize: monitor creation
+	 */
+	bool initialize();
+
+	/**
+	 * Teardown resources created by initialize
+	 */
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Start up the thread, waiting until it reports success.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Shut down the thread, waiting until it has detached.
+	 */
+	void shutdown();
+
+	/**
+	 * Ask the thread to sweep the regions left unswept by the collection that just completed.
+	 * @param regionPool[in] the region pool holding the unswept regions
+	 */
+	void resume(MM_RegionPoolSegregated *regionPool);
+
+	MM_LazySweepThreadSegregated(MM_EnvironmentBase *env);
+protected:
+private:
+	/**
+	 * This is the method called by the forked thread. The function doesn't return.
+	 */
+	void lazySweepThreadEntryPoint();
+
+	/**
+	 * This is a helper function, used as a parameter to sig_protect
+	 */
+	static uintptr_t lazy_sweep_thread_proc2(OMRPortLibrary* portLib, void *info);
+
+	/**
+	 * This is a helper function, used as a parameter to omrthread_create
+	 */
+	static int J9THREAD_PROC lazy_sweep_thread_proc(void *info);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LAZYSWEEPTHREADSEGREGATED_HPP_ */
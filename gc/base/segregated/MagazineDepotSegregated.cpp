@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#include "MagazineDepotSegregated.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_MagazineDepotSegregated *
+MM_MagazineDepotSegregated::newInstance(MM_EnvironmentBase *env)
+{
+	MM_MagazineDepotSegregated *depot = (MM_MagazineDepotSegregated *)env->getForge()->allocate(sizeof(MM_MagazineDepotSegregated), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != depot) {
+		new(depot) MM_MagazineDepotSegregated();
+		if (!depot->initialize(env)) {
+			depot->kill(env);
+			depot = NULL;
+		}
+	}
+	return depot;
+}
+
+void
+MM_MagazineDepotSegregated::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_MagazineDepotSegregated::initialize(MM_EnvironmentBase *env)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL + 1; sizeClass++) {
+		_fullMagazines[sizeClass] = NULL;
+		_fullMagazineCount[sizeClass] = 0;
+	}
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		if (!_locks[sizeClass].initialize(env, &env->getExtensions()->lnrlOptions, "MM_MagazineDepotSegregated:_locks[]")) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+MM_MagazineDepotSegregated::tearDown(MM_EnvironmentBase *env)
+{
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_locks[sizeClass].tearDown();
+	}
+}
+
+void
+MM_MagazineDepotSegregated::pushMagazines(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsBytes, uintptr_t magazineBytes)
+{
+	/* Chain the magazines before taking the lock, the first magazine ends up on top of the stack */
+	MM_HeapLinkedFreeHeader *first = NULL;
+	MM_HeapLinkedFreeHeader *last = NULL;
+	uintptr_t magazineCount = 0;
+	uintptr_t offset = 0;
+	while (offset < cellsBytes) {
+		uintptr_t bytes = OMR_MIN(magazineBytes, cellsBytes - offset);
+		MM_HeapLinkedFreeHeader *magazine = MM_HeapLinkedFreeHeader::fillWithHoles((uintptr_t *)((uintptr_t)cells + offset), bytes);
+		if (NULL == first) {
+			first = magazine;
+		} else {
+			last->setNext(magazine);
+		}
+		last = magazine;
+		magazineCount += 1;
+		offset += bytes;
+	}
+
+	if (NULL != first) {
+		_locks[sizeClass].acquire();
+		last->setNext(_fullMagazines[sizeClass]);
+		_fullMagazines[sizeClass] = first;
+		_fullMagazineCount[sizeClass] += magazineCount;
+		_locks[sizeClass].release();
+	}
+}
+
+uintptr_t *
+MM_MagazineDepotSegregated::popMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *magazineBytes)
+{
+	MM_HeapLinkedFreeHeader *magazine = NULL;
+
+	/* Unlocked peek, so that threads missing in an empty depot do not contend on its lock */
+	if (NULL != _fullMagazines[sizeClass]) {
+		_locks[sizeClass].acquire();
+		magazine = _fullMagazines[sizeClass];
+		if (NULL != magazine) {
+			_fullMagazines[sizeClass] = magazine->getNext();
+			_fullMagazineCount[sizeClass] -= 1;
+			*magazineBytes = magazine->getSize();
+		}
+		_locks[sizeClass].release();
+	}
+
+	return (uintptr_t *)magazine;
+}
+
+void
+MM_MagazineDepotSegregated::flush(MM_EnvironmentBase *env)
+{
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_locks[sizeClass].acquire();
+		_fullMagazines[sizeClass] = NULL;
+		_fullMagazineCount[sizeClass] = 0;
+		_locks[sizeClass].release();
+	}
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
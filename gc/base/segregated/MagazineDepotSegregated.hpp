@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#if !defined(MAGAZINEDEPOTSEGREGATED_HPP_)
+#define MAGAZINEDEPOTSEGREGATED_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "sizeclasses.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+
+/**
+ * Per size class stacks of full magazines shared by the threads of an allocation context. A magazine is a
+ * contiguous run of free cells of one size class, carved from a region in a single refill; threads load whole
+ * magazines into their allocation caches, so they only take the region locks when both their own magazines and
+ * the depot are empty. Parked magazines are formatted as holes, which keeps the heap walkable, and the depot is
+ * emptied whenever its allocation context is flushed, so that no magazine survives into a collection.
+ * @ingroup GC_Modron_Metronome
+ */
+class MM_MagazineDepotSegregated : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	MM_HeapLinkedFreeHeader *_fullMagazines[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< stack of full magazines (per size class) */
+	uintptr_t _fullMagazineCount[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< number of magazines in _fullMagazines (per size class) */
+	MM_LightweightNonReentrantLock _locks[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< locks protecting _fullMagazines (per size class) */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+protected:
+public:
+	static MM_MagazineDepotSegregated *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Park full magazines in the depot, taking its lock once.
+	 * @param sizeClass the size class of the cells
+	 * @param cells the first cell of the magazines
+	 * @param cellsBytes the size of the cells, a multiple of the cell size
+	 * @param magazineBytes the size of a magazine, a multiple of the cell size; the last magazine may be smaller
+	 */
+	void pushMagazines(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsBytes, uintptr_t magazineBytes);
+
+	/**
+	 * Take a full magazine from the depot.
+	 * @param sizeClass the size class of the requested magazine
+	 * @param[out] magazineBytes the size of the returned magazine
+	 * @return the first cell of the magazine, or NULL if the depot holds no magazine of the size class
+	 */
+	uintptr_t *popMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *magazineBytes);
+
+	/**
+	 * Forget all parked magazines. Their cells are holes, which the next sweep reclaims.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getMagazineCount(uintptr_t sizeClass) { return _fullMagazineCount[sizeClass]; }
+
+	MM_MagazineDepotSegregated() :
+		MM_BaseNonVirtual()
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* MAGAZINEDEPOTSEGREGATED_HPP_ */
@@ -33,6 +33,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "RegionPoolSegregated.hpp"
+#include "SweepSchemeSegregated.hpp"
 
 #include "MemorySubSpaceSegregated.hpp"
 
@@ -170,6 +171,17 @@ MM_MemorySubSpaceSegregated::allocateMixedObjectOrArraylet(MM_EnvironmentBase *e
 
 		Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
 
+		/* Completing a lazy sweep left over from the last collection frees and coalesces regions, which may be enough without collecting again */
+		if (_memoryPoolSegregated->getRegionPool()->getSweepScheme()->completeLazySweep(env, _memoryPoolSegregated)) {
+			allocDescription->restoreObjects(env);
+			result = allocate(env, allocDescription, allocType);
+			if (NULL != result) {
+				reportAllocationFailureEnd(env);
+				return result;
+			}
+			allocDescription->saveObjects(env);
+		}
+
 		/* run the collector in the default mode (ie:  not explicitly aggressive) */
 		result = _collector->garbageCollect(env, this, allocDescription, J9MMCONSTANT_IMPLICIT_GC_DEFAULT, NULL, NULL, NULL);
 		allocDescription->restoreObjects(env);
@@ -335,6 +335,20 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 	}
 }
 
+/* join the lists for each buckets per size class, for all split indexes */
+void
+MM_RegionPoolSegregated::joinBucketLists(MM_EnvironmentBase *env)
+{
+	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (uintptr_t splitIndex = 0; splitIndex < _splitAvailableListSplitCount; splitIndex++) {
+			MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+			for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
+				primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
+			}
+		}
+	}
+}
+
 /**
  * Attempt to allocate a region from the given size classes available list.
  * If there are no available regions in this size class, return null.
@@ -418,6 +432,77 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::lazySweepSmallRegion(MM_EnvironmentBase *env, uintptr_t sizeClass, bool *regionFreed)
+{
+	MM_HeapRegionDescriptorSegregated *region = _smallSweepRegions[sizeClass]->dequeue();
+	*regionFreed = false;
+
+	if (NULL == region) {
+		return false;
+	}
+
+	_sweepScheme->sweepRegion(env, region);
+	decrementCurrentCountOfSweepRegions(sizeClass, 1);
+	decrementCurrentTotalCountOfSweepRegions(1);
+
+	/* the same accounting as MM_SweepSchemeSegregated::incrementalSweepSmall() */
+	MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+	uintptr_t numCells = region->getNumCells();
+	if (memoryPoolACL->getFreeCount() >= numCells) {
+		region->emptyRegionReturned(env);
+		addFreeRegion(env, region);
+		*regionFreed = true;
+	} else {
+		uintptr_t occupancy = (memoryPoolACL->getMarkCount() * 100) / numCells;
+		/* Maintain average occupancy needed for nondeterministic sweep heuristic */
+		if (env->getExtensions()->nonDeterministicSweep) {
+			updateOccupancy(sizeClass, occupancy);
+		}
+		if (memoryPoolACL->getMarkCount() == numCells) {
+			_smallFullRegions[sizeClass]->enqueue(region);
+		} else {
+			/* allocation looks in every bucket until the lazy sweep is complete, see allocateRegionFromSmallSizeClass() */
+			enqueueAvailable(region, sizeClass, occupancy, env->getEnvironmentId() % _splitAvailableListSplitCount);
+			_skipAvailableRegionForAllocation[sizeClass] = 0;
+		}
+	}
+
+	return true;
+}
+
+bool
+MM_RegionPoolSegregated::lazySweepForFreeRegion(MM_EnvironmentBase *env)
+{
+	bool regionFreed = false;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; isLazySweepPending() && (sizeClass <= OMR_SIZECLASSES_MAX_SMALL); sizeClass++) {
+		while (lazySweepSmallRegion(env, sizeClass, &regionFreed)) {
+			if (regionFreed) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool
+MM_RegionPoolSegregated::completeLazySweep(MM_EnvironmentBase *env, bool yieldToExclusiveAccess)
+{
+	bool regionFreed = false;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; isLazySweepPending() && (sizeClass <= OMR_SIZECLASSES_MAX_SMALL); sizeClass++) {
+		while (lazySweepSmallRegion(env, sizeClass, &regionFreed)) {
+			if (yieldToExclusiveAccess && env->isExclusiveAccessRequestWaiting()) {
+				return false;
+			}
+		}
+	}
+
+	return !isLazySweepPending();
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
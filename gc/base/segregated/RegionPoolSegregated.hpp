@@ -172,6 +172,28 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep one of the small regions of a size class left unswept by a lazy sweep, and move it to the free, full
+	 * or available region lists, according to what the sweep found.
+	 * @param regionFreed[out] set to true if the region was entirely free and returned to the free region lists
+	 * @return true if a region was swept, false if there was none left for the size class
+	 */
+	bool lazySweepSmallRegion(MM_EnvironmentBase *env, uintptr_t sizeClass, bool *regionFreed);
+
+	/**
+	 * Sweep the small regions left unswept by a lazy sweep, of all size classes, until one of them is returned
+	 * to the free region lists.
+	 * @return true if a region was freed, false if every region was swept without freeing one
+	 */
+	bool lazySweepForFreeRegion(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep all the small regions left unswept by a lazy sweep.
+	 * @param yieldToExclusiveAccess true to stop as soon as exclusive VM access is requested (background sweeping)
+	 * @return true if no unswept region is left
+	 */
+	bool completeLazySweep(MM_EnvironmentBase *env, bool yieldToExclusiveAccess);
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -217,6 +239,11 @@ public:
 	{
 		return _currentTotalCountOfSweepRegions;
 	}
+
+	MMINLINE bool isLazySweepPending() const
+	{
+		return 0 != _currentTotalCountOfSweepRegions;
+	}
 	
 	MMINLINE void decrementCurrentTotalCountOfSweepRegions (uintptr_t count)
 	{
@@ -255,8 +282,10 @@ public:
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
 
 	void joinBucketListsForSplitIndex(MM_EnvironmentBase *env);
+	void joinBucketLists(MM_EnvironmentBase *env);
 	
 	void setSweepScheme(MM_SweepSchemeSegregated *sweepScheme) { _sweepScheme = sweepScheme; }
+	MM_SweepSchemeSegregated *getSweepScheme() { return _sweepScheme; }
 
 	/**
 	 * Create a RegionPoolSegregated object.
@@ -274,6 +303,8 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _initialTotalCountOfSweepRegions(0)
+		, _currentTotalCountOfSweepRegions(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
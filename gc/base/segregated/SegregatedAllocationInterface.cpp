@@ -31,6 +31,7 @@
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapRegionManager.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
@@ -267,6 +268,19 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 		}
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
+
+	/* hand the spare magazines over to the other threads of the allocation context */
+	MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		if (NULL != _spareMagazines[sizeClass]) {
+			if (NULL != ac) {
+				ac->returnMagazine(env, sizeClass, _spareMagazines[sizeClass], _spareMagazineSizes[sizeClass]);
+			}
+			_spareMagazines[sizeClass] = NULL;
+			_spareMagazineSizes[sizeClass] = 0;
+		}
+	}
+
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
 }
@@ -366,6 +380,38 @@ MM_SegregatedAllocationInterface::getReplenishSize(MM_EnvironmentBase* env, uint
 	}
 }
 
+/**
+ * Keep a full magazine for the next replenish of the given size class, which must not have a spare magazine.
+ * The magazine is made walkable until it is loaded.
+ * @param cells The first cell of the magazine
+ * @param magazineSize The size in bytes of the magazine
+ */
+void
+MM_SegregatedAllocationInterface::setSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t magazineSize)
+{
+	Assert_MM_true(NULL == _spareMagazines[sizeClass]);
+	MM_HeapLinkedFreeHeader::fillWithHoles(cells, magazineSize);
+	_spareMagazines[sizeClass] = cells;
+	_spareMagazineSizes[sizeClass] = magazineSize;
+}
+
+/**
+ * Take the spare magazine of the given size class.
+ * @param[out] magazineSize The size in bytes of the magazine
+ * @return The first cell of the magazine, or NULL if the size class has no spare magazine
+ */
+uintptr_t *
+MM_SegregatedAllocationInterface::takeSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeClass, uintptr_t *magazineSize)
+{
+	uintptr_t *cells = _spareMagazines[sizeClass];
+	if (NULL != cells) {
+		*magazineSize = _spareMagazineSizes[sizeClass];
+		_spareMagazines[sizeClass] = NULL;
+		_spareMagazineSizes[sizeClass] = 0;
+	}
+	return cells;
+}
+
 void
 MM_SegregatedAllocationInterface::enableCachedAllocations(MM_EnvironmentBase* env)
 {
@@ -389,14 +435,15 @@ void
 MM_SegregatedAllocationInterface::updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
 	omrobjectptr_t base = (omrobjectptr_t) _allocationCacheBases[sizeClass];
 	omrobjectptr_t top = (omrobjectptr_t) _allocationCache[sizeClass].top;
 
 	if((NULL != _frequentObjectsStats) && (NULL != base) && (NULL != top)){
 		uintptr_t cellSize = _sizeClasses->getCellSize(sizeClass);
 
-		GC_ObjectHeapIteratorSegregated objectHeapIterator(extensions, base, top, ac->_smallRegions[sizeClass]->getRegionType(), cellSize, false, false);
+		/* the cache may have been loaded from a magazine of a region the allocation context no longer allocates from */
+		MM_HeapRegionDescriptor *region = extensions->heapRegionManager->tableDescriptorForAddress(base);
+		GC_ObjectHeapIteratorSegregated objectHeapIterator(extensions, base, top, region->getRegionType(), cellSize, false, false);
 		omrobjectptr_t object = NULL;
 		uintptr_t limit = (((uintptr_t) top - (uintptr_t) base)*extensions->frequentObjectAllocationSamplingRate)/100 + (uintptr_t) base;
 
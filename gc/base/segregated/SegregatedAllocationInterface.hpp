@@ -58,6 +58,8 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	uintptr_t *_spareMagazines[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< A full magazine held for the next replenish, NULL if none (per size class). */
+	uintptr_t _spareMagazineSizes[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The size in bytes of each spare magazine (per size class). */
 
 	/*
 	 * Function members
@@ -93,6 +95,8 @@ public:
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *cacheMemory, uintptr_t cacheSize);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
+	void setSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t magazineSize);
+	uintptr_t *takeSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeClass, uintptr_t *magazineSize);
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase *env);
 	virtual void disableCachedAllocations(MM_EnvironmentBase *env);
@@ -109,6 +113,8 @@ protected:
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
+		memset(_spareMagazines, 0, sizeof(_spareMagazines));
+		memset(_spareMagazineSizes, 0, sizeof(_spareMagazineSizes));
 	};
 	
 private:
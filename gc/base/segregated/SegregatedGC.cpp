@@ -30,6 +30,7 @@
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
@@ -112,6 +113,8 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	_lazySweepThread.tearDown(env);
 }
 
 bool
@@ -134,12 +137,24 @@ void MM_SegregatedGC::heapReconfigured(MM_EnvironmentBase* env)
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
-	return true;
+	bool result = true;
+
+	/* The default memory space does not exist yet, the region pool to sweep is handed to the thread on each resume */
+	if (extensions->lazySweep) {
+		result = _lazySweepThread.initialize() && _lazySweepThread.startup();
+		_lazySweepThreadStarted = result;
+	}
+
+	return result;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (_lazySweepThreadStarted) {
+		_lazySweepThread.shutdown();
+		_lazySweepThreadStarted = false;
+	}
 }
 
 void *
@@ -190,6 +205,15 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
 
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool();
+
+	/* Regions left unswept by the previous cycle must be swept against its mark map before the allocation contexts
+	 * hand their regions back for sweeping and the mark map is cleared. The background thread has given up VM access.
+	 */
+	if (_extensions->lazySweep) {
+		memoryPool->getRegionPool()->completeLazySweep(env, false);
+	}
+
 	/* OMRTODO the allocation contexts are never flushed for realtime, do
 	 * we really need to do this here? */
 	/* Flush the allocation contexts */
@@ -227,7 +251,7 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
+	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
 	_dispatcher->run(env, &sweepTask);
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
@@ -249,6 +273,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	/* Small regions were left on the sweep lists, let the background thread sweep them ahead of the allocating threads */
+	if (_lazySweepThreadStarted) {
+		_lazySweepThread.resume(memoryPool->getRegionPool());
+	}
+
 	return true;
 }
 
@@ -28,6 +28,7 @@
 
 #include "CollectionStatisticsStandard.hpp"
 #include "GlobalCollector.hpp"
+#include "LazySweepThreadSegregated.hpp"
 #include "MarkMap.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SweepSchemeSegregated.hpp"
@@ -48,6 +49,8 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+	MM_LazySweepThreadSegregated _lazySweepThread; /**< Background thread sweeping the regions left unswept by a lazy sweep */
+	bool _lazySweepThreadStarted; /**< True if the lazy sweep background thread has been started */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -120,6 +123,8 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _lazySweepThread(env)
+		, _lazySweepThreadStarted(false)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -120,16 +120,38 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
-	regionPool->joinBucketListsForSplitIndex(env);
+	/* with a lazy sweep the small regions stay on the sweep lists, allocating threads and the background thread sweep them on demand */
+	bool lazySweep = env->getExtensions()->lazySweep && !isFixHeapForWalk;
+	if (!lazySweep) {
+		incrementalSweepSmall(env);
+		regionPool->joinBucketListsForSplitIndex(env);
+	}
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
-		regionPool->setSweepSmallPages(false);
+		/* regions swept lazily go to the bucket of their occupancy, which allocation has to keep looking in */
+		regionPool->setSweepSmallPages(lazySweep);
 		postSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+bool
+MM_SweepSchemeSegregated::completeLazySweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	MM_RegionPoolSegregated *regionPool = memoryPool->getRegionPool();
+	bool lazySweepPending = regionPool->isLazySweepPending();
+
+	if (lazySweepPending) {
+		_memoryPool = memoryPool;
+		regionPool->completeLazySweep(env, false);
+		regionPool->joinBucketLists(env);
+		regionPool->setSweepSmallPages(false);
+		incrementalCoalesceFreeRegions(env);
+	}
+
+	return lazySweepPending;
+}
+
 void
 MM_SweepSchemeSegregated::preSweep(MM_EnvironmentBase *env)
 {
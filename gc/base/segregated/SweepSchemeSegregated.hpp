@@ -66,6 +66,13 @@ public:
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
+	/**
+	 * Sweep the small regions a lazy sweep left unswept and coalesce the free regions, so that a multi-region
+	 * allocation can see the regions freed since the collection. Must be called with exclusive VM access.
+	 * @return true if there were unswept regions
+	 */
+	bool completeLazySweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
 protected:
@@ -47,6 +47,7 @@
 #include "HeapStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -67,6 +68,9 @@
 #undef UT_MODULE_UNLOADED
 #include "ut_omrmm.h"
 
+/* number of times a thread yields while waiting for a summary chunk to be moved before it blocks */
+#define SUMMARY_CHUNK_WAIT_SPIN_COUNT 64
+
 #if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
 #define getConsumedSizeInBytesWithHeaderForMove getConsumedSizeInBytesWithHeader
 #endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
@@ -280,12 +284,20 @@ public:
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 {
+	if (0 != omrthread_monitor_init_with_name(&_summaryChunkMonitor, 0, "MM_CompactScheme::_summaryChunkMonitor")) {
+		return false;
+	}
 	return _delegate.initialize(env, _omrVM, _markMap, this);
 }
 
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	tearDownSummaryTable(env);
+	if (NULL != _summaryChunkMonitor) {
+		omrthread_monitor_destroy(_summaryChunkMonitor);
+		_summaryChunkMonitor = NULL;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -348,7 +360,7 @@ MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThrea
 }
 
 void
-MM_CompactScheme::masterSetupForGC(MM_EnvironmentStandard *env)
+MM_CompactScheme::masterSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded)
 {
 	_heap = _extensions->heap;
 	_rootManager = _heap->getHeapRegionManager();
@@ -356,6 +368,20 @@ MM_CompactScheme::masterSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+	_summaryTableActive = false;
+#if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* The summary table assumes objects keep their size when moved, which does not hold once hash codes can be inserted on move.
+	 * Single threaded compactions keep to the sub area scheme, which runs them on the master thread.
+	 */
+	if (_extensions->compactSummaryTable && !singleThreaded) {
+		_summaryTableActive = initializeSummaryTable(env);
+		if (_summaryTableActive) {
+			/* every live object in the heap gets a compact table entry */
+			_compactFrom = (omrobjectptr_t)_heap->getHeapBase();
+			_compactTo = (omrobjectptr_t)_heap->getHeapTop();
+		}
+	}
+#endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 	_delegate.masterSetupForGC(env);
 }
 
@@ -537,12 +563,22 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	uintptr_t fixupObjectsCount = 0;
 	bool singleThreaded = false;
 
+	/* We force a single sub area compaction if:
+	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
+	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
+	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
+	 *  o no slave GC threads
+	 */
+	if (aggressive || (1 == env->_currentTask->getThreadCount())) {
+		singleThreaded = true;
+	}
+
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		/* Do any necessary initialization */
 		/* TODO: Perhaps the task dispatch should occur internally within so that the initialization doesn't need to be
 		 * done at a synchronize point?
 		 */
-		masterSetupForGC(env);
+		masterSetupForGC(env, singleThreaded);
 #if defined(DEBUG)
 		_delegate.verifyHeap(env, _markMap);
 #endif /* DEBUG */
@@ -553,42 +589,50 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	/* We force a single sub area compaction if:
-	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
-	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
-	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
-	 *  o no slave GC threads
-	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())) {
-		singleThreaded = true;
-	}
-
-	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
-	env->_compactStats._setupEndTime = omrtime_hires_clock();
+	if (_summaryTableActive) {
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		completeSubAreaTable(env);
+		computeSummaryTable(env);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
 
-	/* If a single threaded compaction force compact to run on master thread. Required
-	 * to ensure all events issued on master thread.
-	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
+		moveObjectsUsingSummaryTable(env, objectCount, byteCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
 
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
 
 		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupObjectsUsingSummaryTable(env, fixupObjectsCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	} else {
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		workerSetupForGC(env, singleThreaded);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
 
-		fixupObjects(env, fixupObjectsCount);
+		/* If a single threaded compaction force compact to run on master thread. Required
+		 * to ensure all events issued on master thread.
+		 */
+		if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
 
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
+
+			fixupObjects(env, fixupObjectsCount);
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
 
-		if (singleThreaded) {
-			env->_currentTask->releaseSynchronizedGCThreads(env);
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
+
+			if (singleThreaded) {
+				env->_currentTask->releaseSynchronizedGCThreads(env);
+			}
 		}
 	}
 
@@ -600,7 +644,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	MM_AtomicOperations::sync();
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
-		rebuildFreelist(env);
+		if (_summaryTableActive) {
+			rebuildFreelistUsingSummaryTable(env);
+		} else {
+			rebuildFreelist(env);
+		}
 
 		MM_MemoryPool *memoryPool;
 		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
@@ -614,7 +662,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_summaryTableActive) {
+			rebuildMarkbitsUsingSummaryTable(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -1461,6 +1513,11 @@ MM_CompactScheme::fixHeapForWalk(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
 {
+	if (_summaryTableActive) {
+		/* every region was compacted in full and its free tail formatted, so there is nothing to fix */
+		return;
+	}
+
 	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
 	GC_HeapRegionIteratorStandard regionIterator(regionManager);
 	MM_HeapRegionDescriptorStandard *region = NULL;
@@ -1515,4 +1572,296 @@ MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * en
 	return successful;
 }
 
+
+bool
+MM_CompactScheme::initializeSummaryTable(MM_EnvironmentStandard *env)
+{
+	uintptr_t chunkSize = MM_Math::roundToCeiling(sizeof_page, OMR_MAX(_extensions->compactSummaryChunkSize, (uintptr_t)sizeof_page));
+
+	/* count the tables entries required by the committed regions */
+	uintptr_t regionCount = 0;
+	uintptr_t blockCount = 0;
+	uintptr_t chunkCount = 0;
+	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionCounter.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		void *rangeBase = region->getLowAddress();
+		while (rangeBase < region->getHighAddress()) {
+			void *rangeTop = getSummaryRangeTop(env, region, rangeBase);
+			/* chunks must cover whole pages since the compact table overlays the mark bits of a page, so
+			 * leave heaps with a pool boundary inside a page (e.g. a finely aligned LOA) to the sub area scheme
+			 */
+			if ((rangeTop != region->getHighAddress()) && (0 != pageOffset((omrobjectptr_t)rangeTop))) {
+				return false;
+			}
+			uintptr_t rangeChunkCount = MM_CompactSummaryTable::getChunkCountForSize((uintptr_t)rangeTop - (uintptr_t)rangeBase, chunkSize);
+			regionCount += 1;
+			chunkCount += rangeChunkCount;
+			blockCount += MM_CompactSummaryTable::getBlockCountForChunks(rangeChunkCount);
+			rangeBase = rangeTop;
+		}
+	}
+
+	/* the heap may have grown since the last compaction */
+	uintptr_t memorySize = MM_CompactSummaryTable::getTableSize(regionCount, blockCount, chunkCount);
+	if (memorySize > _summaryTableMemorySize) {
+		tearDownSummaryTable(env);
+		_summaryTableMemory = env->getForge()->allocate(memorySize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _summaryTableMemory) {
+			return false;
+		}
+		_summaryTableMemorySize = memorySize;
+	}
+	_summaryTable.attach(_summaryTableMemory, regionCount, blockCount, chunkSize);
+
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		Assert_MM_true(0 == pageOffset((omrobjectptr_t)region->getLowAddress()));
+		void *rangeBase = region->getLowAddress();
+		while (rangeBase < region->getHighAddress()) {
+			void *rangeTop = getSummaryRangeTop(env, region, rangeBase);
+			_summaryTable.addRegion(region, (uintptr_t)rangeBase, (uintptr_t)rangeTop);
+			rangeBase = rangeTop;
+		}
+	}
+	Assert_MM_true((regionCount == _summaryTable.getRegionCount()) && (blockCount == _summaryTable.getBlockCount()) && (chunkCount == _summaryTable.getChunkCount()));
+
+	return true;
+}
+
+void *
+MM_CompactScheme::getSummaryRangeTop(MM_EnvironmentStandard *env, MM_HeapRegionDescriptorStandard *region, void *rangeBase)
+{
+	void *rangeTop = NULL;
+	region->getSubSpace()->getMemoryPool(env, rangeBase, region->getHighAddress(), rangeTop);
+	if (NULL == rangeTop) {
+		rangeTop = region->getHighAddress();
+	}
+	return rangeTop;
+}
+
+void
+MM_CompactScheme::tearDownSummaryTable(MM_EnvironmentBase *env)
+{
+	if (NULL != _summaryTableMemory) {
+		env->getForge()->free(_summaryTableMemory);
+		_summaryTableMemory = NULL;
+		_summaryTableMemorySize = 0;
+	}
+	_summaryTable.detach();
+}
+
+void
+MM_CompactScheme::computeSummaryTable(MM_EnvironmentStandard *env)
+{
+	/* Parallel pass over the mark map: live bytes of every chunk and every block. The chunk
+	 * liveEnd is the end of its last live object for now, the running maximum is filled in below.
+	 */
+	uintptr_t blockCount = _summaryTable.getBlockCount();
+	for (uintptr_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_CompactSummaryTable::BlockEntry *block = _summaryTable.getBlock(blockIndex);
+			uintptr_t chunkTop = block->firstChunk + block->chunkCount;
+			for (uintptr_t chunkIndex = block->firstChunk; chunkIndex < chunkTop; chunkIndex++) {
+				MM_CompactSummaryTable::ChunkEntry *chunk = _summaryTable.getChunk(chunkIndex);
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)chunk->base, (uintptr_t *)chunk->top);
+				omrobjectptr_t objectPtr = NULL;
+				uintptr_t liveBytes = 0;
+				omrobjectptr_t liveEnd = NULL;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					liveBytes += objectSize;
+					liveEnd = (omrobjectptr_t)((uintptr_t)objectPtr + objectSize);
+				}
+				_summaryTable.setChunkLiveness(block, chunk, liveBytes, liveEnd);
+			}
+		}
+	}
+
+	/* Exclusive scan of the block totals, restarting at the base of every region */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		uintptr_t regionCount = _summaryTable.getRegionCount();
+		for (uintptr_t regionIndex = 0; regionIndex < regionCount; regionIndex++) {
+			_summaryTable.scanRegion(regionIndex);
+		}
+		env->_compactStats._summaryChunks = _summaryTable.getChunkCount();
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Parallel pass distributing the block offsets to the chunks */
+	for (uintptr_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			_summaryTable.distributeBlock(blockIndex);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+}
+
+void
+MM_CompactScheme::waitForSummaryChunkSources(MM_EnvironmentStandard *env, uintptr_t chunkIndex)
+{
+	/* Chunks are claimed in ascending order, so every chunk we depend on has an owner which
+	 * will not itself wait on us.
+	 */
+	for (uintptr_t sourceIndex = _summaryTable.findFirstSourceChunk(chunkIndex); sourceIndex < chunkIndex; sourceIndex++) {
+		MM_CompactSummaryTable::ChunkEntry *source = _summaryTable.getChunk(sourceIndex);
+		if (0 == source->moved) {
+			env->_compactStats._summaryChunkWaits += 1;
+			for (uintptr_t spinCount = SUMMARY_CHUNK_WAIT_SPIN_COUNT; (0 == source->moved) && (spinCount > 0); spinCount--) {
+				MM_AtomicOperations::yieldCPU();
+			}
+			if (0 == source->moved) {
+				/* The owner of the source chunk may be descheduled or moving a large object, so block rather than burn the CPU.
+				 * Publishing the waiter before re-reading moved pairs with moveSummaryChunk(), which sets moved before reading
+				 * the waiter count, so either the owner sees the waiter or the waiter sees the chunk moved.
+				 */
+				omrthread_monitor_enter(_summaryChunkMonitor);
+				_summaryChunkWaiters += 1;
+				MM_AtomicOperations::sync();
+				while (0 == source->moved) {
+					omrthread_monitor_wait(_summaryChunkMonitor);
+				}
+				_summaryChunkWaiters -= 1;
+				omrthread_monitor_exit(_summaryChunkMonitor);
+			}
+		}
+	}
+	MM_AtomicOperations::loadSync();
+}
+
+void
+MM_CompactScheme::moveSummaryChunk(MM_EnvironmentStandard *env, uintptr_t chunkIndex, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_CompactSummaryTable::ChunkEntry *chunk = _summaryTable.getChunk(chunkIndex);
+
+	if (0 != chunk->liveBytes) {
+		waitForSummaryChunkSources(env, chunkIndex);
+
+		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)chunk->base, (uintptr_t *)chunk->top);
+		omrobjectptr_t destination = chunk->destination;
+		omrobjectptr_t objectPtr = NULL;
+		omrobjectptr_t nextObject = NULL;
+		intptr_t page = -1; /* invalid value */
+		intptr_t counter = 0; /* obj on page, first is zero */
+		CompactTableEntry entry;
+		/* fetch the next object before moving the current one, as the move may overwrite its header */
+		for (objectPtr = markedObjectIterator.nextObject(); NULL != objectPtr; objectPtr = nextObject) {
+			nextObject = markedObjectIterator.nextObject();
+			uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+
+			/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+			saveForwardingPtr(entry, objectPtr, destination, page, counter);
+
+			if (destination != objectPtr) {
+				memmove(destination, objectPtr, objectSize);
+				objectCount += 1;
+				byteCount += objectSize;
+			}
+			destination = (omrobjectptr_t)((uintptr_t)destination + objectSize);
+		}
+
+		if (-1 != page) {
+			_compactTable[page] = entry;
+		}
+		Assert_MM_true(destination == (omrobjectptr_t)((uintptr_t)chunk->destination + chunk->liveBytes));
+	}
+
+	MM_AtomicOperations::storeSync();
+	chunk->moved = 1;
+	MM_AtomicOperations::sync();
+	if (0 != _summaryChunkWaiters) {
+		omrthread_monitor_enter(_summaryChunkMonitor);
+		omrthread_monitor_notify_all(_summaryChunkMonitor);
+		omrthread_monitor_exit(_summaryChunkMonitor);
+	}
+}
+
+void
+MM_CompactScheme::moveObjectsUsingSummaryTable(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	for (uintptr_t chunkIndex = 0; chunkIndex < _summaryTable.getChunkCount(); chunkIndex++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			moveSummaryChunk(env, chunkIndex, objectCount, byteCount);
+		}
+	}
+}
+
+void
+MM_CompactScheme::fixupObjectsUsingSummaryTable(MM_EnvironmentStandard *env, uintptr_t &objectCount)
+{
+	for (uintptr_t chunkIndex = 0; chunkIndex < _summaryTable.getChunkCount(); chunkIndex++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_CompactSummaryTable::ChunkEntry *chunk = _summaryTable.getChunk(chunkIndex);
+			if (0 != chunk->liveBytes) {
+				omrobjectptr_t finish = (omrobjectptr_t)((uintptr_t)chunk->destination + chunk->liveBytes);
+				fixupSubArea(env, chunk->destination, finish, false, objectCount);
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::rebuildFreelistUsingSummaryTable(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t regionIndex = 0; regionIndex < _summaryTable.getRegionCount(); regionIndex++) {
+		MM_CompactSummaryTable::RegionEntry *regionEntry = _summaryTable.getRegion(regionIndex);
+		MM_MemorySubSpace *memorySubSpace = regionEntry->region->getSubSpace();
+
+		MM_CompactMemoryPoolState poolStateObj;
+		MM_CompactMemoryPoolState *poolState = &poolStateObj;
+		/* table regions never span a memory pool boundary */
+		poolState->_memoryPool = memorySubSpace->getMemoryPool(regionEntry->lowAddress);
+
+		/* the only free space left in the region is above its compacted live data */
+		void *currentFreeBase = (void *)regionEntry->newTop;
+		uintptr_t currentFreeSize = (uintptr_t)regionEntry->highAddress - (uintptr_t)currentFreeBase;
+		if (0 != currentFreeSize) {
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+		}
+
+		if (NULL != poolState->_freeListHead) {
+			/* Terminate the free list with NULL*/
+			poolState->_memoryPool->createFreeEntry(env, poolState->_previousFreeEntry,
+													(uint8_t *)poolState->_previousFreeEntry + poolState->_previousFreeEntrySize);
+		}
+		flushPool(env, poolState);
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsUsingSummaryTable(MM_EnvironmentStandard *env)
+{
+	/* The compact table overlays the mark bits, so clear everything before setting any bit */
+	for (uintptr_t chunkIndex = 0; chunkIndex < _summaryTable.getChunkCount(); chunkIndex++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_CompactSummaryTable::ChunkEntry *chunk = _summaryTable.getChunk(chunkIndex);
+			_markMap->setBitsInRange(env, chunk->base, chunk->top, true);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/* Destination ranges of neighbouring chunks may share a mark map slot */
+	for (uintptr_t chunkIndex = 0; chunkIndex < _summaryTable.getChunkCount(); chunkIndex++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_CompactSummaryTable::ChunkEntry *chunk = _summaryTable.getChunk(chunkIndex);
+			if (0 != chunk->liveBytes) {
+				omrobjectptr_t finish = (omrobjectptr_t)((uintptr_t)chunk->destination + chunk->liveBytes);
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, chunk->destination, finish, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					_markMap->atomicSetBit(objectPtr);
+				}
+			}
+		}
+	}
+}
+
 #endif /* OMR_GC_MODRON_COMPACTION */
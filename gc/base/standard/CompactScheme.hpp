@@ -38,6 +38,7 @@
 #include "MarkMap.hpp"
 #include "SlotObject.hpp"
 #include "CompactDelegate.hpp"
+#include "CompactSummaryTable.hpp"
 
 class MM_AllocateDescription;
 class MM_EnvironmentStandard;
@@ -140,6 +141,13 @@ protected:
     omrobjectptr_t _compactTo;
     MM_CompactDelegate _delegate;
 
+    bool _summaryTableActive; /**< true if the current (or last) compaction used the summary table */
+    void *_summaryTableMemory; /**< backing store for the summary region, block and chunk tables */
+    uintptr_t _summaryTableMemorySize; /**< size in bytes of _summaryTableMemory */
+    MM_CompactSummaryTable _summaryTable; /**< region, block and chunk tables laid out in _summaryTableMemory */
+    omrthread_monitor_t _summaryChunkMonitor; /**< monitor on which threads block until the chunks overlapping the destination of their chunk are moved */
+    volatile uintptr_t _summaryChunkWaiters; /**< number of threads blocked on _summaryChunkMonitor (only modified while holding it) */
+
 public:
 
     /*
@@ -302,13 +310,70 @@ protected:
      * @return true if the action was changed, or false if another thread already changed it to newAction
      */
     bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
+
+    /**
+     * Build the summary region, block and chunk tables for the committed regions of the heap,
+     * growing the backing store if required. Every region is split at its memory pool boundaries
+     * (e.g. SOA/LOA), so live objects never slide from one pool into another.
+     *
+     * @param env[in] the master thread
+     * @return true if the tables were built, false if the backing store could not be allocated or
+     * a pool boundary is not aligned to a compact table page
+     */
+    bool initializeSummaryTable(MM_EnvironmentStandard *env);
+    void tearDownSummaryTable(MM_EnvironmentBase *env);
+
+    /**
+     * @return the end of the part of the region from rangeBase which belongs to the memory pool of rangeBase
+     */
+    void *getSummaryRangeTop(MM_EnvironmentStandard *env, MM_HeapRegionDescriptorStandard *region, void *rangeBase);
+
+    /**
+     * Compute the live bytes and destination of every chunk. Live bytes are summed per block in
+     * parallel from the mark map, the block totals are scanned by the master thread and the
+     * chunk destinations are then derived in parallel from the block offsets.
+     *
+     * @param env[in] the current thread
+     */
+    void computeSummaryTable(MM_EnvironmentStandard *env);
+
+    /**
+     * Wait until every chunk whose live objects overlap the destination range of the
+     * specified chunk has been moved, blocking on _summaryChunkMonitor if a short spin does not suffice.
+     *
+     * @param env[in] the current thread
+     * @param chunkIndex[in] the chunk about to be moved
+     */
+    void waitForSummaryChunkSources(MM_EnvironmentStandard *env, uintptr_t chunkIndex);
+
+    /**
+     * Slide the live objects of a chunk to its precomputed destination, recording forwarding
+     * information in the compact table.
+     *
+     * @param env[in] the current thread
+     * @param chunkIndex[in] the chunk to move
+     * @param[in/out] objectCount the number of objects moved (accumulated)
+     * @param[in/out] byteCount the number of bytes moved (accumulated)
+     */
+    void moveSummaryChunk(MM_EnvironmentStandard *env, uintptr_t chunkIndex, uintptr_t &objectCount, uintptr_t &byteCount);
+
+    void moveObjectsUsingSummaryTable(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+    void fixupObjectsUsingSummaryTable(MM_EnvironmentStandard *env, uintptr_t &objectCount);
+    void rebuildFreelistUsingSummaryTable(MM_EnvironmentStandard *env);
+    void rebuildMarkbitsUsingSummaryTable(MM_EnvironmentStandard *env);
 public:
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
 	void kill(MM_EnvironmentBase *env);
 
     void workerSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
-	void masterSetupForGC(MM_EnvironmentStandard *env);
+	/**
+	 * Master thread setup of a compaction.
+	 * @param env[in] the master thread
+	 * @param singleThreaded[in] true if the compaction must use a single sub area per region, in which
+	 * case the summary table is not used
+	 */
+	void masterSetupForGC(MM_EnvironmentStandard *env, bool singleThreaded);
     virtual void compact(MM_EnvironmentBase *env, bool rebuildMarkBits, bool aggressive);
     omrobjectptr_t getForwardingPtr(omrobjectptr_t objectPtr) const;
 	void flushPool(MM_EnvironmentStandard *env, MM_CompactMemoryPoolState *freeListState);
@@ -336,6 +401,12 @@ public:
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
     	, _delegate()
+    	, _summaryTableActive(false)
+    	, _summaryTableMemory(NULL)
+    	, _summaryTableMemorySize(0)
+    	, _summaryTable()
+    	, _summaryChunkMonitor(NULL)
+    	, _summaryChunkWaiters(0)
     {
     	_typeId = __FUNCTION__;
     }
@@ -0,0 +1,293 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(COMPACTSUMMARYTABLE_HPP_)
+#define COMPACTSUMMARYTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_HeapRegionDescriptorStandard;
+
+/**
+ * Region, block and chunk tables of the summary table sliding compaction (see MM_CompactScheme).
+ * Every region is split into fixed size chunks, and consecutive chunks of a region are grouped into
+ * blocks, the work units of the prefix sum which computes the chunk destinations. This class only
+ * lays out the tables and does their arithmetic: it never reads or writes the heap.
+ */
+class MM_CompactSummaryTable : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Entry for one chunk of a region. Live objects are attributed to the chunk in which they start.
+	 */
+	struct ChunkEntry {
+		omrobjectptr_t base; /**< first heap address covered by the chunk */
+		omrobjectptr_t top; /**< first heap address beyond the chunk */
+		omrobjectptr_t destination; /**< new address of the first live object starting in the chunk */
+		omrobjectptr_t liveEnd; /**< highest end address of a live object starting in this chunk or an earlier chunk of the region */
+		uintptr_t liveBytes; /**< bytes consumed by live objects starting in the chunk */
+		uintptr_t regionIndex; /**< index of the owning entry in the region table */
+		volatile uintptr_t moved; /**< set once all live objects of the chunk have been moved */
+	};
+
+	/**
+	 * Entry for a group of consecutive chunks within one region.
+	 */
+	struct BlockEntry {
+		uintptr_t firstChunk; /**< index of the first chunk of the block */
+		uintptr_t chunkCount; /**< number of chunks in the block */
+		uintptr_t liveBytes; /**< sum of the live bytes of all chunks in the block */
+		omrobjectptr_t liveEnd; /**< highest live object end in the block (NULL if the block is empty) */
+		omrobjectptr_t destination; /**< new address of the first live object of the block */
+		omrobjectptr_t liveEndCarry; /**< highest live object end of all earlier blocks in the region */
+	};
+
+	struct RegionEntry {
+		MM_HeapRegionDescriptorStandard *region;
+		omrobjectptr_t lowAddress; /**< base of the region, where its live data slides to */
+		omrobjectptr_t highAddress; /**< first heap address beyond the region */
+		uintptr_t firstChunk; /**< index of the first chunk of the region */
+		uintptr_t firstBlock; /**< index of the first block of the region */
+		uintptr_t blockCount; /**< number of blocks in the region */
+		omrobjectptr_t newTop; /**< end of the live data in the region once compacted */
+	};
+
+	enum { block_chunks = 64 }; /**< number of chunks per block */
+
+private:
+	RegionEntry *_regions;
+	BlockEntry *_blocks;
+	ChunkEntry *_chunks;
+	uintptr_t _regionCount;
+	uintptr_t _blockCount;
+	uintptr_t _chunkCount;
+	uintptr_t _chunkSize; /**< heap bytes covered by one chunk */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * @return the number of chunks of chunkSize bytes needed to cover size bytes (size must not be 0)
+	 */
+	static MMINLINE uintptr_t getChunkCountForSize(uintptr_t size, uintptr_t chunkSize) { return ((size - 1) / chunkSize) + 1; }
+
+	/**
+	 * @return the number of blocks needed for chunkCount chunks of one region (chunkCount must not be 0)
+	 */
+	static MMINLINE uintptr_t getBlockCountForChunks(uintptr_t chunkCount) { return ((chunkCount - 1) / block_chunks) + 1; }
+
+	/**
+	 * @return the size in bytes of the memory passed to attach() for tables of the specified sizes
+	 */
+	static MMINLINE uintptr_t
+	getTableSize(uintptr_t regionCount, uintptr_t blockCount, uintptr_t chunkCount)
+	{
+		return (regionCount * sizeof(RegionEntry)) + (blockCount * sizeof(BlockEntry)) + (chunkCount * sizeof(ChunkEntry));
+	}
+
+	/**
+	 * Lay the tables out in memory (of at least getTableSize() bytes) and empty them.
+	 * Regions are then added in address order with addRegion().
+	 */
+	MMINLINE void
+	attach(void *memory, uintptr_t regionCount, uintptr_t blockCount, uintptr_t chunkSize)
+	{
+		_regions = (RegionEntry *)memory;
+		_blocks = (BlockEntry *)((uintptr_t)memory + (regionCount * sizeof(RegionEntry)));
+		_chunks = (ChunkEntry *)((uintptr_t)_blocks + (blockCount * sizeof(BlockEntry)));
+		_regionCount = 0;
+		_blockCount = 0;
+		_chunkCount = 0;
+		_chunkSize = chunkSize;
+	}
+
+	/**
+	 * Empty the tables and forget their memory.
+	 */
+	MMINLINE void
+	detach()
+	{
+		_regions = NULL;
+		_blocks = NULL;
+		_chunks = NULL;
+		_regionCount = 0;
+		_blockCount = 0;
+		_chunkCount = 0;
+	}
+
+	/**
+	 * Append the chunks and blocks covering [lowAddress, highAddress), the last chunk being cut short at highAddress.
+	 */
+	MMINLINE void
+	addRegion(MM_HeapRegionDescriptorStandard *region, uintptr_t lowAddress, uintptr_t highAddress)
+	{
+		RegionEntry *regionEntry = &_regions[_regionCount];
+		regionEntry->region = region;
+		regionEntry->lowAddress = (omrobjectptr_t)lowAddress;
+		regionEntry->highAddress = (omrobjectptr_t)highAddress;
+		regionEntry->firstChunk = _chunkCount;
+		regionEntry->firstBlock = _blockCount;
+		regionEntry->blockCount = 0;
+		regionEntry->newTop = (omrobjectptr_t)lowAddress;
+
+		for (uintptr_t base = lowAddress; base < highAddress; base += _chunkSize) {
+			if (0 == ((_chunkCount - regionEntry->firstChunk) % block_chunks)) {
+				BlockEntry *block = &_blocks[_blockCount];
+				block->firstChunk = _chunkCount;
+				block->chunkCount = 0;
+				block->liveBytes = 0;
+				block->liveEnd = NULL;
+				block->destination = NULL;
+				block->liveEndCarry = NULL;
+				regionEntry->blockCount += 1;
+				_blockCount += 1;
+			}
+			_blocks[_blockCount - 1].chunkCount += 1;
+
+			ChunkEntry *chunk = &_chunks[_chunkCount];
+			chunk->base = (omrobjectptr_t)base;
+			chunk->top = (omrobjectptr_t)(((highAddress - base) > _chunkSize) ? (base + _chunkSize) : highAddress);
+			chunk->destination = NULL;
+			chunk->liveEnd = NULL;
+			chunk->liveBytes = 0;
+			chunk->regionIndex = _regionCount;
+			chunk->moved = 0;
+			_chunkCount += 1;
+		}
+		_regionCount += 1;
+	}
+
+	/**
+	 * Record the live data starting in a chunk, and add it to the totals of its block.
+	 * @param liveEnd[in] the end of the last live object starting in the chunk, or NULL if there is none
+	 */
+	MMINLINE void
+	setChunkLiveness(BlockEntry *block, ChunkEntry *chunk, uintptr_t liveBytes, omrobjectptr_t liveEnd)
+	{
+		chunk->liveBytes = liveBytes;
+		chunk->liveEnd = liveEnd;
+		block->liveBytes += liveBytes;
+		if (NULL != liveEnd) {
+			block->liveEnd = liveEnd;
+		}
+	}
+
+	/**
+	 * Exclusive scan of the block totals of a region, starting from the region base. Sets the
+	 * destination and live end carry of every block, and the new top of the region.
+	 */
+	MMINLINE void
+	scanRegion(uintptr_t regionIndex)
+	{
+		RegionEntry *regionEntry = &_regions[regionIndex];
+		omrobjectptr_t destination = regionEntry->lowAddress;
+		omrobjectptr_t liveEnd = destination;
+		uintptr_t blockTop = regionEntry->firstBlock + regionEntry->blockCount;
+		for (uintptr_t blockIndex = regionEntry->firstBlock; blockIndex < blockTop; blockIndex++) {
+			BlockEntry *block = &_blocks[blockIndex];
+			block->destination = destination;
+			block->liveEndCarry = liveEnd;
+			destination = (omrobjectptr_t)((uintptr_t)destination + block->liveBytes);
+			if (NULL != block->liveEnd) {
+				liveEnd = block->liveEnd;
+			}
+		}
+		regionEntry->newTop = destination;
+	}
+
+	/**
+	 * Distribute the destination of a scanned block to its chunks, turning the chunk live ends
+	 * into the running maximum over the region.
+	 */
+	MMINLINE void
+	distributeBlock(uintptr_t blockIndex)
+	{
+		BlockEntry *block = &_blocks[blockIndex];
+		omrobjectptr_t destination = block->destination;
+		omrobjectptr_t liveEnd = block->liveEndCarry;
+		uintptr_t chunkTop = block->firstChunk + block->chunkCount;
+		for (uintptr_t chunkIndex = block->firstChunk; chunkIndex < chunkTop; chunkIndex++) {
+			ChunkEntry *chunk = &_chunks[chunkIndex];
+			chunk->destination = destination;
+			destination = (omrobjectptr_t)((uintptr_t)destination + chunk->liveBytes);
+			if (NULL != chunk->liveEnd) {
+				liveEnd = chunk->liveEnd;
+			}
+			chunk->liveEnd = liveEnd;
+			chunk->moved = 0;
+		}
+	}
+
+	/**
+	 * Find the first chunk whose live objects reach into the destination range of the specified chunk,
+	 * once the blocks are distributed. Live ends never decrease within a region, so the chunks which must
+	 * be moved before this one are those from the returned index up to (not including) chunkIndex.
+	 */
+	MMINLINE uintptr_t
+	findFirstSourceChunk(uintptr_t chunkIndex)
+	{
+		ChunkEntry *chunk = &_chunks[chunkIndex];
+		uintptr_t low = _regions[chunk->regionIndex].firstChunk;
+		uintptr_t high = chunkIndex;
+		while (low < high) {
+			uintptr_t middle = low + ((high - low) / 2);
+			if (_chunks[middle].liveEnd > chunk->destination) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
+		}
+		return low;
+	}
+
+	MMINLINE RegionEntry *getRegion(uintptr_t regionIndex) { return &_regions[regionIndex]; }
+	MMINLINE BlockEntry *getBlock(uintptr_t blockIndex) { return &_blocks[blockIndex]; }
+	MMINLINE ChunkEntry *getChunk(uintptr_t chunkIndex) { return &_chunks[chunkIndex]; }
+	MMINLINE uintptr_t getRegionCount() { return _regionCount; }
+	MMINLINE uintptr_t getBlockCount() { return _blockCount; }
+	MMINLINE uintptr_t getChunkCount() { return _chunkCount; }
+	MMINLINE uintptr_t getChunkSize() { return _chunkSize; }
+
+	MM_CompactSummaryTable()
+		: MM_BaseNonVirtual()
+		, _regions(NULL)
+		, _blocks(NULL)
+		, _chunks(NULL)
+		, _regionCount(0)
+		, _blockCount(0)
+		, _chunkCount(0)
+		, _chunkSize(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* COMPACTSUMMARYTABLE_HPP_ */
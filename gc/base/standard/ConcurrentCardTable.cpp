@@ -28,6 +28,7 @@
 #include <stdlib.h>
 
 #include "AtomicOperations.hpp"
+#include "CardTableScan.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -1639,26 +1640,9 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
-
+			/* The card table is mostly clean so skip runs of clean cards in bulk; see MM_CardTableScan */
+			if ((Card)CARD_CLEAN == *currentCard) {
+				currentCard = MM_CardTableScan::findNonCleanCard(currentCard + 1, lastCardToClean);
 				if (currentCard >= lastCardToClean) {
 					break;
 				}
@@ -1691,10 +1675,13 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 					break;
 				}
 				
+				env->_cardCleaningStats._cardsScanned += (currentCard - firstCard);
 				return nextDirtyCard;
 			}
 		} /* of currentCard < lastCardToClean */
 
+		env->_cardCleaningStats._cardsScanned += (currentCard - firstCard);
+
 		/* We get here if we break out of FOR loop when another thread beat us to next
 		 * dirty card or we reach then end of the card table.
 		 *
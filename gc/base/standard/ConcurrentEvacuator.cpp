@@ -0,0 +1,454 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include <string.h>
+
+#include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
+#include "Collector.hpp"
+#include "ConcurrentEvacuator.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMapIterator.hpp"
+#include "HeapRegionDescriptorStandard.hpp"
+#include "HeapRegionIteratorStandard.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ModronAssertions.h"
+#include "ObjectModel.hpp"
+
+/* Areas are never smaller than this, so the area map stays small relative to the heap */
+#define CONCURRENT_EVACUATION_MINIMUM_AREA_SHIFT 12
+/* Area indices are stored in a byte map, 0 meaning "not selected" */
+#define CONCURRENT_EVACUATION_MAXIMUM_AREAS 255
+
+MM_ConcurrentEvacuator *
+MM_ConcurrentEvacuator::newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme, MM_Collector *collector)
+{
+	MM_ConcurrentEvacuator *evacuator = (MM_ConcurrentEvacuator *)env->getForge()->allocate(sizeof(MM_ConcurrentEvacuator), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != evacuator) {
+		new(evacuator) MM_ConcurrentEvacuator(env, markingScheme, collector);
+		if (!evacuator->initialize(env)) {
+			evacuator->kill(env);
+			evacuator = NULL;
+		}
+	}
+	return evacuator;
+}
+
+void
+MM_ConcurrentEvacuator::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentEvacuator::initialize(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	/* Round the area size up to a power of two so an address maps to its area with a shift */
+	_areaShift = CONCURRENT_EVACUATION_MINIMUM_AREA_SHIFT;
+	while (((uintptr_t)1 << _areaShift) < _extensions->concurrentEvacuationAreaSize) {
+		_areaShift += 1;
+	}
+
+	_heapBase = (uint8_t *)_extensions->heap->getHeapBase();
+	_heapTop = _heapBase + _extensions->heap->getMaximumPhysicalRange();
+	_areaMapSize = ((uintptr_t)(_heapTop - _heapBase) >> _areaShift) + 1;
+	_areaMap = (uint8_t *)forge->allocate(_areaMapSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _areaMap) {
+		return false;
+	}
+	memset(_areaMap, 0, _areaMapSize);
+
+	_maxAreas = OMR_MIN(_extensions->concurrentEvacuationMaxAreas, CONCURRENT_EVACUATION_MAXIMUM_AREAS);
+	if (0 != _maxAreas) {
+		_areas = (EvacuationArea *)forge->allocate(_maxAreas * sizeof(EvacuationArea), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _areas) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_ConcurrentEvacuator::tearDown(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	if (NULL != _forwardingTable) {
+		forge->free(_forwardingTable);
+		_forwardingTable = NULL;
+		_forwardingTableSize = 0;
+	}
+	if (NULL != _areas) {
+		forge->free(_areas);
+		_areas = NULL;
+	}
+	if (NULL != _areaMap) {
+		forge->free(_areaMap);
+		_areaMap = NULL;
+	}
+}
+
+/**
+ * Walk the marked objects of an area.
+ * @param[out] objectCount number of marked objects starting in the area
+ * @param[out] containsRemembered set to true if a remembered object was found, in which case the walk stops
+ * @return live bytes of the objects starting in the area
+ */
+uintptr_t
+MM_ConcurrentEvacuator::measureArea(MM_EnvironmentBase *env, uint8_t *base, uint8_t *top, uintptr_t *objectCount, bool *containsRemembered)
+{
+	uintptr_t liveBytes = 0;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markingScheme->getMarkMap(), (uintptr_t *)base, (uintptr_t *)top);
+	omrobjectptr_t objectPtr = NULL;
+
+	*objectCount = 0;
+	*containsRemembered = false;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		/* Remembered objects are referenced from the remembered set, which is not healed; leave their areas alone */
+		if (_extensions->scavengerEnabled && _extensions->objectModel.isRemembered(objectPtr)) {
+			*containsRemembered = true;
+			break;
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		*objectCount += 1;
+	}
+
+	return liveBytes;
+}
+
+/**
+ * Keep the _maxAreas candidates with the lowest live ratio, ordered by ascending live ratio.
+ */
+void
+MM_ConcurrentEvacuator::insertCandidate(EvacuationArea *candidate)
+{
+	uintptr_t candidateSize = candidate->top - candidate->base;
+	uintptr_t index = _areaCount;
+
+	if (_areaCount == _maxAreas) {
+		EvacuationArea *last = &_areas[_maxAreas - 1];
+		if ((candidate->liveBytes * (uintptr_t)(last->top - last->base)) >= (last->liveBytes * candidateSize)) {
+			return;
+		}
+		index = _maxAreas - 1;
+	} else {
+		_areaCount += 1;
+	}
+
+	EvacuationArea entry = *candidate;
+	while (0 < index) {
+		EvacuationArea *previous = &_areas[index - 1];
+		if ((previous->liveBytes * candidateSize) <= (entry.liveBytes * (uintptr_t)(previous->top - previous->base))) {
+			break;
+		}
+		_areas[index] = *previous;
+		index -= 1;
+	}
+	_areas[index] = entry;
+}
+
+bool
+MM_ConcurrentEvacuator::ensureForwardingTableSize(MM_EnvironmentBase *env, uintptr_t entryCount)
+{
+	if (entryCount > _forwardingTableSize) {
+		OMR::GC::Forge *forge = env->getForge();
+		if (NULL != _forwardingTable) {
+			forge->free(_forwardingTable);
+		}
+		/* leave some headroom so that small variations of the live set do not reallocate every cycle */
+		uintptr_t tableSize = entryCount + (entryCount / 4);
+		_forwardingTable = (ForwardingEntry *)forge->allocate(tableSize * sizeof(ForwardingEntry), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_forwardingTableSize = (NULL == _forwardingTable) ? 0 : tableSize;
+	}
+	return (NULL != _forwardingTable);
+}
+
+/**
+ * Withdraw the free entries of an area from its memory pool, so that neither mutators nor evacuation
+ * allocate into it. The withdrawn memory remains formatted as holes and is reclaimed by the sweep that
+ * follows the release of the evacuation set.
+ */
+void
+MM_ConcurrentEvacuator::withdrawFreeEntries(MM_EnvironmentBase *env, EvacuationArea *area)
+{
+	/* removeFreeEntriesWithinRange() is only available with the LOA, and ConcurrentGC does not create an evacuator without it */
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	MM_MemoryPool *memoryPool = area->subSpace->getMemoryPool(area->base);
+	MM_HeapLinkedFreeHeader *freeListHead = NULL;
+	MM_HeapLinkedFreeHeader *freeListTail = NULL;
+	uintptr_t freeEntryCount = 0;
+	uintptr_t freeEntrySize = 0;
+
+	/* The pool subtracts the withdrawn entries from its free memory size, free entry count and size class
+	 * statistics, so the returned list is consistent with the pool and can simply be dropped: the entries stay
+	 * in the heap as holes and the pool under-reports its free memory by their size until the next sweep,
+	 * which rebuilds the free list and the accounting of the whole pool from the mark map.
+	 */
+	memoryPool->removeFreeEntriesWithinRange(env, area->base, area->top, memoryPool->getMinimumFreeEntrySize(),
+			freeListHead, freeListTail, freeEntryCount, freeEntrySize);
+#else /* OMR_GC_LARGE_OBJECT_AREA */
+	Assert_MM_unreachable();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+}
+
+bool
+MM_ConcurrentEvacuator::selectEvacuationSet(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(!_evacuationActive);
+
+	_areaCount = 0;
+	if ((0 == _maxAreas) || !_markingScheme->getMarkMap()->isMarkMapValid()) {
+		/* no areas allowed, or objects moved (compaction) since marking */
+		return false;
+	}
+
+	_stats.clear();
+
+	uintptr_t areaSize = (uintptr_t)1 << _areaShift;
+	uintptr_t liveThreshold = _extensions->concurrentEvacuationLiveThreshold;
+	GC_HeapRegionIteratorStandard regionIterator(_extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		MM_MemorySubSpace *subSpace = region->getSubSpace();
+		if (!region->isCommitted() || (0 == region->getSize()) || (MEMORY_TYPE_OLD != (subSpace->getTypeFlags() & MEMORY_TYPE_OLD))) {
+			continue;
+		}
+
+		uint8_t *regionHigh = (uint8_t *)region->getHighAddress();
+		uint8_t *base = (uint8_t *)region->getLowAddress();
+		while (base < regionHigh) {
+			uint8_t *top = _heapBase + MM_Math::roundToFloor(areaSize, (uintptr_t)(base - _heapBase)) + areaSize;
+			if (top > regionHigh) {
+				top = regionHigh;
+			}
+
+			/* An area spanning two memory pools (e.g. across the LOA boundary) can not have its free entries withdrawn */
+			if (subSpace->getMemoryPool(base) == subSpace->getMemoryPool(top - 1)) {
+				uintptr_t objectCount = 0;
+				bool containsRemembered = false;
+				uintptr_t liveBytes = measureArea(env, base, top, &objectCount, &containsRemembered);
+				if (!containsRemembered && (0 != liveBytes) && ((liveBytes * 100) < ((uintptr_t)(top - base) * liveThreshold))) {
+					EvacuationArea candidate;
+					candidate.base = base;
+					candidate.top = top;
+					candidate.subSpace = subSpace;
+					candidate.liveBytes = liveBytes;
+					candidate.firstEntry = 0;
+					candidate.entryCount = objectCount;
+					candidate.aborted = 0;
+					insertCandidate(&candidate);
+				}
+			}
+			base = top;
+		}
+	}
+
+	if (0 == _areaCount) {
+		return false;
+	}
+
+	/* Order the selected areas by address so that the forwarding table is sorted as a whole */
+	for (uintptr_t i = 1; i < _areaCount; i++) {
+		EvacuationArea area = _areas[i];
+		uintptr_t j = i;
+		while ((0 < j) && (_areas[j - 1].base > area.base)) {
+			_areas[j] = _areas[j - 1];
+			j -= 1;
+		}
+		_areas[j] = area;
+	}
+
+	uintptr_t entryCount = 0;
+	for (uintptr_t i = 0; i < _areaCount; i++) {
+		_areas[i].firstEntry = entryCount;
+		entryCount += _areas[i].entryCount;
+	}
+	if (!ensureForwardingTableSize(env, entryCount)) {
+		_areaCount = 0;
+		return false;
+	}
+
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	for (uintptr_t i = 0; i < _areaCount; i++) {
+		EvacuationArea *area = &_areas[i];
+		ForwardingEntry *entry = &_forwardingTable[area->firstEntry];
+		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, (uintptr_t *)area->base, (uintptr_t *)area->top);
+		omrobjectptr_t objectPtr = NULL;
+		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+			entry->from = objectPtr;
+			entry->to = NULL;
+			entry += 1;
+		}
+		Assert_MM_true(entry == &_forwardingTable[area->firstEntry + area->entryCount]);
+
+		withdrawFreeEntries(env, area);
+		_areaMap[(uintptr_t)(area->base - _heapBase) >> _areaShift] = (uint8_t)(i + 1);
+		_stats._bytesSelected += area->liveBytes;
+	}
+
+	_stats._areasSelected = _areaCount;
+	_forwardingEntryCount = entryCount;
+	_nextEntryToEvacuate = 0;
+	_copyingEnabled = true;
+	_evacuationActive = true;
+
+	return true;
+}
+
+void
+MM_ConcurrentEvacuator::releaseEvacuationSet(MM_EnvironmentBase *env)
+{
+	if (!_evacuationActive) {
+		return;
+	}
+
+	for (uintptr_t i = 0; i < _areaCount; i++) {
+		_areaMap[(uintptr_t)(_areas[i].base - _heapBase) >> _areaShift] = 0;
+	}
+
+	MM_ConcurrentEvacuationStats *reportedStats = &_extensions->globalGCStats.concurrentEvacuationStats;
+	reportedStats->_areasSelected = _stats._areasSelected;
+	reportedStats->_areasAborted = _stats._areasAborted;
+	reportedStats->_bytesSelected = _stats._bytesSelected;
+	reportedStats->_objectsEvacuated = _stats._objectsEvacuated;
+	reportedStats->_bytesEvacuated = _stats._bytesEvacuated;
+	reportedStats->_objectsPinned = _stats._objectsPinned;
+	reportedStats->_bytesDiscarded = _stats._bytesDiscarded;
+
+	_areaCount = 0;
+	_forwardingEntryCount = 0;
+	_nextEntryToEvacuate = 0;
+	_copyingEnabled = false;
+	_evacuationActive = false;
+}
+
+MM_ConcurrentEvacuator::ForwardingEntry *
+MM_ConcurrentEvacuator::findForwardingEntry(EvacuationArea *area, omrobjectptr_t objectPtr)
+{
+	ForwardingEntry *low = &_forwardingTable[area->firstEntry];
+	ForwardingEntry *high = low + area->entryCount;
+
+	while (low < high) {
+		ForwardingEntry *middle = low + ((high - low) / 2);
+		if (middle->from < objectPtr) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	return ((low < &_forwardingTable[area->firstEntry + area->entryCount]) && (low->from == objectPtr)) ? low : NULL;
+}
+
+omrobjectptr_t
+MM_ConcurrentEvacuator::resolveEntry(MM_EnvironmentBase *env, EvacuationArea *area, ForwardingEntry *entry)
+{
+	omrobjectptr_t forwardedPtr = entry->to;
+	if (NULL != forwardedPtr) {
+		return forwardedPtr;
+	}
+
+	omrobjectptr_t objectPtr = entry->from;
+	if (_copyingEnabled && (0 == area->aborted)) {
+		bool canMove = true;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (_extensions->scavengerEnabled && _extensions->objectModel.isRemembered(objectPtr)) {
+			canMove = false;
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		if (canMove) {
+			uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+			MM_AllocateDescription allocDescription(objectSize, 0, false, true);
+			allocDescription.setCollectorAllocateSatisfyAnywhere(true);
+			void *copy = area->subSpace->collectorAllocate(env, _collector, &allocDescription);
+			if (NULL != copy) {
+				memcpy(copy, objectPtr, objectSize);
+				forwardedPtr = (omrobjectptr_t)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&entry->to, (uintptr_t)NULL, (uintptr_t)copy);
+				if (NULL == forwardedPtr) {
+					_stats.addToEvacuated(objectSize);
+					return (omrobjectptr_t)copy;
+				}
+				/* Another thread resolved the object first; our copy was never published */
+				area->subSpace->abandonHeapChunk(copy, (uint8_t *)copy + objectSize);
+				MM_AtomicOperations::add(&_stats._bytesDiscarded, objectSize);
+				return forwardedPtr;
+			}
+			/* Out of memory for copies: stop evacuating this area, the rest of it is pinned */
+			if (0 == MM_AtomicOperations::lockCompareExchange(&area->aborted, 0, 1)) {
+				MM_AtomicOperations::add(&_stats._areasAborted, 1);
+			}
+		}
+	}
+
+	/* Pin the object in place. This is final: once any thread has used the old address, the object never moves */
+	forwardedPtr = (omrobjectptr_t)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&entry->to, (uintptr_t)NULL, (uintptr_t)objectPtr);
+	if (NULL == forwardedPtr) {
+		MM_AtomicOperations::add(&_stats._objectsPinned, 1);
+		forwardedPtr = objectPtr;
+	}
+	return forwardedPtr;
+}
+
+omrobjectptr_t
+MM_ConcurrentEvacuator::evacuateObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	EvacuationArea *area = getArea(objectPtr);
+	ForwardingEntry *entry = findForwardingEntry(area, objectPtr);
+
+	/* Objects without an entry were not live at selection (e.g. allocated in a remainder of the area) and never move */
+	return (NULL == entry) ? objectPtr : resolveEntry(env, area, entry);
+}
+
+uintptr_t
+MM_ConcurrentEvacuator::evacuateIncrement(MM_EnvironmentBase *env, uintptr_t bytesToEvacuate)
+{
+	uintptr_t bytesEvacuated = 0;
+
+	while (_copyingEnabled && (bytesEvacuated < bytesToEvacuate) && (_nextEntryToEvacuate < _forwardingEntryCount)) {
+		uintptr_t index = MM_AtomicOperations::add(&_nextEntryToEvacuate, 1) - 1;
+		if (index >= _forwardingEntryCount) {
+			break;
+		}
+		ForwardingEntry *entry = &_forwardingTable[index];
+		bytesEvacuated += _extensions->objectModel.getConsumedSizeInBytesWithHeader(entry->from);
+		resolveEntry(env, getArea(entry->from), entry);
+	}
+
+	return bytesEvacuated;
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(CONCURRENTEVACUATOR_HPP_)
+#define CONCURRENTEVACUATOR_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "BaseVirtual.hpp"
+#include "ConcurrentEvacuationStats.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SlotObject.hpp"
+
+class MM_Collector;
+class MM_MarkingScheme;
+class MM_MemorySubSpace;
+
+/**
+ * Incrementally evacuates the most fragmented tenure areas between global collections.
+ *
+ * At the end of a global collection, while the mark map is still valid, the evacuator splits tenure
+ * regions into fixed size areas and selects those with the lowest live ratio. The live objects in the
+ * selected areas are recorded in an off-heap forwarding table and the free entries inside the areas are
+ * withdrawn from the memory pools, so no new object is allocated there. Objects are then copied out
+ * while the application runs: mutators pay for it with their allocation tax and through the load barrier
+ * (@see standardReadBarrier()), and concurrent marking heals every slot it scans. Once the next global
+ * collection has completed marking, every live reference has been healed, so the set is released and the
+ * sweep reclaims the selected areas as contiguous free memory.
+ *
+ * An object is resolved at most once: its forwarding entry is set either to its copy or, if it cannot be
+ * copied (remembered object, copy failure, collection in progress), to the object itself. Both outcomes
+ * are final, so all threads agree on the address of an object for the lifetime of the evacuation set.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentEvacuator : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Forwarding state of one object that was live in a selected area at selection time.
+	 */
+	struct ForwardingEntry {
+		omrobjectptr_t from; /**< address of the object in the evacuation area */
+		omrobjectptr_t volatile to; /**< NULL until resolved, then address of the copy, or from if the object was pinned in place */
+	};
+
+	/**
+	 * A selected evacuation area.
+	 */
+	struct EvacuationArea {
+		uint8_t *base; /**< first byte of the area */
+		uint8_t *top; /**< first byte past the area */
+		MM_MemorySubSpace *subSpace; /**< subspace owning the area, copies are allocated from it */
+		uintptr_t liveBytes; /**< live bytes in the area at selection time */
+		uintptr_t firstEntry; /**< index of the first forwarding entry of the area */
+		uintptr_t entryCount; /**< number of forwarding entries of the area */
+		volatile uintptr_t aborted; /**< non-zero once copying out of this area has been abandoned */
+	};
+
+private:
+	MM_GCExtensionsBase *_extensions;
+	MM_MarkingScheme *_markingScheme;
+	MM_Collector *_collector; /**< collector on whose behalf copies are allocated */
+	uint8_t *_heapBase; /**< base of the heap range covered by the area map */
+	uint8_t *_heapTop; /**< top of the heap range covered by the area map */
+	uintptr_t _areaShift; /**< log2 of the area size */
+	uintptr_t _areaMapSize; /**< number of areas in the heap range */
+	uint8_t *_areaMap; /**< per area, 0 if not selected, otherwise one plus the index in _areas */
+	EvacuationArea *_areas; /**< selected areas, sorted by address */
+	uintptr_t _maxAreas; /**< capacity of _areas */
+	uintptr_t _areaCount; /**< number of selected areas */
+	ForwardingEntry *_forwardingTable; /**< forwarding entries for all selected areas, sorted by address */
+	uintptr_t _forwardingTableSize; /**< capacity of _forwardingTable, in entries */
+	uintptr_t _forwardingEntryCount; /**< number of entries in use in _forwardingTable */
+	volatile uintptr_t _nextEntryToEvacuate; /**< next forwarding entry to be evacuated by incremental work */
+	volatile bool _evacuationActive; /**< true from selection until release of an evacuation set */
+	volatile bool _copyingEnabled; /**< false once a global collection has started, objects not yet copied are then pinned */
+	MM_ConcurrentEvacuationStats _stats; /**< statistics of the current evacuation set */
+
+protected:
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_ConcurrentEvacuator *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme, MM_Collector *collector);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Select the evacuation set. Must be called by the master thread at the end of a global collection,
+	 * after sweep, while the mark map is valid and before mutators resume.
+	 * @param env calling thread environment
+	 * @return true if an evacuation set was selected; the caller must then evacuate the roots.
+	 */
+	bool selectEvacuationSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Release the evacuation set. Must be called once marking of a global collection is complete, when no
+	 * reference to an evacuated object remains, and before sweep.
+	 * @param env calling thread environment
+	 */
+	void releaseEvacuationSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop copying objects; objects not yet copied are pinned in place when next resolved. Called at the
+	 * start of a global collection, when the memory pools are no longer available for allocation.
+	 */
+	MMINLINE void disableCopying() { _copyingEnabled = false; }
+
+	/**
+	 * Evacuate objects from the selected areas on behalf of a mutator paying its allocation tax.
+	 * @param env calling thread environment
+	 * @param bytesToEvacuate number of bytes worth of objects to process
+	 * @return number of bytes processed
+	 */
+	uintptr_t evacuateIncrement(MM_EnvironmentBase *env, uintptr_t bytesToEvacuate);
+
+	/**
+	 * Resolve an object in a selected area to its final address, copying it if it has not yet been resolved.
+	 * @param env calling thread environment
+	 * @param objectPtr object in a selected area
+	 * @return the address of the copy, or objectPtr if the object stays in place
+	 */
+	omrobjectptr_t evacuateObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	MMINLINE bool isEvacuationActive() const { return _evacuationActive; }
+
+	/**
+	 * Test whether an object lies in a selected area, in which case it must be resolved with evacuateObject()
+	 * before use. NULL and off-heap references are never in an area.
+	 */
+	MMINLINE bool
+	isInEvacuationArea(omrobjectptr_t objectPtr)
+	{
+		return _evacuationActive && isInSelectedArea(objectPtr);
+	}
+
+	/**
+	 * Same as isInEvacuationArea(), for callers which have already checked that evacuation is active.
+	 * The area map is cleared when the evacuation set is released, so the answer is also correct otherwise.
+	 */
+	MMINLINE bool
+	isInSelectedArea(omrobjectptr_t objectPtr)
+	{
+		bool result = false;
+		if ((_heapBase <= (uint8_t *)objectPtr) && (_heapTop > (uint8_t *)objectPtr)) {
+			result = (0 != _areaMap[((uintptr_t)objectPtr - (uintptr_t)_heapBase) >> _areaShift]);
+		}
+		return result;
+	}
+
+	/**
+	 * Resolve an object reference, copying the object out of its area if required.
+	 * @param env calling thread environment
+	 * @param objectPtr object reference (may be NULL)
+	 * @return the address at which the object must be accessed
+	 */
+	MMINLINE omrobjectptr_t
+	resolve(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		if (isInEvacuationArea(objectPtr)) {
+			objectPtr = evacuateObject(env, objectPtr);
+		}
+		return objectPtr;
+	}
+
+	/**
+	 * Heal a slot referring to an object in a selected area. The slot is updated atomically, so a racing
+	 * store to the same slot is never overwritten. Callers test isEvacuationActive() (or isInEvacuationArea())
+	 * first, so that scanning loops can do it once per object rather than once per slot.
+	 * @param env calling thread environment
+	 * @param slotObject the slot to heal
+	 * @return the resolved value read from the slot
+	 */
+	MMINLINE omrobjectptr_t
+	fixupSlot(MM_EnvironmentBase *env, GC_SlotObject *slotObject)
+	{
+		omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+		if (isInSelectedArea(objectPtr)) {
+			omrobjectptr_t forwardedPtr = evacuateObject(env, objectPtr);
+			if (forwardedPtr != objectPtr) {
+				slotObject->atomicWriteReferenceToSlot(objectPtr, forwardedPtr);
+			}
+			objectPtr = forwardedPtr;
+		}
+		return objectPtr;
+	}
+
+	MM_ConcurrentEvacuationStats *getStats() { return &_stats; }
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_ConcurrentEvacuator(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme, MM_Collector *collector)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _markingScheme(markingScheme)
+		, _collector(collector)
+		, _heapBase(NULL)
+		, _heapTop(NULL)
+		, _areaShift(0)
+		, _areaMapSize(0)
+		, _areaMap(NULL)
+		, _areas(NULL)
+		, _maxAreas(0)
+		, _areaCount(0)
+		, _forwardingTable(NULL)
+		, _forwardingTableSize(0)
+		, _forwardingEntryCount(0)
+		, _nextEntryToEvacuate(0)
+		, _evacuationActive(false)
+		, _copyingEnabled(false)
+		, _stats()
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+	MMINLINE EvacuationArea *
+	getArea(omrobjectptr_t objectPtr)
+	{
+		return &_areas[_areaMap[((uintptr_t)objectPtr - (uintptr_t)_heapBase) >> _areaShift] - 1];
+	}
+
+	ForwardingEntry *findForwardingEntry(EvacuationArea *area, omrobjectptr_t objectPtr);
+	omrobjectptr_t resolveEntry(MM_EnvironmentBase *env, EvacuationArea *area, ForwardingEntry *entry);
+	uintptr_t measureArea(MM_EnvironmentBase *env, uint8_t *base, uint8_t *top, uintptr_t *objectCount, bool *containsRemembered);
+	void insertCandidate(EvacuationArea *candidate);
+	bool ensureForwardingTableSize(MM_EnvironmentBase *env, uintptr_t entryCount);
+	void withdrawFreeEntries(MM_EnvironmentBase *env, EvacuationArea *area);
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#endif /* CONCURRENTEVACUATOR_HPP_ */
@@ -46,6 +46,7 @@
 #include "ConcurrentCardTableForWC.hpp"
 #include "ConcurrentGC.hpp"
 #include "ConcurrentCompleteTracingTask.hpp"
+#include "ConcurrentEvacuator.hpp"
 #include "ConcurrentClearNewMarkBitsTask.hpp"
 #include "ConcurrentFinalCleanCardsTask.hpp"
 #include "ConcurrentSafepointCallback.hpp"
@@ -70,6 +71,7 @@
 #include "MemorySubSpaceFlat.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "ObjectModel.hpp"
+#include "RememberedSetCards.hpp"
 #include "SpinLimiter.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPuddle.hpp"
@@ -285,6 +287,7 @@ void
 MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, uint64_t duration)
 {
 	MM_ConcurrentCardTable *cardTable = (MM_ConcurrentCardTable *)_cardTable;
+	MM_CardCleaningStats *finalCardCleaningStats = cardTable->getCardTableStats()->getFinalCardCleaningStats();
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	Trc_MM_ConcurrentCollectionCardCleaningEnd(env->getLanguageVMThread());
@@ -306,7 +309,9 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, u
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		finalCardCleaningStats->_cardsScanned,
+		finalCardCleaningStats->getCardsScannedPerMillisecond(omrtime_hires_frequency())
 	);
 }
 
@@ -593,6 +598,20 @@ MM_ConcurrentGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	/* Evacuated objects must never be reachable from a concurrent sweep or a concurrent scavenge, which do not heal references */
+	if (_extensions->concurrentEvacuation && !_extensions->isConcurrentSweepEnabled() && !_extensions->isConcurrentScavengerEnabled()) {
+		_evacuator = MM_ConcurrentEvacuator::newInstance(env, _markingScheme, this);
+		if (NULL == _evacuator) {
+			goto error_no_memory;
+		}
+		_extensions->concurrentEvacuator = _evacuator;
+	}
+#else /* OMR_GC_LARGE_OBJECT_AREA */
+	/* Free entries can not be withdrawn from the areas being evacuated, so copies could land back inside them */
+	_extensions->concurrentEvacuation = false;
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+
 	if (_extensions->optimizeConcurrentWB) {
 		_callback = _concurrentDelegate.createSafepointCallback(env);
 		if (NULL == _callback) {
@@ -743,6 +762,12 @@ MM_ConcurrentGC::tearDown(MM_EnvironmentBase *env)
 		_extensions->cardTable = NULL;
 	}
 
+	if (NULL != _evacuator) {
+		_evacuator->kill(env);
+		_evacuator = NULL;
+		_extensions->concurrentEvacuator = NULL;
+	}
+
 	if (NULL != _conHelpersTable) {
 		forge->free(_conHelpersTable);
 		_conHelpersTable = NULL;
@@ -2044,6 +2069,11 @@ MM_ConcurrentGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	/* Thread roots must have been flushed by this point */
 	Assert_MM_true(!_concurrentDelegate.flushThreadRoots(env));
 
+	/* Evacuation is paid for by every allocation, whether or not concurrent marking is active */
+	if ((NULL != _evacuator) && _evacuator->isEvacuationActive()) {
+		_evacuator->evacuateIncrement(env, allocDescription->getAllocationTaxSize());
+	}
+
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 	/* Do we need to tax this allocation ? */
 	if ( (LOA == _meteringType && !allocDescription->isLOAAllocation())
@@ -2939,6 +2969,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 	 */
 	_globalCollectionInProgress = true;
 
+	/* Memory pools are about to be reset, so objects still in evacuation areas stay in place */
+	if (NULL != _evacuator) {
+		_evacuator->disableCopying();
+	}
+
 	/* Assume for now we will need to initialize the mark map. If we subsequenly find
 	 * we got far enough through the concurrent mark cycle then we will reset this flag
 	 */
@@ -3031,6 +3066,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 			MM_ConcurrentClearNewMarkBitsTask clearNewMarkBitsTask(env, _dispatcher, this);
 			_dispatcher->run(env, &clearNewMarkBitsTask);
 
+			/* The parent pre-collect is skipped while concurrent is in progress, so drain the cards here */
+			if (NULL != _extensions->rememberedSetCards) {
+				_extensions->rememberedSetCards->drain(MM_EnvironmentStandard::getEnvironment(env), true);
+			}
+
 			/* If remembered set if not empty then re-scan any objects in the remembered set */
 			if (!(_extensions->rememberedSet.isEmpty())) {
 				MM_ConcurrentScanRememberedSetTask scanRememberedSetTask(env, _dispatcher, this, env->_cycleState);
@@ -3087,6 +3127,11 @@ MM_ConcurrentGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 
 	masterThreadGarbageCollect(env, static_cast<MM_AllocateDescription*>(allocDescription), _initializeMarkMap, false);
 
+	/* The mark map is still valid, pick the areas to be evacuated before the next global collection */
+	if (_extensions->concurrentEvacuation && (NULL != _evacuator) && _evacuator->selectEvacuationSet(env)) {
+		_concurrentDelegate.evacuateRoots(env, _evacuator);
+	}
+
 	/* Restore normal allocation rules.
 	 * It's not good to do it in concurrentFinalCollection(), as an AF may occur before we get chance to do final collection, so we may miss to restore it.
 	 * It's too late to do it in postCollect(), as the AF will make us re-try allocate just after collection is done, but postCollect() is invoked after the re-try.
@@ -3108,6 +3153,11 @@ MM_ConcurrentGC::postMark(MM_EnvironmentBase *envModron)
 	 *  First call superclass postMark() routine
 	 */
 	MM_ParallelGlobalGC::postMark(envModron);
+
+	/* All live references to evacuated objects have been healed by marking, so the areas can be swept */
+	if (NULL != _evacuator) {
+		_evacuator->releaseEvacuationSet(envModron);
+	}
 }
 
 /**
@@ -3449,7 +3499,10 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
  	uintptr_t totalTraced = 0;
  	uintptr_t totalCleaned = 0;
  	uintptr_t bytesCleaned;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t cleanStartTime = omrtime_hires_clock();
 
+	env->_cardCleaningStats.clear();
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
 
 	/* Until no more refs to process */
@@ -3519,6 +3572,9 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
 	flushLocalBuffers(env);
 	_stats.incFinalTraceCount(totalTraced);
 	_stats.incFinalCardCleanCount(totalCleaned);
+
+	env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, omrtime_hires_clock());
+	((MM_ConcurrentCardTable *)_cardTable)->getCardTableStats()->mergeFinalCardCleaningStats(&env->_cardCleaningStats);
 }
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -130,6 +130,7 @@ class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 class MM_AllocateDescription;
+class MM_ConcurrentEvacuator;
 class MM_ConcurrentSafepointCallback;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceConcurrent;
@@ -198,6 +199,7 @@ private:
 	};
 
 	MM_ConcurrentCardTable *_cardTable;	/**< pointer to Cards Table */
+	MM_ConcurrentEvacuator *_evacuator; /**< evacuates fragmented tenure areas between global collections, NULL if disabled */
 	void *_heapBase; 
 	void *_heapAlloc;
 	bool _rebuildInitWork;
@@ -490,6 +492,7 @@ public:
 	MM_ConcurrentGC(MM_EnvironmentBase *env)
 		: MM_ParallelGlobalGC(env)
 		,_cardTable(NULL)
+		,_evacuator(NULL)
 		,_heapBase(NULL)
 		,_heapAlloc(NULL)
 		,_rebuildInitWork(false)
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#if !defined(CONCURRENTMARKINGDELEGATEBASE_HPP_)
+#define CONCURRENTMARKINGDELEGATEBASE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+class MM_ConcurrentEvacuator;
+class MM_EnvironmentBase;
+
+/**
+ * Default implementations of the optional methods of MM_ConcurrentMarkingDelegate. A language's delegate
+ * derives from this class and hides the methods of the features it supports.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentMarkingDelegateBase
+{
+/*
+ * Function members
+ */
+public:
+	/**
+	 * Called at the end of a global collection when a concurrent evacuation set has been selected (see
+	 * MM_GCExtensionsBase::concurrentEvacuation), before mutator threads resume. A language which enables
+	 * concurrent evacuation must replace every root reference it holds outside of the heap with the reference
+	 * returned by MM_ConcurrentEvacuator::resolve(..), since roots are not covered by the read barrier.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] evacuator The concurrent evacuator holding the selected evacuation set.
+	 */
+	MMINLINE void evacuateRoots(MM_EnvironmentBase *env, MM_ConcurrentEvacuator *evacuator) { }
+};
+
+#endif /* CONCURRENTMARKINGDELEGATEBASE_HPP_ */
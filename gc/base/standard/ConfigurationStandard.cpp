@@ -141,6 +141,13 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 		/* TODO: enable processLargeAllocateStats in concurrentSweep case, currently can not collect correct FreeEntry Stats in concurrentSweep case*/
 		extensions->processLargeAllocateStats = false;
 		extensions->estimateFragmentation = NO_ESTIMATE_FRAGMENTATION;
+		/* quick-lists are populated from the free list at the end of a collection, which concurrent sweep has not rebuilt yet */
+		extensions->freeEntryQuickLists = false;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		extensions->loaSizeBands = false;
+		/* reservations are carved with the pool lock held, which the concurrent sweep replenish path does not expect */
+		extensions->loaReservationCount = 0;
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
@@ -26,6 +26,9 @@
 
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetCards.hpp"
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "Scavenger.hpp"
 #endif
@@ -57,6 +60,13 @@ MM_EnvironmentStandard::initialize(MM_GCExtensionsBase *extensions)
 	_scavengerRememberedSet.fragmentTop = NULL;
 	_scavengerRememberedSet.fragmentSize = (uintptr_t)J9_SCV_REMSET_FRAGMENT_SIZE;
 	_scavengerRememberedSet.parentList = &extensions->rememberedSet;
+	_rememberedSetBufferCount = 0;
+	_rememberedSetCardsFragment.count = 0;
+	_rememberedSetCardsFragment.fragmentCurrent = NULL;
+	_rememberedSetCardsFragment.fragmentTop = NULL;
+	_rememberedSetCardsFragment.fragmentSize = (uintptr_t)J9_SCV_REMSET_FRAGMENT_SIZE;
+	/* Set by the remembered set cards when this thread first dirties a card */
+	_rememberedSetCardsFragment.parentList = NULL;
 #endif
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -74,10 +84,30 @@ MM_EnvironmentStandard::tearDown(MM_GCExtensionsBase *extensions)
 {
 	/* If we are in a middle of a concurrent GC, we may want to flush GC caches (if thread happens to do GC work) */
 	flushGCCaches(this);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* Objects remembered by this thread must not be lost with its store buffer */
+	if (0 != _rememberedSetBufferCount) {
+		flushRememberedSetBuffer();
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	/* tearDown base class */
 	MM_EnvironmentBase::tearDown(extensions);
 }
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_EnvironmentStandard::flushRememberedSetBuffer()
+{
+	MM_RememberedSetCards *rememberedSetCards = getExtensions()->rememberedSetCards;
+	if (NULL != rememberedSetCards) {
+		rememberedSetCards->flushBuffer(this);
+	} else {
+		/* The collector has already been shut down */
+		_rememberedSetBufferCount = 0;
+	}
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 void
 MM_EnvironmentStandard::flushGCCaches(MM_EnvironmentBase *env)
 {
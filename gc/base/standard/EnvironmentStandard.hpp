@@ -55,6 +55,9 @@ public:
 	MM_CopyScanCacheStandard *_effectiveCopyScanCache; /**< the the copy cache the received the most recently copied object, or NULL if no object copied in copy() */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	omrobjectptr_t _rememberedSetBuffer[J9_SCV_REMSET_BUFFER_SIZE]; /**< objects remembered by this thread since the last flush, when remembered set cards are enabled */
+	uintptr_t _rememberedSetBufferCount; /**< number of objects in _rememberedSetBuffer */
+	J9VMGC_SublistFragment _rememberedSetCardsFragment; /**< fragment of the list of cards dirtied by this thread */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -98,8 +101,31 @@ public:
 	 */
 	void flushRememberedSet()
 	{
+		if (0 != _rememberedSetBufferCount) {
+			flushRememberedSetBuffer();
+		}
 		MM_SublistFragment::flush(&_scavengerRememberedSet);
+		if (NULL != _rememberedSetCardsFragment.parentList) {
+			MM_SublistFragment::flush(&_rememberedSetCardsFragment);
+		}
 	}
+
+	/**
+	 * Record an object remembered by this thread in its store buffer, flushing the buffer to the
+	 * remembered set cards when it is full.
+	 * @param objectPtr the object which has just been flagged as remembered
+	 */
+	MMINLINE void
+	addToRememberedSetBuffer(omrobjectptr_t objectPtr)
+	{
+		_rememberedSetBuffer[_rememberedSetBufferCount] = objectPtr;
+		_rememberedSetBufferCount += 1;
+		if (J9_SCV_REMSET_BUFFER_SIZE == _rememberedSetBufferCount) {
+			flushRememberedSetBuffer();
+		}
+	}
+
+	void flushRememberedSetBuffer();
 #endif
 
 protected:
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#if !defined(HEAPSNAPSHOTFORMAT_HPP_)
+#define HEAPSNAPSHOTFORMAT_HPP_
+
+#include "omrcomp.h"
+
+/*
+ * Layout of the heap snapshot file written by MM_HeapSnapshotWriter, shared with the offline reader
+ * (perftest/gctest) which computes the dominator tree and the retained sizes of the snapshot.
+ *
+ * The file is a HeapSnapshotHeader followed by frames. Each frame is a one byte HeapSnapshotFrameType, the length
+ * of its payload as a varint, then the payload. The GC threads write the frames of the regions they walk as their
+ * buffers fill, so frames of different threads are interleaved and the objects are in no global order; a snapshot
+ * is complete once its HEAP_SNAPSHOT_FRAME_END frame has been written.
+ *
+ * Integers are unsigned LEB128 varints; signed values are zigzag encoded first. Object addresses are offsets from
+ * heapBase and, like object sizes, are in units of objectAlignment bytes.
+ * - HEAP_SNAPSHOT_FRAME_OBJECTS: object records, each the signed distance from the end of the previous object of the
+ *   frame (or from offset 0 for the first object), the size, the number of references and, for each reference, the
+ *   signed distance from the object to the referenced object.
+ * - HEAP_SNAPSHOT_FRAME_REFERENCES: more references of an object whose record did not hold them all: the offset of
+ *   the object, then the signed distance to each referenced object up to the end of the payload. It follows the
+ *   frame holding the object record.
+ * - HEAP_SNAPSHOT_FRAME_END: the number of objects and the number of references written.
+ */
+
+#define HEAP_SNAPSHOT_MAGIC 0x4E53484F /* "OHSN" */
+#define HEAP_SNAPSHOT_VERSION 1
+/* Largest encoding of a 64 bit varint. */
+#define HEAP_SNAPSHOT_VARINT_MAXIMUM 10
+
+typedef enum HeapSnapshotFrameType {
+	HEAP_SNAPSHOT_FRAME_END = 0, /**< Object and reference totals, ending the snapshot */
+	HEAP_SNAPSHOT_FRAME_OBJECTS = 1, /**< Object records */
+	HEAP_SNAPSHOT_FRAME_REFERENCES = 2, /**< Continued references of one object */
+} HeapSnapshotFrameType;
+
+typedef struct HeapSnapshotHeader {
+	uint32_t magic; /**< HEAP_SNAPSHOT_MAGIC */
+	uint32_t version; /**< HEAP_SNAPSHOT_VERSION */
+	uint32_t objectAlignment; /**< Size in bytes of the unit of object offsets and sizes */
+	uint32_t reserved;
+	uint64_t heapBase; /**< Address object offsets are relative to */
+	uint64_t heapTop; /**< Address following the heap */
+} HeapSnapshotHeader;
+
+#endif /* HEAPSNAPSHOTFORMAT_HPP_ */
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include "omrport.h"
+
+#include "HeapSnapshotWriter.hpp"
+
+#include "AtomicOperations.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MarkingScheme.hpp"
+#include "ObjectScanner.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#include "SlotObject.hpp"
+
+MM_HeapSnapshotWriter *
+MM_HeapSnapshotWriter::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapSnapshotWriter *writer = (MM_HeapSnapshotWriter *)env->getForge()->allocate(sizeof(MM_HeapSnapshotWriter), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != writer) {
+		new(writer) MM_HeapSnapshotWriter();
+		if (!writer->initialize(env)) {
+			writer->kill(env);
+			writer = NULL;
+		}
+	}
+	return writer;
+}
+
+void
+MM_HeapSnapshotWriter::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapSnapshotWriter::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_frameCount = extensions->dispatcher->threadCountMaximum();
+	_frames = (ThreadFrame *)env->getForge()->allocate(_frameCount * (sizeof(ThreadFrame) + HEAP_SNAPSHOT_FRAME_SIZE), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _frames) {
+		return false;
+	}
+	/* the payloads follow the frames */
+	uint8_t *payload = (uint8_t *)&_frames[_frameCount];
+	for (uintptr_t slaveID = 0; slaveID < _frameCount; slaveID++) {
+		_frames[slaveID].payload = payload + (slaveID * HEAP_SNAPSHOT_FRAME_SIZE);
+		_frames[slaveID].used = 0;
+		_frames[slaveID].previousEnd = 0;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_streamMutex, 0, "MM_HeapSnapshotWriter stream monitor")) {
+		_streamMutex = NULL;
+		return false;
+	}
+
+	_markingScheme = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme();
+	_heapBase = (uintptr_t)extensions->heap->getHeapBase();
+	_objectAlignment = extensions->getObjectAlignmentInBytes();
+
+	return true;
+}
+
+void
+MM_HeapSnapshotWriter::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _streamMutex) {
+		omrthread_monitor_destroy(_streamMutex);
+		_streamMutex = NULL;
+	}
+
+	if (NULL != _frames) {
+		env->getForge()->free(_frames);
+		_frames = NULL;
+	}
+}
+
+bool
+MM_HeapSnapshotWriter::writeSnapshot(MM_EnvironmentBase *env, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_stream = omrfilestream_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (NULL == _stream) {
+		return false;
+	}
+
+	_objectCount = 0;
+	_referenceCount = 0;
+	_writeFailed = false;
+
+	HeapSnapshotHeader header;
+	header.magic = HEAP_SNAPSHOT_MAGIC;
+	header.version = HEAP_SNAPSHOT_VERSION;
+	header.objectAlignment = (uint32_t)_objectAlignment;
+	header.reserved = 0;
+	header.heapBase = (uint64_t)_heapBase;
+	header.heapTop = (uint64_t)(uintptr_t)extensions->heap->getHeapTop();
+	if ((intptr_t)sizeof(header) != omrfilestream_write(_stream, &header, sizeof(header))) {
+		_writeFailed = true;
+	}
+
+	if (!_writeFailed) {
+		/* mark the heap, so that only live objects are written */
+		MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+		heapWalker->allObjectsBatchDo(env, writeObjectBatch, this, 0, true);
+
+		for (uintptr_t slaveID = 0; slaveID < _frameCount; slaveID++) {
+			closeFrame(env, &_frames[slaveID]);
+		}
+
+		uint8_t totals[2 * HEAP_SNAPSHOT_VARINT_MAXIMUM];
+		uint8_t *cursor = encodeVarint(totals, _objectCount);
+		cursor = encodeVarint(cursor, _referenceCount);
+		writeFrame(env, HEAP_SNAPSHOT_FRAME_END, totals, cursor - totals);
+	}
+
+	if (0 != omrfilestream_close(_stream)) {
+		_writeFailed = true;
+	}
+	_stream = NULL;
+
+	return !_writeFailed;
+}
+
+void
+MM_HeapSnapshotWriter::writeObjectBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t objectCount, void *userData)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_HeapSnapshotWriter *writer = (MM_HeapSnapshotWriter *)userData;
+	ThreadFrame *frame = &writer->_frames[env->getSlaveID()];
+	uintptr_t liveCount = 0;
+	uintptr_t referenceCount = 0;
+
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		if (writer->_markingScheme->isMarked(objects[i])) {
+			referenceCount += writer->writeObject(env, frame, objects[i]);
+			liveCount += 1;
+		}
+	}
+
+	MM_AtomicOperations::add(&writer->_objectCount, liveCount);
+	MM_AtomicOperations::add(&writer->_referenceCount, referenceCount);
+}
+
+uintptr_t
+MM_HeapSnapshotWriter::writeObject(MM_EnvironmentBase *env, ThreadFrame *frame, omrobjectptr_t object)
+{
+	uintptr_t objectOffset = getOffset(object);
+	uintptr_t objectSize = env->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(object) / _objectAlignment;
+	uintptr_t referenceCount = 0;
+	uintptr_t chunkCount = 0;
+	bool isFirstChunk = true;
+
+	GC_ObjectScannerState objectScannerState;
+	uintptr_t sizeToDo = UDATA_MAX;
+	GC_ObjectScanner *objectScanner = _markingScheme->getMarkingDelegate()->getObjectScanner(env, object, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
+	if (NULL != objectScanner) {
+		GC_SlotObject *slotObject = NULL;
+#if defined(OMR_GC_LEAF_BITS)
+		bool isLeafSlot = false;
+		while (NULL != (slotObject = objectScanner->getNextSlot(isLeafSlot))) {
+#else /* OMR_GC_LEAF_BITS */
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+#endif /* OMR_GC_LEAF_BITS */
+			omrobjectptr_t reference = slotObject->readReferenceFromSlot();
+			if (NULL != reference) {
+				if (HEAP_SNAPSHOT_REFERENCE_CHUNK == chunkCount) {
+					writeReferences(env, frame, objectOffset, objectSize, chunkCount, isFirstChunk);
+					isFirstChunk = false;
+					chunkCount = 0;
+				}
+				frame->references[chunkCount] = getOffset(reference);
+				chunkCount += 1;
+				referenceCount += 1;
+			}
+		}
+	}
+
+	if (isFirstChunk || (0 != chunkCount)) {
+		writeReferences(env, frame, objectOffset, objectSize, chunkCount, isFirstChunk);
+	}
+
+	return referenceCount;
+}
+
+void
+MM_HeapSnapshotWriter::writeReferences(MM_EnvironmentBase *env, ThreadFrame *frame, uintptr_t objectOffset, uintptr_t objectSize, uintptr_t referenceCount, bool isFirstChunk)
+{
+	uint8_t *cursor = NULL;
+
+	if (isFirstChunk) {
+		if ((frame->used + HEAP_SNAPSHOT_RECORD_MAXIMUM) > HEAP_SNAPSHOT_FRAME_SIZE) {
+			closeFrame(env, frame);
+		}
+		cursor = frame->payload + frame->used;
+		cursor = encodeSignedVarint(cursor, (int64_t)(objectOffset - frame->previousEnd));
+		cursor = encodeVarint(cursor, objectSize);
+		cursor = encodeVarint(cursor, referenceCount);
+		frame->previousEnd = objectOffset + objectSize;
+	} else {
+		/* the references must follow the frame holding the object record */
+		closeFrame(env, frame);
+		cursor = encodeVarint(frame->payload, objectOffset);
+	}
+
+	for (uintptr_t i = 0; i < referenceCount; i++) {
+		cursor = encodeSignedVarint(cursor, (int64_t)(frame->references[i] - objectOffset));
+	}
+
+	if (isFirstChunk) {
+		frame->used = cursor - frame->payload;
+	} else {
+		writeFrame(env, HEAP_SNAPSHOT_FRAME_REFERENCES, frame->payload, cursor - frame->payload);
+	}
+}
+
+void
+MM_HeapSnapshotWriter::closeFrame(MM_EnvironmentBase *env, ThreadFrame *frame)
+{
+	if (0 != frame->used) {
+		writeFrame(env, HEAP_SNAPSHOT_FRAME_OBJECTS, frame->payload, frame->used);
+		frame->used = 0;
+	}
+	frame->previousEnd = 0;
+}
+
+void
+MM_HeapSnapshotWriter::writeFrame(MM_EnvironmentBase *env, HeapSnapshotFrameType type, uint8_t *payload, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint8_t frameHeader[1 + HEAP_SNAPSHOT_VARINT_MAXIMUM];
+	frameHeader[0] = (uint8_t)type;
+	intptr_t frameHeaderLength = encodeVarint(frameHeader + 1, length) - frameHeader;
+
+	omrthread_monitor_enter(_streamMutex);
+	if (!_writeFailed) {
+		if ((frameHeaderLength != omrfilestream_write(_stream, frameHeader, frameHeaderLength))
+			|| ((intptr_t)length != omrfilestream_write(_stream, payload, (intptr_t)length))
+		) {
+			_writeFailed = true;
+		}
+	}
+	omrthread_monitor_exit(_streamMutex);
+}
+
+uint8_t *
+MM_HeapSnapshotWriter::encodeVarint(uint8_t *cursor, uint64_t value)
+{
+	while (value >= 0x80) {
+		*cursor = (uint8_t)(value | 0x80);
+		cursor += 1;
+		value >>= 7;
+	}
+	*cursor = (uint8_t)value;
+	return cursor + 1;
+}
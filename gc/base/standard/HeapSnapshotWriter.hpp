@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(HEAPSNAPSHOTWRITER_HPP_)
+#define HEAPSNAPSHOTWRITER_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapSnapshotFormat.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
+class MM_MarkingScheme;
+
+/* Size of the frame buffer of each GC thread */
+#define HEAP_SNAPSHOT_FRAME_SIZE (64 * 1024)
+/* Number of references of an object encoded per record */
+#define HEAP_SNAPSHOT_REFERENCE_CHUNK 256
+/* Largest record: three varints, then the references */
+#define HEAP_SNAPSHOT_RECORD_MAXIMUM ((3 + HEAP_SNAPSHOT_REFERENCE_CHUNK) * HEAP_SNAPSHOT_VARINT_MAXIMUM)
+
+/**
+ * Streams the live object graph of the heap to a file, in the format described in HeapSnapshotFormat.hpp. The heap
+ * is marked, then walked in parallel by the GC threads; each thread encodes the live objects of the regions it walks
+ * into its own frame buffer and appends the frame to the file when the buffer is full, so the memory used does not
+ * depend on the size of the heap.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_HeapSnapshotWriter : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	typedef struct ThreadFrame {
+		uint8_t *payload; /**< payload of the frame being encoded */
+		uintptr_t used; /**< bytes of payload in use */
+		uintptr_t previousEnd; /**< offset of the end of the last object of the frame */
+		uintptr_t references[HEAP_SNAPSHOT_REFERENCE_CHUNK]; /**< offsets of the references of the object being encoded */
+	} ThreadFrame;
+
+	ThreadFrame *_frames; /**< frames indexed by slave ID */
+	uintptr_t _frameCount; /**< number of entries in _frames */
+	OMRFileStream *_stream; /**< the snapshot file */
+	omrthread_monitor_t _streamMutex; /**< serializes the frames written by the GC threads */
+	MM_MarkingScheme *_markingScheme; /**< tells live objects apart and scans them */
+	uintptr_t _heapBase; /**< address object offsets are relative to */
+	uintptr_t _objectAlignment; /**< size in bytes of the unit of offsets and sizes */
+	volatile uintptr_t _objectCount; /**< objects written */
+	volatile uintptr_t _referenceCount; /**< references written */
+	volatile bool _writeFailed; /**< set if a write to the file failed */
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Heap walker callback, encoding the live objects of a batch into the frame of the calling thread.
+	 */
+	static void writeObjectBatch(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t *objects, uintptr_t objectCount, void *userData);
+
+	/**
+	 * Encode an object record, with up to HEAP_SNAPSHOT_REFERENCE_CHUNK references, then the frames of its other references.
+	 * @return the number of references of the object
+	 */
+	uintptr_t writeObject(MM_EnvironmentBase *env, ThreadFrame *frame, omrobjectptr_t object);
+
+	/**
+	 * Encode the first referenceCount entries of frame->references, for the object at objectOffset: in an object record
+	 * if isFirstChunk is set, otherwise in a frame of their own.
+	 */
+	void writeReferences(MM_EnvironmentBase *env, ThreadFrame *frame, uintptr_t objectOffset, uintptr_t objectSize, uintptr_t referenceCount, bool isFirstChunk);
+
+	/**
+	 * Append the frame being encoded to the file, if it is not empty, and start a new one.
+	 */
+	void closeFrame(MM_EnvironmentBase *env, ThreadFrame *frame);
+
+	/**
+	 * Append a frame to the file. Called by all of the GC threads.
+	 */
+	void writeFrame(MM_EnvironmentBase *env, HeapSnapshotFrameType type, uint8_t *payload, uintptr_t length);
+
+	MMINLINE uintptr_t getOffset(void *address) { return ((uintptr_t)address - _heapBase) / _objectAlignment; }
+
+	static uint8_t *encodeVarint(uint8_t *cursor, uint64_t value);
+	static MMINLINE uint8_t *encodeSignedVarint(uint8_t *cursor, int64_t value) { return encodeVarint(cursor, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63)); }
+
+protected:
+public:
+	static MM_HeapSnapshotWriter *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Write a snapshot of the live objects of the heap to a file. The caller must have exclusive VM access.
+	 * @param fileName the file to write, replaced if it exists
+	 * @return true on success, false if the file could not be written
+	 */
+	bool writeSnapshot(MM_EnvironmentBase *env, const char *fileName);
+
+	MMINLINE uintptr_t getObjectCount() { return _objectCount; }
+	MMINLINE uintptr_t getReferenceCount() { return _referenceCount; }
+
+	MM_HeapSnapshotWriter() :
+		MM_BaseNonVirtual()
+		,_frames(NULL)
+		,_frameCount(0)
+		,_stream(NULL)
+		,_streamMutex(NULL)
+		,_markingScheme(NULL)
+		,_heapBase(0)
+		,_objectAlignment(0)
+		,_objectCount(0)
+		,_referenceCount(0)
+		,_writeFailed(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* HEAPSNAPSHOTWRITER_HPP_ */
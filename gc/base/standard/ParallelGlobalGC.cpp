@@ -45,6 +45,7 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "MarkingScheme.hpp"
+#include "MemoryManager.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
@@ -63,6 +64,7 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetCards.hpp"
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #include "WorkPackets.hpp"
@@ -123,7 +125,8 @@ fixObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectp
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 /**
- * Fix the heap if the remembered set for the scavenger is in an overflow state.
+ * Fix the heap if the remembered set for the scavenger is in an overflow state, or is kept in
+ * remembered set cards, whose drain walks the tenure objects following each remembered object.
  */
 static void
 hookGlobalGcSweepEndRsoSafetyFixHeap(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
@@ -132,7 +135,7 @@ hookGlobalGcSweepEndRsoSafetyFixHeap(J9HookInterface** hook, uintptr_t eventNum,
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
-	extensions->scavengerRsoScanUnsafe = !extensions->isRememberedSetInOverflowState();
+	extensions->scavengerRsoScanUnsafe = !extensions->isRememberedSetInOverflowState() && (NULL == extensions->rememberedSetCards);
 	if (!extensions->scavengerRsoScanUnsafe) {
 		MM_ParallelGlobalGC *pggc = (MM_ParallelGlobalGC *)userData;
 		pggc->fixHeapForWalk(env, MEMORY_TYPE_OLD_RAM, FIXUP_DEBUG_TOOLING, fixObject);
@@ -426,7 +429,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	 */
 	if (_delegate.isAllowUserHeapWalk() || env->_cycleState->_gcCode.isRASDumpGC()) {
 		if (!_fixHeapForWalkCompleted) {
-#if defined(J9VM_GC_MODRON_COMPACTION)
+#if defined(OMR_GC_MODRON_COMPACTION)
 			if (compactedThisCycle) {
 				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 				U_64 startTime = omrtime_hires_clock();
@@ -434,7 +437,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 				_extensions->globalGCStats.fixHeapForWalkTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 				_extensions->globalGCStats.fixHeapForWalkReason = FIXUP_DEBUG_TOOLING;
 			} else
-#endif /* J9VM_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_COMPACTION */
 			{
 				fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 			}
@@ -462,6 +465,15 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	_extensions->rememberedSet.compact(env);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	
+	if (_extensions->freeEntryQuickLists
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		|| _extensions->loaSizeBands
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+	) {
+		/* Free list is final for this cycle (swept, and compacted if needed), carve the quick-lists out of it */
+		_extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool()->populateFreeEntryQuickLists(env);
+	}
+
 	/* Restart the allocation caches associated to all threads */
 	masterThreadRestartAllocationCaches(env);
 	
@@ -824,6 +836,9 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+	/* At most the occupied part of the heap is live */
+	MM_Heap *heap = _extensions->heap;
+	markTask.setExpectedWorkSize(heap->getActiveMemorySize() - heap->getApproximateActiveFreeMemorySize());
 	_dispatcher->run(env, &markTask);
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
@@ -915,6 +930,13 @@ MM_ParallelGlobalGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	}
 
 	GC_OMRVMInterface::flushCachesForGC(env);
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCards) {
+		/* Collectors scan the remembered set list, it is absorbed back into the cards at the end of the collection */
+		_extensions->rememberedSetCards->drain(MM_EnvironmentStandard::getEnvironment(env), true);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	
 	_markingScheme->getMarkMap()->setMarkMapValid(false);
 	
@@ -1081,6 +1103,13 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 {
 	GC_OMRVMInterface::flushCachesForGC(env);
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetCards) {
+		/* Walkers find the remembered set in the list, the cards keep it */
+		_extensions->rememberedSetCards->drain(MM_EnvironmentStandard::getEnvironment(env), false);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	_markingScheme->masterSetupForWalk(env);
 	
 	/* Run a parallel mark */
@@ -1197,6 +1226,9 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if (extensions->memoryMaintenance) {
+		return extensions->memoryManager->startMemoryMaintenance();
+	}
 	return true;
 }
 
@@ -1208,6 +1240,7 @@ MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 		extensions->scavenger->collectorShutdown(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	extensions->memoryManager->stopMemoryMaintenance();
 }
 
 /**
@@ -47,6 +47,7 @@
 #include "SweepPoolState.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
+#include "HeapMapScan.hpp"
 #include "HeapMapWordIterator.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
@@ -341,14 +342,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapScan::findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -430,17 +424,17 @@ MM_ParallelSweepScheme::performSamplingCalculations(MM_ParallelSweepChunk *sweep
 	startSearchAt = OMR_MAX(startSearchAt, heapSlotFreeCurrent + J9MODRON_HEAP_SLOTS_PER_MARK_SLOT);
 	endSearchAt = OMR_MIN(endSearchAt, (uintptr_t*)sweepChunk->chunkTop);
 	if (startSearchAt < endSearchAt) {
-		while ( startSearchAt < endSearchAt ) {
-			MM_HeapMapWordIterator nextMarkedObjectIterator(_currentMarkMap, startSearchAt);
+		/* Find the mark map slot holding the next object, skipping empty slots in bulk */
+		uintptr_t *markMapSearchAt = (uintptr_t *)(_currentSweepBits + (((uintptr_t)startSearchAt - (uintptr_t)_heapBase) / J9MODRON_HEAP_SLOTS_PER_MARK_SLOT));
+		uintptr_t markMapSlotsToSearch = ((uintptr_t)(endSearchAt - startSearchAt) + J9MODRON_HEAP_SLOTS_PER_MARK_SLOT - 1) / J9MODRON_HEAP_SLOTS_PER_MARK_SLOT;
+		uintptr_t *markMapFound = MM_HeapMapScan::findNonEmptySlot(markMapSearchAt, markMapSearchAt + markMapSlotsToSearch);
+		if (markMapFound < (markMapSearchAt + markMapSlotsToSearch)) {
+			MM_HeapMapWordIterator nextMarkedObjectIterator(*markMapFound, startSearchAt + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * (markMapFound - markMapSearchAt)));
 			omrobjectptr_t nextObject = nextMarkedObjectIterator.nextObject();
-			if (NULL != nextObject) {
-				uintptr_t holeSize = (uintptr_t)nextObject - (uintptr_t)endOfPrevObject;
-				if (holeSize < minimumFreeEntrySize) {
-					darkMatter += holeSize;
-				}
-				break;
+			uintptr_t holeSize = (uintptr_t)nextObject - (uintptr_t)endOfPrevObject;
+			if (holeSize < minimumFreeEntrySize) {
+				darkMatter += holeSize;
 			}
-			startSearchAt += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT;
 		}
 	} else if (endSearchAt > endOfPrevObject) {
 		darkMatter += (uintptr_t)endSearchAt - (uintptr_t)endOfPrevObject;
@@ -812,6 +806,8 @@ MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 	setupForSweep(env);
 	
 	MM_ParallelSweepTask sweepTask(env, _extensions->dispatcher, this);
+	/* The sweep walks the mark map of the whole active heap */
+	sweepTask.setExpectedWorkSize(_extensions->heap->getActiveMemorySize());
 	_extensions->dispatcher->run(env, &sweepTask);
 }
 
@@ -676,7 +676,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		_heap->decommitMemoryInBackground(
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
@@ -846,7 +846,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 		_subSpace->heapReconfigured(env);
 
 		/* Decommit the heap (the return value really doesn't matter here - its already too late) */
-		_heap->decommitMemory(
+		_heap->decommitMemoryInBackground(
 			removeMemoryBase,
 			removeMemorySize,
 			previousValidAddressNotRemoved,
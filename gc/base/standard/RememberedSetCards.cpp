@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "omrmodroncore.h"
+
+#include "AtomicOperations.hpp"
+#include "Collector.hpp"
+#include "Dispatcher.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectModel.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#include "RememberedSetCards.hpp"
+#include "RememberedSetCardsDrainTask.hpp"
+#include "Scavenger.hpp"
+#include "SublistFragment.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+
+MM_RememberedSetCards *
+MM_RememberedSetCards::newInstance(MM_EnvironmentBase *env)
+{
+	MM_RememberedSetCards *rememberedSetCards = (MM_RememberedSetCards *)env->getForge()->allocate(sizeof(MM_RememberedSetCards), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != rememberedSetCards) {
+		new(rememberedSetCards) MM_RememberedSetCards(env);
+		if (!rememberedSetCards->initialize(env)) {
+			rememberedSetCards->kill(env);
+			rememberedSetCards = NULL;
+		}
+	}
+	return rememberedSetCards;
+}
+
+void
+MM_RememberedSetCards::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RememberedSetCards::initialize(MM_EnvironmentBase *env)
+{
+	_heapBase = (uint8_t *)_extensions->heap->getHeapBase();
+	_objectAlignmentShift = _extensions->objectModel.getObjectAlignmentShift();
+	/* Card values are stored in a byte, 0 meaning "clean" */
+	Assert_MM_true((CARD_SIZE >> _objectAlignmentShift) < 256);
+
+	/* Round up to whole words, cards are updated with a compare and swap of the word holding them */
+	uintptr_t cardCount = MM_Math::roundToCeiling(CARD_SIZE, _extensions->heap->getMaximumPhysicalRange()) >> CARD_SIZE_SHIFT;
+	_cardTableSize = MM_Math::roundToCeiling(sizeof(uint32_t), cardCount);
+	_cards = (uint8_t *)env->getForge()->allocate(_cardTableSize, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+	memset(_cards, 0, _cardTableSize);
+
+	if (!_dirtyCards.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET)) {
+		return false;
+	}
+	_dirtyCards.setGrowSize(J9_SCV_REMSET_SIZE);
+
+	return true;
+}
+
+void
+MM_RememberedSetCards::tearDown(MM_EnvironmentBase *env)
+{
+	_dirtyCards.tearDown(env);
+
+	if (NULL != _cards) {
+		env->getForge()->free(_cards);
+		_cards = NULL;
+	}
+}
+
+bool
+MM_RememberedSetCards::rememberObjectInCard(omrobjectptr_t objectPtr)
+{
+	uintptr_t heapOffset = (uintptr_t)objectPtr - (uintptr_t)_heapBase;
+	uintptr_t cardIndex = heapOffset >> CARD_SIZE_SHIFT;
+	uint8_t cardValue = (uint8_t)(((heapOffset & (CARD_SIZE - 1)) >> _objectAlignmentShift) + 1);
+	volatile uint32_t *cardWord = (volatile uint32_t *)(_cards + (cardIndex & ~(uintptr_t)(sizeof(uint32_t) - 1)));
+	uintptr_t cardInWord = cardIndex & (sizeof(uint32_t) - 1);
+
+	/* Keep the lowest offset in the card, so a drain finds every remembered object by walking to the card top */
+	while (true) {
+		uint32_t oldWord = *cardWord;
+		uint32_t newWord = oldWord;
+		uint8_t oldValue = ((uint8_t *)&oldWord)[cardInWord];
+		if ((0 != oldValue) && (oldValue <= cardValue)) {
+			return false;
+		}
+		((uint8_t *)&newWord)[cardInWord] = cardValue;
+		if (oldWord == MM_AtomicOperations::lockCompareExchangeU32(cardWord, oldWord, newWord)) {
+			return (0 == oldValue);
+		}
+	}
+}
+
+void
+MM_RememberedSetCards::recordObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	if (rememberObjectInCard(objectPtr)) {
+		/* This thread dirtied the card, so it is the only one to list it */
+		uintptr_t cardBase = (uintptr_t)_heapBase + ((((uintptr_t)objectPtr - (uintptr_t)_heapBase) >> CARD_SIZE_SHIFT) << CARD_SIZE_SHIFT);
+		env->_rememberedSetCardsFragment.parentList = &_dirtyCards;
+		MM_SublistFragment fragment(&env->_rememberedSetCardsFragment);
+		if (!fragment.add(env, cardBase)) {
+			/* The card can not be drained, its objects will be found by the overflow handling */
+			_extensions->setRememberedSetOverflowState();
+		}
+	}
+}
+
+void
+MM_RememberedSetCards::flushBuffer(MM_EnvironmentStandard *env)
+{
+	uintptr_t bufferCount = env->_rememberedSetBufferCount;
+	for (uintptr_t i = 0; i < bufferCount; i++) {
+		recordObject(env, env->_rememberedSetBuffer[i]);
+	}
+	env->_rememberedSetBufferCount = 0;
+	MM_AtomicOperations::add(&_bufferedObjects, bufferCount);
+}
+
+void
+MM_RememberedSetCards::drain(MM_EnvironmentStandard *env, bool cleanCards)
+{
+	/* In overflow the remembered bits are walked from the heap, the cards only have to be cleaned */
+	bool overflow = _extensions->isRememberedSetInOverflowState();
+	_drainAddsObjects = !overflow;
+	_drainCleansCards = cleanCards || overflow;
+	_drainCards = 0;
+	_drainCleanedCards = 0;
+	_drainObjects = 0;
+
+	/* Every object of the list is in a dirty card, the list is rebuilt from the cards */
+	flushFragments(env);
+	_extensions->rememberedSet.clear(env);
+
+	_dirtyCards.startProcessingSublist();
+	MM_RememberedSetCardsDrainTask drainTask(env, _extensions->dispatcher, this);
+	/* Each dirty card is walked from its lowest remembered object to its top */
+	drainTask.setExpectedWorkSize(_dirtyCards.countElements() * CARD_SIZE);
+	_extensions->dispatcher->run(env, &drainTask);
+
+	if (_drainCleansCards) {
+		_dirtyCards.clear(env);
+	} else {
+		_dirtyCards.compact(env);
+	}
+
+	_lastDrainCards = _drainCards;
+	_lastDrainCleanedCards = _drainCleanedCards;
+	_lastDrainObjects = _drainObjects;
+	_lastDrainBufferedObjects = _bufferedObjects;
+	_bufferedObjects = 0;
+}
+
+void
+MM_RememberedSetCards::drainDirtyCards(MM_EnvironmentStandard *env)
+{
+	MM_Scavenger *scavenger = _extensions->scavenger;
+	uintptr_t cardCount = 0;
+	uintptr_t cleanedCount = 0;
+	uintptr_t objectCount = 0;
+
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = _dirtyCards.popPreviousPuddle(puddle))) {
+		GC_SublistSlotIterator dirtyCardSlotIterator(puddle);
+		uintptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (uintptr_t *)dirtyCardSlotIterator.nextSlot())) {
+			uint8_t *cardBase = (uint8_t *)*slotPtr;
+			if (NULL == cardBase) {
+				dirtyCardSlotIterator.removeSlot();
+				continue;
+			}
+
+			uint8_t *card = _cards + (((uintptr_t)cardBase - (uintptr_t)_heapBase) >> CARD_SIZE_SHIFT);
+			Assert_MM_true(0 != *card);
+			uintptr_t cardObjectCount = 0;
+			if (_drainAddsObjects) {
+				/* Objects below the lowest remembered one are never remembered, the walk starts there */
+				omrobjectptr_t firstObject = (omrobjectptr_t)(cardBase + ((uintptr_t)(*card - 1) << _objectAlignmentShift));
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObject, (omrobjectptr_t)(cardBase + CARD_SIZE), false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					if (_extensions->objectModel.isRemembered(objectPtr)) {
+						scavenger->addToRememberedSetFragment(env, objectPtr);
+						cardObjectCount += 1;
+					}
+				}
+			}
+			/* A card whose objects have all been removed from the remembered set since it was dirtied is cleaned */
+			if (_drainCleansCards || (0 == cardObjectCount)) {
+				*card = 0;
+				dirtyCardSlotIterator.removeSlot();
+				cleanedCount += 1;
+			}
+			cardCount += 1;
+			objectCount += cardObjectCount;
+		}
+	}
+	MM_SublistFragment::flush((J9VMGC_SublistFragment *)&env->_scavengerRememberedSet);
+
+	MM_AtomicOperations::add(&_drainCards, cardCount);
+	MM_AtomicOperations::add(&_drainCleanedCards, cleanedCount);
+	MM_AtomicOperations::add(&_drainObjects, objectCount);
+}
+
+void
+MM_RememberedSetCards::flushFragments(MM_EnvironmentStandard *env)
+{
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentStandard *walkEnv = MM_EnvironmentStandard::getEnvironment(walkThread);
+		MM_SublistFragment::flush((J9VMGC_SublistFragment *)&walkEnv->_scavengerRememberedSet);
+		if (NULL != walkEnv->_rememberedSetCardsFragment.parentList) {
+			MM_SublistFragment::flush(&walkEnv->_rememberedSetCardsFragment);
+		}
+	}
+}
+
+void
+MM_RememberedSetCards::absorbRememberedSet(MM_EnvironmentStandard *env, MM_Collector *markingCollector)
+{
+	/* GC threads may still hold fragments of the puddles about to be freed */
+	flushFragments(env);
+
+	GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			omrobjectptr_t objectPtr = *slotPtr;
+			if ((NULL != objectPtr) && ((NULL == markingCollector) || markingCollector->isMarked(objectPtr))) {
+				recordObject(env, objectPtr);
+			}
+		}
+	}
+	_extensions->rememberedSet.clear(env);
+	MM_SublistFragment::flush(&env->_rememberedSetCardsFragment);
+}
+
+void
+MM_RememberedSetCards::releaseRememberedSet(MM_EnvironmentStandard *env)
+{
+	/* GC threads may still hold fragments of the puddles about to be freed, and of the dirty cards they listed */
+	flushFragments(env);
+	_extensions->rememberedSet.clear(env);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
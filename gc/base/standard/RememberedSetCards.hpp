@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(REMEMBEREDSETCARDS_HPP_)
+#define REMEMBEREDSETCARDS_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentStandard.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SublistPool.hpp"
+
+class MM_Collector;
+
+/**
+ * Card granular remembered set used between scavenges.
+ *
+ * Mutators record the objects they remember in a sequential store buffer in their environment
+ * (@see MM_EnvironmentStandard::_rememberedSetBuffer), which is flushed here in bulk. Each card of the heap
+ * holds the lowest offset of a remembered object in the card, so a card is dirtied once however many
+ * objects are remembered in it, and only newly dirtied cards are appended to the dirty card list.
+ *
+ * At the start of a collection the dirty cards are drained, in parallel, into the remembered set list used by
+ * the collectors. A scavenge leaves the cards dirty and records the objects it remembers in them as it goes,
+ * so the list is simply released at its end; cards are cleaned by the first drain finding no remembered object
+ * left in them. A global collection cleans the cards and absorbs the list back into them once dead objects are
+ * known. The cost of a drain is bounded by the number of dirty cards, whatever the number of stores the mutators
+ * made. When the remembered set is in overflow the cards are simply cleaned, as the remembered bit of each
+ * object is the authoritative record that the overflow handling walks.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetCards : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	uint8_t *_heapBase; /**< base of the heap range covered by the cards */
+	uintptr_t _objectAlignmentShift; /**< log2 of the object alignment, offsets in a card are stored in alignment units */
+	uint8_t *_cards; /**< per card, 0 if clean, otherwise one plus the offset of the lowest remembered object in the card */
+	uintptr_t _cardTableSize; /**< size of _cards in bytes, a multiple of 4 */
+	MM_SublistPool _dirtyCards; /**< base address of each dirty card, appended when the card is dirtied */
+	volatile uintptr_t _bufferedObjects; /**< number of objects flushed from the store buffers since the last drain */
+	bool _drainAddsObjects; /**< true if the drain in progress adds the remembered objects of the dirty cards to the list */
+	bool _drainCleansCards; /**< true if the drain in progress cleans every dirty card */
+	volatile uintptr_t _drainCards; /**< number of dirty cards processed by the drain in progress */
+	volatile uintptr_t _drainCleanedCards; /**< number of cards cleaned by the drain in progress */
+	volatile uintptr_t _drainObjects; /**< number of remembered objects found by the drain in progress */
+	uintptr_t _lastDrainCards; /**< number of dirty cards processed by the last drain */
+	uintptr_t _lastDrainCleanedCards; /**< number of cards cleaned by the last drain */
+	uintptr_t _lastDrainObjects; /**< number of remembered objects found in the dirty cards by the last drain */
+	uintptr_t _lastDrainBufferedObjects; /**< number of objects flushed from the store buffers between the two last drains */
+
+protected:
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_RememberedSetCards *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record the objects held in the store buffer of a thread and empty the buffer. May be called by
+	 * any number of threads concurrently, outside of a collection.
+	 * @param env thread owning the store buffer
+	 */
+	void flushBuffer(MM_EnvironmentStandard *env);
+
+	/**
+	 * Record an object remembered by a GC thread during a collection. May be called by any number of
+	 * threads concurrently.
+	 * @param env calling thread environment
+	 * @param objectPtr the object which has just been flagged as remembered
+	 */
+	void recordObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Replace the content of the remembered set list, which the cards hold, by the remembered objects in
+	 * the dirty cards. Cards left without any remembered object are cleaned. The dirty cards are processed
+	 * by the GC threads. Must be called by the master thread while holding exclusive access, once all store
+	 * buffers and sublist fragments have been flushed.
+	 * @param env calling thread environment
+	 * @param cleanCards true to clean every card, for the list to be absorbed back at the end of the collection
+	 */
+	void drain(MM_EnvironmentStandard *env, bool cleanCards);
+
+	/**
+	 * Drain the dirty cards of the puddles this thread takes from the dirty card list.
+	 * @param env calling GC thread environment
+	 * @see drain()
+	 */
+	void drainDirtyCards(MM_EnvironmentStandard *env);
+
+	/**
+	 * Record the objects of the remembered set list in the cards and clear the list. Must be called by
+	 * a single thread at the end of a collection which cleaned the cards, while holding exclusive access.
+	 * @param env calling thread environment
+	 * @param markingCollector if not NULL, the collector whose mark map is used to discard dead objects
+	 */
+	void absorbRememberedSet(MM_EnvironmentStandard *env, MM_Collector *markingCollector);
+
+	/**
+	 * Clear the remembered set list at the end of a scavenge. The objects drained into it are still in
+	 * their dirty cards, and the objects remembered by the scavenge were recorded as they were remembered.
+	 * Must be called by a single thread, while holding exclusive access.
+	 * @param env calling thread environment
+	 */
+	void releaseRememberedSet(MM_EnvironmentStandard *env);
+
+	MMINLINE uintptr_t getLastDrainCards() const { return _lastDrainCards; }
+	MMINLINE uintptr_t getLastDrainCleanedCards() const { return _lastDrainCleanedCards; }
+	MMINLINE uintptr_t getLastDrainObjects() const { return _lastDrainObjects; }
+	MMINLINE uintptr_t getLastDrainBufferedObjects() const { return _lastDrainBufferedObjects; }
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_RememberedSetCards(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _heapBase(NULL)
+		, _objectAlignmentShift(0)
+		, _cards(NULL)
+		, _cardTableSize(0)
+		, _dirtyCards()
+		, _bufferedObjects(0)
+		, _drainAddsObjects(false)
+		, _drainCleansCards(false)
+		, _drainCards(0)
+		, _drainCleanedCards(0)
+		, _drainObjects(0)
+		, _lastDrainCards(0)
+		, _lastDrainCleanedCards(0)
+		, _lastDrainObjects(0)
+		, _lastDrainBufferedObjects(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+	bool rememberObjectInCard(omrobjectptr_t objectPtr);
+
+	/**
+	 * Flush the remembered set list and dirty card list fragments of all threads, before the puddles they
+	 * point into are freed or compacted.
+	 */
+	void flushFragments(MM_EnvironmentStandard *env);
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETCARDS_HPP_ */
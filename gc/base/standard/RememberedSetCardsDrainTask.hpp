@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(REMEMBEREDSETCARDSDRAINTASK_HPP_)
+#define REMEMBEREDSETCARDSDRAINTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "ParallelTask.hpp"
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+class MM_RememberedSetCards;
+
+/**
+ * Drain the dirty remembered set cards into the remembered set list, each GC thread taking whole puddles of the dirty card list.
+ * @see MM_RememberedSetCards::drain()
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetCardsDrainTask : public MM_ParallelTask
+{
+private:
+	MM_RememberedSetCards *_rememberedSetCards;
+
+public:
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_DRAIN_REMEMBERED_SET_CARDS; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_RememberedSetCardsDrainTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_RememberedSetCards *rememberedSetCards) :
+		MM_ParallelTask(env, dispatcher),
+		_rememberedSetCards(rememberedSetCards)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* REMEMBEREDSETCARDSDRAINTASK_HPP_ */
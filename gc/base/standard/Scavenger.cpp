@@ -46,6 +46,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AtomicOperations.hpp"
+#include "Bits.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -75,7 +76,9 @@
 #include "OMRVMInterface.hpp"
 #include "OMRVMThreadListIterator.hpp"
 #include "ParallelScavengeTask.hpp"
+#include "PhaseTimeline.hpp"
 #include "PhysicalSubArena.hpp"
+#include "RememberedSetCards.hpp"
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
@@ -102,6 +105,12 @@
 #define INITIAL_FREE_HISTORY_WEIGHT ((float)0.8)
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.8)
 
+/* Cost of a byte of garbage in the tenure space relative to a byte copied by a scavenge: it is only reclaimed
+ * by a global collection, and fragments the tenure space until then. Tenuring an age earlier pays off once
+ * more than 4 in 5 of its bytes survive the next scavenge.
+ */
+#define SCAVENGER_DECAY_TENURE_GARBAGE_COST 4.0
+
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
@@ -275,6 +284,15 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	}
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
+	_hotFieldCopyPageSize = _extensions->heap->getPageSize();
+
+	/* Cards are only walked while the tenure space is stable and walkable */
+	if (_extensions->scavengerRememberedSetCards && !_extensions->isConcurrentSweepEnabled() && !_extensions->isConcurrentScavengerEnabled()) {
+		_extensions->rememberedSetCards = MM_RememberedSetCards::newInstance(env);
+		if (NULL == _extensions->rememberedSetCards) {
+			return false;
+		}
+	}
 
 	return true;
 }
@@ -282,6 +300,11 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 void
 MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _extensions->rememberedSetCards) {
+		_extensions->rememberedSetCards->kill(env);
+		_extensions->rememberedSetCards = NULL;
+	}
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -406,6 +429,11 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (NULL != _extensions->rememberedSetCards) {
+		/* Objects remembered since the last collection are in the dirty cards, which stay dirty while they hold any */
+		_extensions->rememberedSetCards->drain(env, false);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
@@ -453,6 +481,9 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
+	/* At most the occupied part of the nursery is copied, and every remembered object is scanned */
+	uintptr_t evacuateOccupancy = _evacuateMemorySubSpace->getActiveMemorySize() - _evacuateMemorySubSpace->getApproximateActiveFreeMemorySize();
+	scavengeTask.setExpectedWorkSize(evacuateOccupancy + (_extensions->getRememberedCount() * OMR_MINIMUM_OBJECT_SIZE));
 	_dispatcher->run(env, &scavengeTask);
 
 	/* remove all scan caches temporary allocated in Heap */
@@ -738,6 +769,10 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
+	finalGCStats->_hotFieldCopyBytes += scavStats->_hotFieldCopyBytes;
+	finalGCStats->_hotFieldCopySameCacheLineCount += scavStats->_hotFieldCopySameCacheLineCount;
+	finalGCStats->_hotFieldCopySamePageCount += scavStats->_hotFieldCopySamePageCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -1176,6 +1211,10 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 					/* Update the slot */
 					*objectPtrIndirect = destinationObjectPtr;
 					toReturn = isObjectInNewSpace(destinationObjectPtr);
+					if (_extensions->scavengerHotFieldCopy && (NULL != env->_effectiveCopyScanCache)) {
+						/* place the hot children of the object right after it in the copy cache */
+						depthCopyHotFields(env, destinationObjectPtr);
+					}
 				}
 			}
 		} else if (isObjectInNewSpace(objectPtr)) {
@@ -1467,6 +1506,91 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 	return destinationObjectPtr;
 }
 
+/**
+ * Follow the chain of hot fields from an object that has just been copied and copy each
+ * hot child that has not yet been copied, so that it lands next to its parent in the
+ * copy cache (depth-first) rather than at the end of the breadth-first copy order.
+ * The hot field of each object is taken from the hot fields descriptor of its object
+ * scanner, which also drives the hot field statistics; objects whose language provides
+ * no descriptor have no hot field.
+ * The chain is followed for at most scavengerHotFieldCopyDepth objects. Slots are not
+ * updated here; the hot children are forwarded and parent slots will be fixed up when
+ * the parents are scanned.
+ *
+ * @param env current thread environment
+ * @param objectPtr the object that has just been copied (new location)
+ */
+void
+MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* preserve the copy cache that received the parent -- callers use it to detect copies and for aliasing */
+	MM_CopyScanCacheStandard *parentCopyCache = env->_effectiveCopyScanCache;
+	/* the cache may be retired and reused by another thread while copying children, so its type is read now */
+	bool isParentCopyCacheSemispace = (0 != (parentCopyCache->flags & OMR_SCAVENGER_CACHE_TYPE_SEMISPACE));
+	MM_ScavengerStats *scavStats = &env->_scavengerStats;
+	GC_ObjectScannerState objectScannerState;
+	omrobjectptr_t parentPtr = objectPtr;
+
+	for (uintptr_t depth = 0; depth < _extensions->scavengerHotFieldCopyDepth; depth++) {
+		GC_ObjectScanner *objectScanner = getObjectScanner(env, parentPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+		if ((NULL == objectScanner) || objectScanner->isIndexableObject() || (0 == objectScanner->getHotFieldsDescriptor())) {
+			break;
+		}
+
+		/* the hot field is the first slot flagged in the hot fields descriptor (bit n maps to the n-th slot after the header) */
+		uintptr_t hotSlotIndex = MM_Bits::leadingZeroes(objectScanner->getHotFieldsDescriptor());
+		fomrobject_t *hotSlotPtr = (fomrobject_t *)((uintptr_t)parentPtr + _extensions->objectModel.getHeaderSize(parentPtr)) + hotSlotIndex;
+		if ((uintptr_t)(hotSlotPtr + 1) > ((uintptr_t)parentPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(parentPtr))) {
+			break;
+		}
+
+		GC_SlotObject hotSlotObject(_omrVM, hotSlotPtr);
+		omrobjectptr_t childPtr = hotSlotObject.readReferenceFromSlot();
+		if ((NULL == childPtr) || !isObjectInEvacuateMemory(childPtr)) {
+			break;
+		}
+
+		MM_ForwardedHeader forwardHeader(childPtr);
+		if (NULL != forwardHeader.getForwardedObject()) {
+			/* already copied (by this or another thread), so locality is already decided */
+			break;
+		}
+
+		env->_effectiveCopyScanCache = NULL;
+		omrobjectptr_t childCopyPtr = copy(env, &forwardHeader);
+		if ((NULL == childCopyPtr) || (NULL == env->_effectiveCopyScanCache)) {
+			/* copy failed (backout pending) or another thread won the race to copy the child */
+			break;
+		}
+
+		uintptr_t parentAddress = (uintptr_t)parentPtr;
+		uintptr_t childAddress = (uintptr_t)childCopyPtr;
+		scavStats->_hotFieldCopyCount += 1;
+		scavStats->_hotFieldCopyBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(childCopyPtr);
+		if ((parentAddress / _cacheLineAlignment) == (childAddress / _cacheLineAlignment)) {
+			scavStats->_hotFieldCopySameCacheLineCount += 1;
+		}
+		if ((parentAddress / _hotFieldCopyPageSize) == (childAddress / _hotFieldCopyPageSize)) {
+			scavStats->_hotFieldCopySamePageCount += 1;
+		}
+
+		parentPtr = childCopyPtr;
+	}
+
+	/* The parent cache may have been retired to the scan list while copying children. Callers may only alias to
+	 * it while it is still this thread's copy cache of the same type and still holds the parent; otherwise report
+	 * no cache, as for an object copied by another thread.
+	 */
+	MM_CopyScanCacheStandard *currentCopyCache = isParentCopyCacheSemispace ? env->_survivorCopyScanCache : env->_tenureCopyScanCache;
+	if ((parentCopyCache != currentCopyCache)
+		|| ((uintptr_t)objectPtr < (uintptr_t)currentCopyCache->cacheBase)
+		|| ((uintptr_t)objectPtr >= (uintptr_t)currentCopyCache->cacheAlloc)
+	) {
+		parentCopyCache = NULL;
+	}
+	env->_effectiveCopyScanCache = parentCopyCache;
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -1852,8 +1976,14 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					waitEndTime = omrtime_hires_clock();
 					if (doneIndex != _doneIndex) {
 						env->_scavengerStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+						if (NULL != env->_phaseTimeline) {
+							env->_phaseTimeline->record(MM_PhaseTimeline::event_complete_stall, "scan caches", waitStartTime, waitEndTime);
+						}
 					} else {
 						env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
+						if (NULL != env->_phaseTimeline) {
+							env->_phaseTimeline->record(MM_PhaseTimeline::event_work_stall, "scan caches", waitStartTime, waitEndTime);
+						}
 					}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 				}
@@ -2065,12 +2195,24 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	 * So scavenge Remembered Set right away
 	 */
 	MM_ScavengerRootScanner rootScanner(env, this);
+	MM_PhaseTimeline *timeline = env->_phaseTimeline;
 
 	rootScanner.scavengeRememberedSet(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "remembered set");
+	}
 
 	rootScanner.scanRoots(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "roots");
+	}
 
-	if(completeScan(env)) {
+	bool scanCompleted = completeScan(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "copy scan");
+	}
+
+	if(scanCompleted) {
 		if (_rescanThreadsForRememberedObjects) {
 			rootScanner.rescanThreadSlots(env);
 			flushRememberedSet(env);
@@ -2078,6 +2220,9 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 		rootScanner.scanClearable(env);
 	}
 	rootScanner.flush(env);
+	if (NULL != timeline) {
+		timeline->phaseCompleted(env, "clearable");
+	}
 
 	addCopyCachesToFreeList(env);
 	abandonTLHRemainders(env);
@@ -2178,6 +2323,10 @@ MM_Scavenger::rememberObject(MM_EnvironmentStandard *env, omrobjectptr_t objectP
 		if(_extensions->objectModel.atomicSetRememberedState(objectPtr, STATE_REMEMBERED)) {
 			/* The object has been successfully marked as REMEMBERED - allocate an entry in the remembered set */
 			addToRememberedSetFragment(env, objectPtr);
+			if (NULL != _extensions->rememberedSetCards) {
+				/* The remembered set list is released at the end of the scavenge, the cards keep the object */
+				_extensions->rememberedSetCards->recordObject(env, objectPtr);
+			}
 		}
 	}
 }
@@ -3579,8 +3728,18 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 		_extensions->scavengerStats._endTime = omrtime_hires_clock();
 
 		if(scavengeCompletedSuccessfully(env)) {
-			/* Merge sublists in the remembered set (if necessary) */
-			_extensions->rememberedSet.compact(env);
+			if ((NULL != _extensions->rememberedSetCards) && !isRememberedSetInOverflowState()) {
+				/* Keep the remembered set in the cards until the next collection */
+				if (_isRememberedSetInOverflowAtTheBeginning) {
+					/* Pruning the overflow rebuilt the list from the remembered bits, and the drain cleaned the cards */
+					_extensions->rememberedSetCards->absorbRememberedSet(env, NULL);
+				} else {
+					_extensions->rememberedSetCards->releaseRememberedSet(env);
+				}
+			} else {
+				/* Merge sublists in the remembered set (if necessary) */
+				_extensions->rememberedSet.compact(env);
+			}
 
 			/* If -Xgc:fvtest=forcePoisonEvacuate has been specified, poison(fill poison pattern) evacuate space */
 			if(_extensions->fvtest_forcePoisonEvacuate) {
@@ -3593,7 +3752,8 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 			/* Defer to collector language interface */
 			_cli->scavenger_masterThreadGarbageCollect_scavengeSuccess(env);
 
-			if(_extensions->scvTenureStrategyAdaptive) {
+			/* When a pause target is set the tenure age is adjusted by the nursery pause target controller instead */
+			if(_extensions->scvTenureStrategyAdaptive && !_extensions->isScavengerPauseTargetEnabled()) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize = _activeSubSpace->getActiveMemorySize();
 				uintptr_t newSpaceConsumedSize = newSpaceTotalSize - _activeSubSpace->getActualActiveFreeMemorySize();
@@ -4136,6 +4296,21 @@ MM_Scavenger::globalCollectionComplete(MM_EnvironmentBase *env)
 	_extensions->scavengerStats._nextScavengeWillPercolate = false;
 	setFailedTenureLargestObject(0);
 	_countSinceForcingGlobalGC = 0;
+
+	MM_RememberedSetCards *rememberedSetCards = _extensions->rememberedSetCards;
+	if (NULL != rememberedSetCards) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+		MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+		if ((COMPACT_NONE != compactStats->_compactReason) && (COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason)) {
+			/* Remembered objects may have moved, only their remembered bits can be trusted */
+			setRememberedSetOverflowState();
+		}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+		if (!isRememberedSetInOverflowState()) {
+			/* The mark map is still valid, dead objects are dropped from the remembered set */
+			rememberedSetCards->absorbRememberedSet(MM_EnvironmentStandard::getEnvironment(env), _extensions->getGlobalCollector());
+		}
+	}
 }
 
 void
@@ -4277,7 +4452,10 @@ MM_Scavenger::calculateTenureMask()
 	if (_extensions->scvTenureStrategyFixed) {
 		newMask |= calculateTenureMaskUsingFixed(_extensions->scvTenureFixedTenureAge);
 	}
-	if (_extensions->scvTenureStrategyAdaptive) {
+	if (_extensions->scvTenureStrategyDecay) {
+		newMask |= calculateTenureMaskUsingFixed(calculateTenureAgeUsingDecay());
+	} else if (_extensions->scvTenureStrategyAdaptive) {
+		/* the Adaptive tenure age would bound the one chosen by the Decay strategy */
 		newMask |= calculateTenureMaskUsingFixed(_extensions->scvTenureAdaptiveTenureAge);
 	}
 	if (_extensions->scvTenureStrategyLookback) {
@@ -4444,6 +4622,89 @@ MM_Scavenger::calculateTenureMaskUsingFixed(uintptr_t tenureAge)
 	return mask;
 }
 
+uintptr_t
+MM_Scavenger::calculateTenureAgeUsingDecay()
+{
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	uintptr_t window = OMR_MIN(_extensions->scvTenureDecayWindow, SCAVENGER_FLIP_HISTORY_SIZE - 2);
+
+	/* The survival rate of an age is the share of the bytes flipped at that age which survived the following
+	 * scavenge (flipped or tenured at the next age), summed over the window. Skip the first row in the history
+	 * (it's the current scavenge, and is all zero right now).
+	 */
+	double survivalRate[OBJECT_HEADER_AGE_MAX + 1];
+	bool measured = false;
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; ++age) {
+		uintptr_t flippedBytes = 0;
+		uintptr_t survivedBytes = 0;
+		for (uintptr_t lookback = 1; lookback <= window; lookback++) {
+			MM_ScavengerStats::FlipHistory *previous = stats->getFlipHistory(lookback + 1);
+			MM_ScavengerStats::FlipHistory *current = stats->getFlipHistory(lookback);
+			flippedBytes += previous->_flipBytes[age];
+			survivedBytes += current->_flipBytes[age + 1] + current->_tenureBytes[age + 1];
+		}
+		if (0 != flippedBytes) {
+			survivalRate[age] = OMR_MIN(1.0, (double)survivedBytes / (double)flippedBytes);
+			measured = true;
+		} else if (0 != age) {
+			/* Ages which are tenured (or not reached) are not measured: assume the curve stays flat */
+			survivalRate[age] = survivalRate[age - 1];
+		} else {
+			/* nothing was allocated in the window: keep the last decision */
+			break;
+		}
+	}
+	if (!measured) {
+		return _extensions->scvTenureDecayTenureAge;
+	}
+
+	/* Follow a cohort of one allocated byte: liveBytes[age] is what is left of it when it is scavenged at that age */
+	double liveBytes[OBJECT_HEADER_AGE_MAX + 2];
+	liveBytes[0] = 1.0;
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; ++age) {
+		liveBytes[age + 1] = liveBytes[age] * survivalRate[age];
+	}
+
+	/* Tenuring at an age copies the cohort once per scavenge up to that age; the bytes tenured which would have
+	 * died before the maximum age is reached become tenure garbage.
+	 */
+	uintptr_t bestTenureAge = OBJECT_HEADER_AGE_MAX;
+	double bestCost = 0.0;
+	double bestCopyBytes = 0.0;
+	double bestGarbageBytes = 0.0;
+	double maximumAgeCopyBytes = 0.0;
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; ++age) {
+		maximumAgeCopyBytes += liveBytes[age + 1];
+	}
+	for (uintptr_t tenureAge = OBJECT_HEADER_AGE_MAX + 1; tenureAge-- > OBJECT_HEADER_AGE_MIN;) {
+		double copyBytes = 0.0;
+		for (uintptr_t age = 0; age <= tenureAge; ++age) {
+			copyBytes += liveBytes[age + 1];
+		}
+		double longLivedShare = 1.0;
+		for (uintptr_t age = tenureAge + 1; age <= OBJECT_HEADER_AGE_MAX; ++age) {
+			longLivedShare *= survivalRate[age];
+		}
+		double garbageBytes = liveBytes[tenureAge + 1] * (1.0 - longLivedShare);
+		double cost = copyBytes + (garbageBytes * SCAVENGER_DECAY_TENURE_GARBAGE_COST);
+		/* ties go to the older age, which promotes less */
+		if ((OBJECT_HEADER_AGE_MAX == tenureAge) || (cost < bestCost)) {
+			bestTenureAge = tenureAge;
+			bestCost = cost;
+			bestCopyBytes = copyBytes;
+			bestGarbageBytes = garbageBytes;
+		}
+	}
+
+	/* scale the cohort to the bytes allocated in the nursery since the previous scavenge */
+	double allocatedBytes = (double)stats->_semiSpaceAllocBytesAcumulation;
+	stats->_decayCopyBytesSaved = (uintptr_t)((maximumAgeCopyBytes - bestCopyBytes) * allocatedBytes);
+	stats->_decayTenureGarbageBytes = (uintptr_t)(bestGarbageBytes * allocatedBytes);
+	_extensions->scvTenureDecayTenureAge = bestTenureAge;
+
+	return bestTenureAge;
+}
+
 void 
 MM_Scavenger::resetTenureLargeAllocateStats(MM_EnvironmentBase *env)
 {
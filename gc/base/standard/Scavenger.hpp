@@ -107,6 +107,7 @@ private:
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
+	uintptr_t _hotFieldCopyPageSize; /**< The heap page size, used to measure the locality of hot fields copied depth-first */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
 	volatile uintptr_t _backOutDoneIndex; /**< snapshot of _doneIndex, when backOut was detected */
@@ -213,6 +214,13 @@ public:
 
 	MMINLINE omrobjectptr_t copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
+	/**
+	 * Copy the chain of hot children of a just copied object immediately after it (depth-first).
+	 * @param env current thread environment
+	 * @param objectPtr the object that has just been copied (new location)
+	 */
+	void depthCopyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -496,6 +504,18 @@ public:
 	 */
 	uintptr_t calculateTenureMaskUsingFixed(uintptr_t tenureAge);
 
+	/**
+	 * The implementation of the Decay scavenger tenure strategy.
+	 * The survival rate of each age is averaged over the last scvTenureDecayWindow
+	 * scavenges, giving the decay curve of an allocation cohort. The tenure age
+	 * is the one which minimizes the bytes the cohort is expected to have copied,
+	 * plus the bytes expected to die in the tenure space once tenured (weighted
+	 * by SCAVENGER_DECAY_TENURE_GARBAGE_COST). The chosen age and its expected
+	 * effect are recorded in the cycle scavenger stats.
+	 * @return The tenure age that objects should be tenured at.
+	 */
+	uintptr_t calculateTenureAgeUsingDecay();
+
 	/**
 	 * Calculates which generations should be tenured in the form of a bit mask.
 	 * @return mask of ages to tenure
@@ -680,6 +700,23 @@ public:
 	 */
 	void addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Record an object the write barrier has just flagged as remembered. With remembered set cards the
+	 * object goes to the store buffer of the thread, otherwise to its remembered set fragment.
+	 *
+	 * @param env[in] the mutator thread
+	 * @param objectPtr[in] the object to remember
+	 */
+	MMINLINE void
+	addToRememberedSetFromMutator(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+	{
+		if (NULL != _extensions->rememberedSetCards) {
+			env->addToRememberedSetBuffer(objectPtr);
+		} else {
+			addToRememberedSetFragment(env, objectPtr);
+		}
+	}
+
 	/**
 	 * Provide public (out-of-line) access to private (inline) copyAndForward(), copy() for client language
 	 * runtime. Slot holding reference will be updated with new address for referent on return.
@@ -763,6 +800,7 @@ public:
 		, _freeCacheMonitor(NULL)
 		, _waitingCount(0)
 		, _cacheLineAlignment(0)
+		, _hotFieldCopyPageSize(0)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
 #endif
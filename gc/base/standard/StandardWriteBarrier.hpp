@@ -26,6 +26,9 @@
 #include "objectdescription.h"
 
 #include "CardTable.hpp"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentEvacuator.hpp"
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
@@ -56,7 +59,7 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		if (extensions->isOld(parentObject) && !extensions->isOld(childObject)) {
 			if (extensions->objectModel.atomicSetRememberedState(parentObject, STATE_REMEMBERED)) {
 				/* The object has been successfully marked as REMEMBERED - allocate an entry in the remembered set */
-				extensions->scavenger->addToRememberedSetFragment((MM_EnvironmentStandard *)env, parentObject);
+				extensions->scavenger->addToRememberedSetFromMutator((MM_EnvironmentStandard *)env, parentObject);
 			}
 		}
 	}
@@ -88,4 +91,31 @@ standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject,
 	standardWriteBarrier(omrThread, parentObject, childObject);
 }
 
+/**
+ * Out-of-line read barrier. When concurrent evacuation is enabled, this method must be called whenever a
+ * child reference is loaded from a parent slot, so that the caller never observes the address of an object
+ * that has been (or is being) evacuated. The slot is healed in place and, as healing is a store, the
+ * write barrier is applied to the parent.
+ *
+ * @param omrThread The thread loading the child reference
+ * @param parentObject the parent object
+ * @param parentSlot Points to the slot in the parent object that holds the child reference
+ * @return the child object reference
+ */
+MMINLINE omrobjectptr_t
+standardReadBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot)
+{
+	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_ConcurrentEvacuator *evacuator = env->getExtensions()->concurrentEvacuator;
+	if ((NULL != evacuator) && evacuator->isInEvacuationArea(slotObject.readReferenceFromSlot())) {
+		omrobjectptr_t childObject = evacuator->fixupSlot(env, &slotObject);
+		standardWriteBarrier(omrThread, parentObject, childObject);
+		return childObject;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+	return slotObject.readReferenceFromSlot();
+}
+
 #endif /* STANDARDWRITEBARRIER_HPP_ */
@@ -28,6 +28,7 @@
  */
 
 #include "omr.h"
+#include "omragent.h"
 #include "objectdescription.h"
 #include "omrcomp.h"
 #include "j9nongenerated.h"
@@ -42,6 +43,12 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Copy the allocation sites ranked by -Xgc:allocationSamplingInterval= sampling (see OMR_TI GetAllocationSites()) */
+omr_error_t OMR_GC_GetAllocationSites(OMR_VMThread *omrVMThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, int32_t *totalCount);
+
+/* Stream the live object graph of the heap to a file, in the format of gc/base/standard/HeapSnapshotFormat.hpp (standard GC policies only) */
+omr_error_t OMR_GC_WriteHeapSnapshot(OMR_VMThread *omrVMThread, const char *fileName);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -25,9 +25,11 @@
 #include "objectdescription.h"
 
 #include "AllocateInitialization.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapSnapshotWriter.hpp"
 #include "omrgcstartup.hpp"
 
 omrobjectptr_t
@@ -67,3 +69,42 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_GetAllocationSites(OMR_VMThread *omrVMThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, int32_t *totalCount)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	if ((NULL == extensions) || (NULL == extensions->allocationSiteSampler)) {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		extensions->allocationSiteSampler->getSites(maxSites, sites, writtenCount, totalCount);
+	}
+	return result;
+}
+
+omr_error_t
+OMR_GC_WriteHeapSnapshot(OMR_VMThread *omrVMThread, const char *fileName)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (NULL == fileName) {
+		result = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if ((NULL == extensions->getGlobalCollector()) || !extensions->isStandardGC()) {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		MM_HeapSnapshotWriter *writer = MM_HeapSnapshotWriter::newInstance(env);
+		if (NULL == writer) {
+			result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else {
+			env->acquireExclusiveVMAccess();
+			if (!writer->writeSnapshot(env, fileName)) {
+				result = OMR_ERROR_INTERNAL;
+			}
+			env->releaseExclusiveVMAccess();
+			writer->kill(env);
+		}
+	}
+	return result;
+}
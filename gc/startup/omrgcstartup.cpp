@@ -26,6 +26,7 @@
 #include "objectdescription.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
@@ -162,6 +163,15 @@ heapCreationHelper(OMR_VM *omrVM, MM_StartupManager *startupManager, bool create
 		goto done;
 	}
 
+	if (0 != extensions->allocationSamplingInterval) {
+		extensions->allocationSiteSampler = MM_AllocationSiteSampler::newInstance(&envBase, extensions->allocationSamplingTopSites);
+		if (NULL == extensions->allocationSiteSampler) {
+			omrtty_printf("Failed to create allocation site sampler.\n");
+			rc = OMR_ERROR_INTERNAL;
+			goto done;
+		}
+	}
+
 	if (createCollector && (OMR_ERROR_NONE != collectorCreationHelper(omrVM, &envBase))) {
 		rc = OMR_ERROR_INTERNAL;
 		goto done;
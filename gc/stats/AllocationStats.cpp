@@ -29,11 +29,15 @@ MM_AllocationStats::clear()
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	_tlhRefreshCountFresh = 0;
 	_tlhRefreshCountReused = 0;
+	_tlhRefreshCountPreZeroed = 0;
 	_tlhAllocatedFresh = 0;
 	_tlhAllocatedReused = 0;
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhWastedBytes = 0;
+	_tlhRefreshSizeIncreases = 0;
+	_tlhRefreshSizeDecreases = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -43,6 +47,8 @@ MM_AllocationStats::clear()
 
 	_allocationCount = 0;
 	_allocationBytes = 0;
+	_quickListAllocationCount = 0;
+	_loaReservationAllocationCount = 0;
 	_ownableSynchronizerObjectCount = 0;
 	_discardedBytes = 0;
 	_allocationSearchCount = 0;
@@ -55,10 +61,14 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	MM_AtomicOperations::add(&_tlhRefreshCountFresh, stats->_tlhRefreshCountFresh);
 	MM_AtomicOperations::add(&_tlhRefreshCountReused, stats->_tlhRefreshCountReused);
+	MM_AtomicOperations::add(&_tlhRefreshCountPreZeroed, stats->_tlhRefreshCountPreZeroed);
 	MM_AtomicOperations::add(&_tlhAllocatedFresh, stats->_tlhAllocatedFresh);
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhWastedBytes, stats->_tlhWastedBytes);
+	MM_AtomicOperations::add(&_tlhRefreshSizeIncreases, stats->_tlhRefreshSizeIncreases);
+	MM_AtomicOperations::add(&_tlhRefreshSizeDecreases, stats->_tlhRefreshSizeDecreases);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -76,6 +86,8 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 
 	MM_AtomicOperations::add(&_allocationCount, stats->_allocationCount);
 	MM_AtomicOperations::add(&_allocationBytes, stats->_allocationBytes);
+	MM_AtomicOperations::add(&_quickListAllocationCount, stats->_quickListAllocationCount);
+	MM_AtomicOperations::add(&_loaReservationAllocationCount, stats->_loaReservationAllocationCount);
 	MM_AtomicOperations::add(&_ownableSynchronizerObjectCount, stats->_ownableSynchronizerObjectCount);
 	MM_AtomicOperations::add(&_discardedBytes, stats->_discardedBytes);
 	MM_AtomicOperations::add(&_allocationSearchCount, stats->_allocationSearchCount);
@@ -36,11 +36,15 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t _tlhRefreshCountFresh; /**< Number of refreshes where fresh memory was allocated. */
 	uintptr_t _tlhRefreshCountReused; /**< Number of refreshes where TLHs were reused. */
+	uintptr_t _tlhRefreshCountPreZeroed; /**< Number of fresh refreshes whose memory had already been zeroed by the memory maintenance thread. */
 	uintptr_t _tlhAllocatedFresh; /**< The amount of memory allocated fresh out of the heap. */
 	uintptr_t _tlhAllocatedReused; /**< The amount of memory allocated form reused TLHs. */
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhWastedBytes; /**< The amount of unused memory left in TLHs that were returned to the heap instead of being cached for reuse. */
+	uintptr_t _tlhRefreshSizeIncreases; /**< Number of times adaptive sizing grew a thread's TLH refresh size. */
+	uintptr_t _tlhRefreshSizeDecreases; /**< Number of times adaptive sizing shrank a thread's TLH refresh size. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -50,6 +54,8 @@ public:
 
 	uintptr_t _allocationCount;
 	uintptr_t _allocationBytes;
+	uintptr_t _quickListAllocationCount; /**< Number of allocations satisfied from memory pool quick-lists, without taking the pool lock */
+	uintptr_t _loaReservationAllocationCount; /**< Number of allocations satisfied from thread large object area reservations, without taking the pool lock */
 	uintptr_t _ownableSynchronizerObjectCount;  /**< Number of Ownable Synchronizer Object allocations */
 	uintptr_t _discardedBytes;
 	uintptr_t _allocationSearchCount;
@@ -62,6 +68,7 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
+	uintptr_t tlhRefreshCount() { return _tlhRefreshCountFresh + _tlhRefreshCountReused; }
 #endif
 
 	uintptr_t bytesAllocated(){
@@ -83,11 +90,15 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 		_tlhRefreshCountFresh(0),
 		_tlhRefreshCountReused(0),
+		_tlhRefreshCountPreZeroed(0),
 		_tlhAllocatedFresh(0),
 		_tlhAllocatedReused(0),
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhWastedBytes(0),
+		_tlhRefreshSizeIncreases(0),
+		_tlhRefreshSizeDecreases(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
 		_arrayletLeafAllocationCount(0),
@@ -95,6 +106,8 @@ public:
 #endif
 		_allocationCount(0),
 		_allocationBytes(0),
+		_quickListAllocationCount(0),
+		_loaReservationAllocationCount(0),
 		_ownableSynchronizerObjectCount(0),
 		_discardedBytes(0),
 		_allocationSearchCount(0),
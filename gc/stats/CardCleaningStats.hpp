@@ -34,6 +34,7 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardsScanned; /**< The number of cards examined while looking for cards to clean, clean or not */
 	
 /* Function Members */
 public:
@@ -49,6 +50,19 @@ public:
 	 * @param endTime The time scanning ended, measured by omrtime_hires_clock()
 	 */
 	MMINLINE void addToCardCleaningTime(uint64_t startTime, uint64_t endTime) { _cardCleaningTime += (endTime - startTime);	}
+
+	/**
+	 * Card scanning throughput over the time attributed to card cleaning.
+	 * @param hiresFrequency The frequency of omrtime_hires_clock(), from omrtime_hires_frequency()
+	 * @return The number of cards scanned per millisecond of card cleaning time, or 0 if no time was recorded
+	 */
+	MMINLINE uint64_t
+	getCardsScannedPerMillisecond(uint64_t hiresFrequency)
+	{
+		/* cards / (ticks / ticks per millisecond) */
+		uint64_t scaledCleaningTime = _cardCleaningTime * 1000;
+		return (0 == scaledCleaningTime) ? 0 : (((uint64_t)_cardsScanned * hiresFrequency) / scaledCleaningTime);
+	}
 	
 	/**
 	 * Merges the results from the input MM_CardCleaningStats with the statistics contained within the receiver.
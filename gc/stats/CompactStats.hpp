@@ -50,6 +50,8 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _summaryChunks; /**< number of summary table chunks (0 if the summary table was not used) */
+	uintptr_t _summaryChunkWaits; /**< number of times a chunk had to wait for the chunks overlapping its destination to be moved */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
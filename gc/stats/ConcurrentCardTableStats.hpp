@@ -28,6 +28,7 @@
 
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
+#include "CardCleaningStats.hpp"
 
 #define HIGH_VALUES (uintptr_t)(-1)
 /**
@@ -49,6 +50,8 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	MM_CardCleaningStats _finalCardCleaningStats; /**< Card scanning totals of all threads doing final card cleaning */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +78,7 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+		_finalCardCleaningStats.clear();
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -119,6 +123,19 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
 	
+	MMINLINE MM_CardCleaningStats *getFinalCardCleaningStats() { return &_finalCardCleaningStats; };
+
+	/**
+	 * Add a final card cleaning thread's card scanning statistics to the totals.
+	 * @param threadStats the card cleaning statistics of the thread
+	 */
+	MMINLINE void mergeFinalCardCleaningStats(MM_CardCleaningStats *threadStats)
+	{
+		MM_AtomicOperations::addU64(&_finalCardCleaningStats._cardCleaningTime, threadStats->_cardCleaningTime);
+		incrementCount(_finalCardCleaningStats._cardsCleaned, threadStats->_cardsCleaned);
+		incrementCount(_finalCardCleaningStats._cardsScanned, threadStats->_cardsScanned);
+	};
+
 	/**
 	 * Create a CardTableStats object.
 	 */   
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(CONCURRENTEVACUATIONSTATS_HPP_)
+#define CONCURRENTEVACUATIONSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+/**
+ * Storage for statistics relevant to one concurrent evacuation set, from its selection at the end of
+ * a global collection to its release at the end of marking in the following global collection.
+ * Counters are updated atomically by mutators, concurrent helpers and GC threads.
+ * @ingroup GC_Stats
+ */
+class MM_ConcurrentEvacuationStats
+{
+public:
+	uintptr_t _areasSelected; /**< number of areas selected for evacuation */
+	volatile uintptr_t _areasAborted; /**< number of selected areas in which evacuation was abandoned */
+	uintptr_t _bytesSelected; /**< live bytes in the selected areas at selection time */
+	volatile uintptr_t _objectsEvacuated; /**< number of objects copied out of the selected areas */
+	volatile uintptr_t _bytesEvacuated; /**< number of bytes copied out of the selected areas */
+	volatile uintptr_t _objectsPinned; /**< number of objects left in place (remembered, copy failure or final collection reached) */
+	volatile uintptr_t _bytesDiscarded; /**< bytes of copies abandoned after losing an evacuation race */
+
+	void clear()
+	{
+		_areasSelected = 0;
+		_areasAborted = 0;
+		_bytesSelected = 0;
+		_objectsEvacuated = 0;
+		_bytesEvacuated = 0;
+		_objectsPinned = 0;
+		_bytesDiscarded = 0;
+	}
+
+	MMINLINE void
+	addToEvacuated(uintptr_t objectSize)
+	{
+		MM_AtomicOperations::add(&_objectsEvacuated, 1);
+		MM_AtomicOperations::add(&_bytesEvacuated, objectSize);
+	}
+
+	MM_ConcurrentEvacuationStats()
+		: _areasSelected(0)
+		, _areasAborted(0)
+		, _bytesSelected(0)
+		, _objectsEvacuated(0)
+		, _bytesEvacuated(0)
+		, _objectsPinned(0)
+		, _bytesDiscarded(0)
+	{}
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#endif /* CONCURRENTEVACUATIONSTATS_HPP_ */
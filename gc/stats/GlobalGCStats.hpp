@@ -27,6 +27,9 @@
 #include "modronbase.h"
 
 #include "ClassUnloadStats.hpp"
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentEvacuationStats.hpp"
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "CompactStats.hpp"
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -47,6 +50,9 @@ public:
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactStats compactStats;
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	MM_ConcurrentEvacuationStats concurrentEvacuationStats; /**< Stats of the evacuation set released during this cycle */
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 	uintptr_t fixHeapForWalkReason;
 	uint64_t fixHeapForWalkTime;
@@ -66,6 +72,9 @@ public:
 #if defined(OMR_GC_MODRON_COMPACTION)
 		compactStats.clear();
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		concurrentEvacuationStats.clear();
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 		fixHeapForWalkReason = FIXUP_NONE;
 		fixHeapForWalkTime = 0;
@@ -84,6 +93,9 @@ public:
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, compactStats()
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		, concurrentEvacuationStats()
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 		, fixHeapForWalkReason(FIXUP_NONE)
 		, fixHeapForWalkTime(0)
 		, markStats()
@@ -649,7 +649,7 @@ MM_LargeObjectAllocateStats::resetAverage()
 }
 
 void
-MM_LargeObjectAllocateStats::allocateObject(uintptr_t allocateSize)
+MM_LargeObjectAllocateStats::allocateObject(uintptr_t allocateSize, uintptr_t count)
 {
 	/* update stats only for large enough objects */
 	if (allocateSize >= _largeObjectThreshold) {
@@ -658,11 +658,11 @@ MM_LargeObjectAllocateStats::allocateObject(uintptr_t allocateSize)
 		 * we want to put more weight on larger objects so we do not increment stats by 1,
 		 * but by the allocation size itself
 		 */
-		spaceSavingUpdate(_spaceSavingSizes, (void *)allocateSize, allocateSize);
+		spaceSavingUpdate(_spaceSavingSizes, (void *)allocateSize, allocateSize * count);
 
 		/* find in which size class object belongs to and update the stats for the size class itself. */
 		uintptr_t sizeClass = (uintptr_t)(pow(_sizeClassRatio, (float)ceil(log((float)allocateSize) / _sizeClassRatioLog)));
-		spaceSavingUpdate(_spaceSavingSizeClasses, (void *)sizeClass, sizeClass);
+		spaceSavingUpdate(_spaceSavingSizeClasses, (void *)sizeClass, sizeClass * count);
 	}
 }
 
@@ -233,7 +233,14 @@ public:
 	 * We increment counter for appropriate size or with some probability introduce a new size in the stats
 	 * @param allocateSize size that was just allocated
 	 */
-	void allocateObject(uintptr_t allocateSize);
+	void allocateObject(uintptr_t allocateSize) { allocateObject(allocateSize, 1); }
+
+	/**
+	 * Notify about a number of successful allocations of the same size, as if allocateObject() was invoked for each of them.
+	 * @param allocateSize size that was allocated
+	 * @param count number of allocations
+	 */
+	void allocateObject(uintptr_t allocateSize, uintptr_t count);
 
 	/**
 	 * Merge CURRENT this/these stats with provided stats. The result is stored back into this stats
@@ -35,6 +35,9 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_remoteStealCount = 0;
+	_markMapCacheFlushes = 0;
+	_markMapCacheBits = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -50,6 +53,9 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_remoteStealCount += statsToMerge->_remoteStealCount;
+	_markMapCacheFlushes += statsToMerge->_markMapCacheFlushes;
+	_markMapCacheBits += statsToMerge->_markMapCacheBits;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
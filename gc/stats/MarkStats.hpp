@@ -48,6 +48,9 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _remoteStealCount; /**< The number of work packets taken from the lists of a NUMA node other than the owning thread's (or globally) during marking */
+	uintptr_t _markMapCacheFlushes; /**< The number of atomic mark map updates made to publish bits from the mark map cache */
+	uintptr_t _markMapCacheBits; /**< The number of mark bits published from the mark map cache, including bits another thread set first */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -108,6 +111,9 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_remoteStealCount(0)
+		,_markMapCacheFlushes(0)
+		,_markMapCacheBits(0)
 		,_startTime(0)
 		,_endTime(0)
 	{
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "omrport.h"
+
+#include "PhaseTimeline.hpp"
+
+#include "EnvironmentBase.hpp"
+
+bool
+MM_PhaseTimeline::initialize(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	_events = (Event *)env->getForge()->allocate(capacity * sizeof(Event), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _events) {
+		return false;
+	}
+	_capacity = capacity;
+	reset();
+
+	return true;
+}
+
+void
+MM_PhaseTimeline::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _events) {
+		env->getForge()->free(_events);
+		_events = NULL;
+	}
+	_capacity = 0;
+}
+
+void
+MM_PhaseTimeline::reset()
+{
+	_count = 0;
+	_droppedCount = 0;
+	for (uintptr_t type = 0; type < event_type_count; type++) {
+		_totalTime[type] = 0;
+	}
+}
+
+void
+MM_PhaseTimeline::taskStarted(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	_taskStartTime = omrtime_hires_clock();
+	_phaseStartTime = _taskStartTime;
+}
+
+void
+MM_PhaseTimeline::taskCompleted(MM_EnvironmentBase *env, const char *name)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	record(event_task, name, _taskStartTime, omrtime_hires_clock());
+}
+
+void
+MM_PhaseTimeline::phaseCompleted(MM_EnvironmentBase *env, const char *name)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t endTime = omrtime_hires_clock();
+	record(event_phase, name, _phaseStartTime, endTime);
+	_phaseStartTime = endTime;
+}
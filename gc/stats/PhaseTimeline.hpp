@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(PHASETIMELINE_HPP_)
+#define PHASETIMELINE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Timestamped record of the tasks and phases one GC thread went through, and of the time it spent stalled,
+ * since the timeline was last reset. Events are stored in a fixed size array, so recording one costs a few
+ * stores; events which do not fit are only counted, but the per type totals always include them.
+ * @ingroup GC_Stats
+ */
+class MM_PhaseTimeline : public MM_Base
+{
+/* data members */
+public:
+	typedef enum EventType {
+		event_task = 0, /**< a task, from its acceptance by the thread to its completion */
+		event_phase, /**< a phase of a task */
+		event_sync_stall, /**< waiting for the other threads at a synchronization point */
+		event_work_stall, /**< waiting for work to be shared by the other threads */
+		event_complete_stall, /**< waiting for the other threads to run out of work */
+		event_type_count
+	} EventType;
+
+	typedef struct Event {
+		const char *name; /**< static string naming the task, phase or synchronization point */
+		uint64_t startTime; /**< start of the event, in hi-res ticks */
+		uint64_t endTime; /**< end of the event, in hi-res ticks */
+		uintptr_t type; /**< the EventType of the event */
+	} Event;
+
+private:
+	Event *_events; /**< recorded events, in the order they ended */
+	uintptr_t _capacity; /**< number of entries in _events */
+	uintptr_t _count; /**< number of events recorded since the last reset */
+	uintptr_t _droppedCount; /**< number of events which did not fit in _events since the last reset */
+	uint64_t _totalTime[event_type_count]; /**< time, in hi-res ticks, of the events of each type since the last reset */
+	uint64_t _taskStartTime; /**< start of the task the thread is running */
+	uint64_t _phaseStartTime; /**< start of the phase the thread is running */
+
+/* function members */
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget all recorded events and totals.
+	 */
+	void reset();
+
+	/**
+	 * Record an event which has ended.
+	 * @param type the EventType of the event
+	 * @param name static string naming the event
+	 * @param startTime start of the event, in hi-res ticks
+	 * @param endTime end of the event, in hi-res ticks
+	 */
+	MMINLINE void
+	record(uintptr_t type, const char *name, uint64_t startTime, uint64_t endTime)
+	{
+		_totalTime[type] += (endTime - startTime);
+		if (_count < _capacity) {
+			Event *event = &_events[_count];
+			event->name = name;
+			event->startTime = startTime;
+			event->endTime = endTime;
+			event->type = type;
+			_count += 1;
+		} else {
+			_droppedCount += 1;
+		}
+	}
+
+	/**
+	 * Note the start of a task, which is also the start of its first phase.
+	 */
+	void taskStarted(MM_EnvironmentBase *env);
+
+	/**
+	 * Record the task started by the last call to taskStarted().
+	 * @param name the name of the task
+	 */
+	void taskCompleted(MM_EnvironmentBase *env, const char *name);
+
+	/**
+	 * Record the phase which ended now. The next phase of the task starts at the same time.
+	 * @param name the name of the phase
+	 */
+	void phaseCompleted(MM_EnvironmentBase *env, const char *name);
+
+	MMINLINE uintptr_t getCount() { return _count; }
+	MMINLINE uintptr_t getDroppedCount() { return _droppedCount; }
+	MMINLINE Event *getEvent(uintptr_t index) { return &_events[index]; }
+	MMINLINE uint64_t getTotalTime(uintptr_t type) { return _totalTime[type]; }
+
+	/**
+	 * @return the time, in hi-res ticks, spent stalled since the last reset
+	 */
+	MMINLINE uint64_t
+	getStallTime()
+	{
+		return _totalTime[event_sync_stall] + _totalTime[event_work_stall] + _totalTime[event_complete_stall];
+	}
+
+	MM_PhaseTimeline() :
+		MM_Base()
+		,_events(NULL)
+		,_capacity(0)
+		,_count(0)
+		,_droppedCount(0)
+		,_taskStartTime(0)
+		,_phaseStartTime(0)
+	{
+		reset();
+	}
+};
+
+#endif /* PHASETIMELINE_HPP_ */
@@ -87,6 +87,12 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
+	,_hotFieldCopyCount(0)
+	,_hotFieldCopyBytes(0)
+	,_hotFieldCopySameCacheLineCount(0)
+	,_hotFieldCopySamePageCount(0)
+	,_decayCopyBytesSaved(0)
+	,_decayTenureGarbageBytes(0)
 
 	,_flipHistoryNewIndex(0)
 {
@@ -181,6 +187,12 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_slotsCopied = 0;
 	_slotsScanned = 0;
+	_hotFieldCopyCount = 0;
+	_hotFieldCopyBytes = 0;
+	_hotFieldCopySameCacheLineCount = 0;
+	_hotFieldCopySamePageCount = 0;
+	_decayCopyBytesSaved = 0;
+	_decayTenureGarbageBytes = 0;
 	_leafObjectCount = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
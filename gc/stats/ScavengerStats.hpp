@@ -136,6 +136,14 @@ public:
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 
+	uintptr_t _hotFieldCopyCount; /**< The number of hot children copied depth-first right after their parent */
+	uintptr_t _hotFieldCopyBytes; /**< The number of bytes copied depth-first as hot children */
+	uintptr_t _hotFieldCopySameCacheLineCount; /**< The number of hot children copied into the same cache line as their parent */
+	uintptr_t _hotFieldCopySamePageCount; /**< The number of hot children copied into the same page as their parent */
+
+	uintptr_t _decayCopyBytesSaved; /**< The bytes per scavenge the Decay tenure strategy expects to save from being copied again, by tenuring at its chosen age rather than the maximum one */
+	uintptr_t _decayTenureGarbageBytes; /**< The bytes per scavenge the Decay tenure strategy expects to tenure which will die before the maximum tenure age */
+
 
 protected:
 
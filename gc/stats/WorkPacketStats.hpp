@@ -47,6 +47,8 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t dequeElementsStolen; /**< The number of elements taken from the work stealing deques of other threads */
+	uintptr_t dequeElementsShared; /**< The number of elements moved from a work stealing deque into packets for threads waiting for work */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -73,6 +75,8 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		dequeElementsStolen = 0;
+		dequeElementsShared = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +95,8 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		dequeElementsStolen += statsToMerge->dequeElementsStolen;
+		dequeElementsShared += statsToMerge->dequeElementsShared;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +153,8 @@ public:
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,dequeElementsStolen(0)
+		,dequeElementsShared(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
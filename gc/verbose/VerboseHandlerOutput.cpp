@@ -26,9 +26,12 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MemoryManager.hpp"
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "PhaseTimelineRecorder.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -687,11 +690,18 @@ MM_VerboseHandlerOutput::outputMemoryInfo(MM_EnvironmentBase *env, uintptr_t ind
 	uintptr_t freeMemory = stats->_totalFreeHeapSize;
 	uintptr_t totalMemory = stats->_totalHeapSize;
 
-	if (hasOutputMemoryInfoInnerStanza()) {
+	bool reportHugePages = (MM_GCExtensionsBase::HEAP_HUGE_PAGES_NONE != _extensions->heapHugePages);
+
+	if (hasOutputMemoryInfoInnerStanza() || reportHugePages) {
 		writer->formatAndOutput(env, indent, "<mem-info id=\"%zu\" free=\"%zu\" total=\"%zu\" percent=\"%zu\">",
 				_manager->getIdAndIncrement(), freeMemory, totalMemory,
 				((totalMemory == 0) ? 0 : ((uintptr_t)(((uint64_t)freeMemory*100) / (uint64_t)totalMemory))));
-		outputMemoryInfoInnerStanza(env, indent + 1, stats);
+		if (hasOutputMemoryInfoInnerStanza()) {
+			outputMemoryInfoInnerStanza(env, indent + 1, stats);
+		}
+		if (reportHugePages) {
+			outputHugePagesInfo(env, indent + 1);
+		}
 		writer->formatAndOutput(env, indent, "</mem-info>");
 	} else {
 		writer->formatAndOutput(env, indent, "<mem-info id=\"%zu\" free=\"%zu\" total=\"%zu\" percent=\"%zu\" />",
@@ -712,6 +722,76 @@ MM_VerboseHandlerOutput::outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, ui
 {
 }
 
+void
+MM_VerboseHandlerOutput::outputHugePagesInfo(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uintptr_t hugePageSize = _extensions->heapHugePageSize;
+	uintptr_t backedBytes = _extensions->heap->getHugePageBackedSize();
+
+	writer->formatAndOutput(env, indent, "<huge-pages pageSize=\"%zu\" pages=\"%zu\" backedBytes=\"%zu\" />",
+			hugePageSize, backedBytes / hugePageSize, backedBytes);
+}
+
+void
+MM_VerboseHandlerOutput::outputPhaseTimelines(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_PhaseTimelineRecorder *recorder = _extensions->dispatcher->getPhaseTimelineRecorder();
+	if (NULL == recorder) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uintptr_t threadCount = 0;
+	uintptr_t droppedCount = 0;
+	uint64_t totalBusyTime = 0;
+	uint64_t totalStallTime = 0;
+	uint64_t maximumWorkTime = 0;
+
+	for (uintptr_t slaveID = 0; slaveID < recorder->getTimelineCount(); slaveID++) {
+		MM_PhaseTimeline *timeline = recorder->getTimeline(slaveID);
+		uint64_t busyTime = timeline->getTotalTime(MM_PhaseTimeline::event_task);
+		if (0 != busyTime) {
+			uint64_t stallTime = OMR_MIN(timeline->getStallTime(), busyTime);
+			threadCount += 1;
+			droppedCount += timeline->getDroppedCount();
+			totalBusyTime += busyTime;
+			totalStallTime += stallTime;
+			maximumWorkTime = OMR_MAX(maximumWorkTime, busyTime - stallTime);
+		}
+	}
+
+	if (0 == threadCount) {
+		return;
+	}
+
+	/* the imbalance is how far the average thread's useful work falls short of the busiest thread's */
+	uint64_t totalWorkTime = totalBusyTime - totalStallTime;
+	uintptr_t imbalancePercent = 0;
+	if (0 != maximumWorkTime) {
+		imbalancePercent = (uintptr_t)(((maximumWorkTime * threadCount) - totalWorkTime) * 100 / (maximumWorkTime * threadCount));
+	}
+	uintptr_t stallPercent = (uintptr_t)(totalStallTime * 100 / totalBusyTime);
+	uint64_t busyMicros = omrtime_hires_delta(0, totalBusyTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	writer->formatAndOutput(env, indent, "<gc-threads count=\"%zu\" busyms=\"%llu.%03.3llu\" stall=\"%zu\" imbalance=\"%zu\" dropped=\"%zu\">",
+			threadCount, busyMicros / 1000, busyMicros % 1000, stallPercent, imbalancePercent, droppedCount);
+	for (uintptr_t slaveID = 0; slaveID < recorder->getTimelineCount(); slaveID++) {
+		MM_PhaseTimeline *timeline = recorder->getTimeline(slaveID);
+		if (0 != timeline->getTotalTime(MM_PhaseTimeline::event_task)) {
+			uint64_t threadBusyMicros = omrtime_hires_delta(0, timeline->getTotalTime(MM_PhaseTimeline::event_task), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t syncStallMicros = omrtime_hires_delta(0, timeline->getTotalTime(MM_PhaseTimeline::event_sync_stall), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t workStallMicros = omrtime_hires_delta(0, timeline->getTotalTime(MM_PhaseTimeline::event_work_stall), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t completeStallMicros = omrtime_hires_delta(0, timeline->getTotalTime(MM_PhaseTimeline::event_complete_stall), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			writer->formatAndOutput(env, indent + 1, "<gc-thread id=\"%zu\" busyms=\"%llu.%03.3llu\" syncstallms=\"%llu.%03.3llu\" workstallms=\"%llu.%03.3llu\" completestallms=\"%llu.%03.3llu\" />",
+					slaveID, threadBusyMicros / 1000, threadBusyMicros % 1000, syncStallMicros / 1000, syncStallMicros % 1000,
+					workStallMicros / 1000, workStallMicros % 1000, completeStallMicros / 1000, completeStallMicros % 1000);
+		}
+	}
+	writer->formatAndOutput(env, indent, "</gc-threads>");
+}
+
 void
 MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 {
@@ -732,6 +812,24 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		writer->formatAndOutput(env, 1, "<tlh-refresh count=\"%zu\" wastedBytes=\"%zu\" sizeIncreases=\"%zu\" sizeDecreases=\"%zu\" />",
+				systemStats->tlhRefreshCount(), systemStats->_tlhWastedBytes, systemStats->_tlhRefreshSizeIncreases, systemStats->_tlhRefreshSizeDecreases);
+		bool quickLists = _extensions->freeEntryQuickLists;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		quickLists = quickLists || _extensions->loaSizeBands;
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+		if (quickLists) {
+			writer->formatAndOutput(env, 1, "<quick-list-allocations count=\"%zu\" non-tlh-count=\"%zu\" />", systemStats->_quickListAllocationCount, systemStats->_allocationCount);
+		}
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		if (0 != _extensions->loaReservationCount) {
+			writer->formatAndOutput(env, 1, "<loa-reservation-allocations count=\"%zu\" non-tlh-count=\"%zu\" />", systemStats->_loaReservationAllocationCount, systemStats->_allocationCount);
+		}
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+		if (_extensions->memoryMaintenance) {
+			writer->formatAndOutput(env, 1, "<memory-maintenance tlhPreZeroed=\"%zu\" bytesZeroed=\"%zu\" bytesDecommitted=\"%zu\" />",
+					systemStats->_tlhRefreshCountPreZeroed, _extensions->memoryManager->getBytesPreZeroed(), _extensions->memoryManager->getBytesDecommittedInBackground());
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -804,14 +902,21 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 								durationInMicroseconds, userTimeInMicroseconds, systemTimeInMicroseconds,
 								omrtime_current_time_millis());
 								
-	uintptr_t activeThreads = env->getExtensions()->dispatcher->activeThreadCount();
+	/* tasks may be dispatched to fewer threads than are available when they expect little work */
+	MM_Dispatcher *dispatcher = env->getExtensions()->dispatcher;
+	uintptr_t activeThreads = dispatcher->cycleThreadCount();
+	if (0 == activeThreads) {
+		activeThreads = dispatcher->activeThreadCount();
+	}
+	uintptr_t availableThreads = dispatcher->threadCount();
 
 	enterAtomicReportingBlock();
 	if (!getDurationTimeSuccessful || !getUserTimeSuccessful || !getSystemTimeSuccessful) {
 		writer->formatAndOutput(env, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
 	}
-	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
+	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\" availableThreads=\"%zu\">", tagTemplate, activeThreads, availableThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	outputPhaseTimelines(env, _manager->getIndentLevel() + 1);
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
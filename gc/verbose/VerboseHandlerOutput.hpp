@@ -196,6 +196,22 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output the huge page backing of the heap, as reported by the port library, within a memory info stanza.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the stanza.
+	 */
+	void outputHugePagesInfo(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output how the GC threads spent the collection, as recorded in their phase timelines: the time each thread
+	 * was busy running tasks and stalled, the share of stalled time and the load imbalance between the threads.
+	 * Nothing is output unless -Xgc:gcPhaseTimeline is enabled.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the stanza.
+	 */
+	void outputPhaseTimelines(MM_EnvironmentBase *env, uintptr_t indent);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
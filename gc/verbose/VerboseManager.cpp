@@ -35,6 +35,7 @@
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
+#include "VerboseWriterFileLoggingRingBuffer.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
 
@@ -235,6 +236,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (0 != extensions->verboseRingBufferSize) {
+		return VERBOSE_WRITER_FILE_LOGGING_RING_BUFFER;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -315,6 +320,18 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_RING_BUFFER:
+		writer = MM_VerboseWriterFileLoggingRingBuffer::newInstance(env, this, filename, env->getExtensions()->verboseRingBufferSize);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(VERBOSERINGBUFFERFORMAT_HPP_)
+#define VERBOSERINGBUFFERFORMAT_HPP_
+
+#include "omrcomp.h"
+
+/*
+ * Layout of the binary verbose GC file written by MM_VerboseWriterFileLoggingRingBuffer, shared with the
+ * offline decoder (perftest/gctest) which converts it back to the XML described by schema.xsd.
+ *
+ * The file is made of four areas, at the offsets recorded in VerboseRingBufferHeader:
+ * - the header;
+ * - the XML header and footer text (as written around the records by the text writers);
+ * - the format table: one VerboseRingBufferFormat per distinct format string passed to the writer chain,
+ *   numbered from 0 in order, each followed by its argument types and the NUL terminated format string;
+ * - the ring: VerboseRingBufferRecord entries, each followed by its arguments, in the order they were output.
+ *
+ * Ring positions are monotonic byte counts, taken modulo the ring size to find the record. Records never wrap
+ * around the end of the ring (a padding record fills the end instead), and all of the records between tail and head
+ * are complete. The tail is moved past the oldest records before they are overwritten, so a reader running
+ * alongside the writer must discard anything it read below the tail it finds once it is done.
+ */
+
+#define VERBOSE_RING_BUFFER_MAGIC 0x4252564F /* "OVRB" */
+#define VERBOSE_RING_BUFFER_VERSION 1
+/* All areas, format table entries and arguments are aligned to this number of bytes. */
+#define VERBOSE_RING_BUFFER_ALIGNMENT 8
+/* Records and the ring size are aligned to the size of a record header, so a padding record always fits at the end of the ring. */
+#define VERBOSE_RING_BUFFER_RECORD_ALIGNMENT 16
+/* Size of the area holding the XML header and footer text. */
+#define VERBOSE_RING_BUFFER_TEXT_SIZE 1024
+/* Size of the format table; once it is full, lines with new formats are written as text records. */
+#define VERBOSE_RING_BUFFER_FORMAT_TABLE_SIZE (64 * 1024)
+/* The smallest ring accepted (smaller sizes are rounded up, as are sizes which are not a multiple of the record alignment). */
+#define VERBOSE_RING_BUFFER_MINIMUM_SIZE (64 * 1024)
+/* Formats with more conversions than this are written as text records. */
+#define VERBOSE_RING_BUFFER_MAX_ARGUMENTS 32
+/* String argument length marking a NULL string. */
+#define VERBOSE_RING_BUFFER_NULL_STRING ((uint32_t)-1)
+
+typedef enum VerboseRingBufferRecordType {
+	VERBOSE_RING_BUFFER_RECORD_PAD = 0, /**< Unused space up to the end of the ring */
+	VERBOSE_RING_BUFFER_RECORD_FORMATTED = 1, /**< A line given as a format table entry and its arguments */
+	VERBOSE_RING_BUFFER_RECORD_TEXT = 2, /**< A line already formatted, as NUL terminated text */
+} VerboseRingBufferRecordType;
+
+typedef enum VerboseRingBufferArgumentType {
+	VERBOSE_RING_BUFFER_ARGUMENT_U32 = 1, /**< 32 bit integer (%d, %i, %u, %x, %c, %lu on 32 bit platforms and Windows ...), stored in 8 bytes */
+	VERBOSE_RING_BUFFER_ARGUMENT_U64 = 2, /**< 64 bit integer (%llu, %zu and %lu on 64 bit platforms other than Windows ...), stored in 8 bytes */
+	VERBOSE_RING_BUFFER_ARGUMENT_DOUBLE = 3, /**< double (%f, %e, %g ...), stored in 8 bytes */
+	VERBOSE_RING_BUFFER_ARGUMENT_STRING = 4, /**< string (%s), stored as a 4 byte length, padded to 8 bytes, followed by the characters */
+	VERBOSE_RING_BUFFER_ARGUMENT_POINTER = 5, /**< pointer (%p), stored in 8 bytes */
+} VerboseRingBufferArgumentType;
+
+typedef struct VerboseRingBufferHeader {
+	uint32_t magic; /**< VERBOSE_RING_BUFFER_MAGIC */
+	uint32_t version; /**< VERBOSE_RING_BUFFER_VERSION */
+	uint32_t pointerSize; /**< sizeof(void *) in the writing process, for %p */
+	volatile uint32_t formatCount; /**< Number of entries in the format table */
+	uint64_t textOffset; /**< File offset of the XML header and footer text */
+	uint32_t headerTextLength; /**< Length of the XML header text, which starts at textOffset */
+	uint32_t footerTextLength; /**< Length of the XML footer text, which follows the header text */
+	uint64_t formatTableOffset; /**< File offset of the format table */
+	uint64_t formatTableSize; /**< Size of the format table area */
+	volatile uint64_t formatTableUsed; /**< Bytes of the format table area in use */
+	uint64_t ringOffset; /**< File offset of the ring */
+	uint64_t ringSize; /**< Size of the ring */
+	volatile uint64_t tail; /**< Position of the oldest complete record */
+	volatile uint64_t head; /**< Position following the newest complete record */
+	volatile uint64_t overwrittenRecords; /**< Number of records lost to the ring wrapping around */
+	volatile uint64_t droppedRecords; /**< Number of records larger than the ring, not written */
+} VerboseRingBufferHeader;
+
+typedef struct VerboseRingBufferFormat {
+	uint32_t length; /**< Size of the entry in bytes, including the argument types and the format string */
+	uint32_t argumentCount; /**< Number of argument types (uint8_t VerboseRingBufferArgumentType) following this structure */
+} VerboseRingBufferFormat;
+
+typedef struct VerboseRingBufferRecord {
+	uint32_t length; /**< Size of the record in bytes, including its arguments or text */
+	uint16_t type; /**< VerboseRingBufferRecordType */
+	uint16_t indent; /**< Indentation level of the line */
+	uint32_t formatId; /**< Format table index, for VERBOSE_RING_BUFFER_RECORD_FORMATTED records */
+	uint32_t reserved;
+} VerboseRingBufferRecord;
+
+#endif /* VERBOSERINGBUFFERFORMAT_HPP_ */
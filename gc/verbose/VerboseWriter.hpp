@@ -25,6 +25,7 @@
 
 #include "omrcfg.h"
 #include "modronbase.h"
+#include "omrstdarg.h"
 
 #include "Base.hpp"
 
@@ -35,7 +36,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_RING_BUFFER = 6
 } WriterType;
 
 /**
@@ -69,6 +71,13 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Output one line before it is formatted, for writers which store the format and its arguments instead of text.
+	 * The arguments must be read from a copy of args.
+	 * @return true if the line has been output, false if the writer needs it formatted through outputString()
+	 */
+	virtual bool outputRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args) { return false; }
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
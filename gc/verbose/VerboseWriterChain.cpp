@@ -62,6 +62,19 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
+	/* Writers recording lines unformatted take them first: the line is only formatted if another writer needs the text */
+	bool textRequired = false;
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (!writer->outputRecord(env, indent, format, args)) {
+			textRequired = true;
+		}
+		writer = writer->getNextWriter();
+	}
+	if (!textRequired) {
+		return;
+	}
+
 	for (uintptr_t i = 0; i < indent; ++i) {
 		_buffer->add(env, INDENT_SPACER);
 	}
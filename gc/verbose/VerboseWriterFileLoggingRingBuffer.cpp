@@ -0,0 +1,538 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include "VerboseWriterFileLoggingRingBuffer.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+#include <string.h>
+
+#undef _UTE_MODULE_HEADER_
+#undef UT_MODULE_LOADED
+#undef UT_MODULE_UNLOADED
+#include "ut_j9vgc.h"
+
+MM_VerboseWriterFileLoggingRingBuffer::MM_VerboseWriterFileLoggingRingBuffer(MM_EnvironmentBase *env, MM_VerboseManager *manager, uintptr_t ringBufferSize)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_RING_BUFFER)
+	,_ringBufferSize(MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_RECORD_ALIGNMENT, OMR_MAX(ringBufferSize, (uintptr_t)VERBOSE_RING_BUFFER_MINIMUM_SIZE)))
+	,_logFileDescriptor(-1)
+	,_mapping(NULL)
+	,_header(NULL)
+	,_formatTable(NULL)
+	,_ring(NULL)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingRingBuffer instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingRingBuffer.
+ */
+MM_VerboseWriterFileLoggingRingBuffer *
+MM_VerboseWriterFileLoggingRingBuffer::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t ringBufferSize)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingRingBuffer *agent = (MM_VerboseWriterFileLoggingRingBuffer *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingRingBuffer), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingRingBuffer(env, manager, ringBufferSize);
+		/* the ring keeps the most recent output, there is no rotation through files */
+		if(!agent->initialize(env, filename, 0, 0)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingRingBuffer instance.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingRingBuffer::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (OMRPORT_MMAP_CAPABILITY_WRITE != (OMRPORT_MMAP_CAPABILITY_WRITE & omrmmap_capabilities())) {
+		return false;
+	}
+
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingRingBuffer.
+ * Unmaps and closes the file, if it is still open.
+ */
+void
+MM_VerboseWriterFileLoggingRingBuffer::tearDown(MM_EnvironmentBase *env)
+{
+	closeFile(env);
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Creates the file to log output to, maps it and initializes its header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingRingBuffer::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	uintptr_t textOffset = MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_ALIGNMENT, sizeof(VerboseRingBufferHeader));
+	uintptr_t formatTableOffset = textOffset + VERBOSE_RING_BUFFER_TEXT_SIZE;
+	uintptr_t ringOffset = formatTableOffset + VERBOSE_RING_BUFFER_FORMAT_TABLE_SIZE;
+	uintptr_t fileSize = ringOffset + _ringBufferSize;
+
+	/* the file is extended with zeroes, so the ring starts out empty */
+	if (0 == omrfile_set_length(_logFileDescriptor, fileSize)) {
+		_mapping = omrmmap_map_file(_logFileDescriptor, 0, fileSize, filenameToOpen, OMRPORT_MMAP_FLAG_WRITE | OMRPORT_MMAP_FLAG_SHARED, OMRMEM_CATEGORY_MM);
+	}
+	extensions->getForge()->free(filenameToOpen);
+	if (NULL == _mapping) {
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+		return false;
+	}
+
+	uint8_t *base = (uint8_t *)_mapping->pointer;
+	_header = (VerboseRingBufferHeader *)base;
+	_formatTable = base + formatTableOffset;
+	_ring = base + ringOffset;
+	memset(_formatCache, 0, sizeof(_formatCache));
+
+	/* the header and footer are stored as the text writers write them, the footer followed by a new line */
+	const char *headerText = getHeader(env);
+	const char *footerText = getFooter(env);
+	uintptr_t headerTextLength = strlen(headerText);
+	uintptr_t footerTextLength = strlen(footerText);
+	Assert_VGC_true((headerTextLength + footerTextLength + 1) <= VERBOSE_RING_BUFFER_TEXT_SIZE);
+	memcpy(base + textOffset, headerText, headerTextLength);
+	memcpy(base + textOffset + headerTextLength, footerText, footerTextLength);
+	base[textOffset + headerTextLength + footerTextLength] = '\n';
+
+	_header->version = VERBOSE_RING_BUFFER_VERSION;
+	_header->pointerSize = sizeof(void *);
+	_header->formatCount = 0;
+	_header->textOffset = textOffset;
+	_header->headerTextLength = (uint32_t)headerTextLength;
+	_header->footerTextLength = (uint32_t)footerTextLength + 1;
+	_header->formatTableOffset = formatTableOffset;
+	_header->formatTableSize = VERBOSE_RING_BUFFER_FORMAT_TABLE_SIZE;
+	_header->formatTableUsed = 0;
+	_header->ringOffset = ringOffset;
+	_header->ringSize = _ringBufferSize;
+	_header->tail = 0;
+	_header->head = 0;
+	_header->overwrittenRecords = 0;
+	_header->droppedRecords = 0;
+	/* the magic number is written last, so that a reader which finds it finds a complete header */
+	MM_AtomicOperations::writeBarrier();
+	_header->magic = VERBOSE_RING_BUFFER_MAGIC;
+
+	return true;
+}
+
+/**
+ * Flushes the mapping to the file, unmaps it and closes the file.
+ */
+void
+MM_VerboseWriterFileLoggingRingBuffer::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != _mapping) {
+		omrmmap_msync(_mapping->pointer, _mapping->size, OMRPORT_MMAP_SYNC_WAIT);
+		omrmmap_unmap_file(_mapping);
+		_mapping = NULL;
+		_header = NULL;
+		_formatTable = NULL;
+		_ring = NULL;
+	}
+	if (-1 != _logFileDescriptor) {
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingRingBuffer::outputRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	if (NULL == _header) {
+		/* the file could not be created: the line is lost, as it would be for a text file */
+		return true;
+	}
+
+	FormatCacheEntry *entry = findFormat(env, format);
+	if (NULL == entry) {
+		outputTextRecord(env, indent, format, args);
+		return true;
+	}
+
+	/* read the arguments first, as strings decide the size of the record */
+	uint64_t values[VERBOSE_RING_BUFFER_MAX_ARGUMENTS];
+	const char *strings[VERBOSE_RING_BUFFER_MAX_ARGUMENTS];
+	uintptr_t size = sizeof(VerboseRingBufferRecord);
+	va_list argsCopy;
+	COPY_VA_LIST(argsCopy, args);
+	for (uint32_t i = 0; i < entry->argumentCount; i++) {
+		switch (entry->argumentTypes[i]) {
+		case VERBOSE_RING_BUFFER_ARGUMENT_U32:
+			values[i] = va_arg(argsCopy, uint32_t);
+			break;
+		case VERBOSE_RING_BUFFER_ARGUMENT_U64:
+			values[i] = va_arg(argsCopy, uint64_t);
+			break;
+		case VERBOSE_RING_BUFFER_ARGUMENT_DOUBLE:
+		{
+			double value = va_arg(argsCopy, double);
+			memcpy(&values[i], &value, sizeof(value));
+			break;
+		}
+		case VERBOSE_RING_BUFFER_ARGUMENT_POINTER:
+			values[i] = (uint64_t)(uintptr_t)va_arg(argsCopy, void *);
+			break;
+		case VERBOSE_RING_BUFFER_ARGUMENT_STRING:
+			strings[i] = va_arg(argsCopy, const char *);
+			if (NULL == strings[i]) {
+				values[i] = VERBOSE_RING_BUFFER_NULL_STRING;
+			} else {
+				values[i] = strlen(strings[i]);
+				size += MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_ALIGNMENT, (uintptr_t)values[i]);
+			}
+			break;
+		default:
+			Assert_VGC_false(true);
+		}
+		size += sizeof(uint64_t);
+	}
+	END_VA_LIST_COPY(argsCopy);
+
+	size = MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_RECORD_ALIGNMENT, size);
+	VerboseRingBufferRecord *record = reserveRecord(size);
+	if (NULL != record) {
+		record->length = (uint32_t)size;
+		record->type = VERBOSE_RING_BUFFER_RECORD_FORMATTED;
+		record->indent = (uint16_t)indent;
+		record->formatId = entry->formatId;
+		record->reserved = 0;
+
+		uint8_t *cursor = (uint8_t *)(record + 1);
+		for (uint32_t i = 0; i < entry->argumentCount; i++) {
+			if (VERBOSE_RING_BUFFER_ARGUMENT_STRING == entry->argumentTypes[i]) {
+				uint32_t length = (uint32_t)values[i];
+				*(uint64_t *)cursor = 0;
+				*(uint32_t *)cursor = length;
+				cursor += sizeof(uint64_t);
+				if (VERBOSE_RING_BUFFER_NULL_STRING != length) {
+					memcpy(cursor, strings[i], length);
+					cursor += MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_ALIGNMENT, (uintptr_t)length);
+				}
+			} else {
+				*(uint64_t *)cursor = values[i];
+				cursor += sizeof(uint64_t);
+			}
+		}
+
+		commitRecord(size);
+	}
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingRingBuffer::outputTextRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	va_list argsCopy;
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t textSize = omrstr_vprintf(NULL, 0, format, argsCopy);
+	END_VA_LIST_COPY(argsCopy);
+
+	uintptr_t size = MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_RECORD_ALIGNMENT, sizeof(VerboseRingBufferRecord) + textSize);
+	VerboseRingBufferRecord *record = reserveRecord(size);
+	if (NULL != record) {
+		record->length = (uint32_t)size;
+		record->type = VERBOSE_RING_BUFFER_RECORD_TEXT;
+		record->indent = (uint16_t)indent;
+		record->formatId = 0;
+		record->reserved = 0;
+
+		COPY_VA_LIST(argsCopy, args);
+		omrstr_vprintf((char *)(record + 1), textSize, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+
+		commitRecord(size);
+	}
+}
+
+MM_VerboseWriterFileLoggingRingBuffer::FormatCacheEntry *
+MM_VerboseWriterFileLoggingRingBuffer::findFormat(MM_EnvironmentBase *env, const char *format)
+{
+	uintptr_t index = (((uintptr_t)format) >> 3) & (VERBOSE_RING_BUFFER_FORMAT_CACHE_SIZE - 1);
+
+	for (uintptr_t probe = 0; probe < VERBOSE_RING_BUFFER_FORMAT_CACHE_SIZE; probe++) {
+		FormatCacheEntry *entry = &_formatCache[index];
+
+		if (format == entry->format) {
+			/* Formats are found by address, which only works for string constants: a format formatted in a buffer
+			 * reuses the address with other contents, so it is checked against the copy and written as text.
+			 * Entries with no copy are formats which can not be stored.
+			 */
+			if ((NULL != entry->storedFormat) && (0 == strcmp(entry->storedFormat, format))) {
+				return entry;
+			}
+			return NULL;
+		}
+
+		if (NULL == entry->format) {
+			entry->format = format;
+			entry->storedFormat = NULL;
+			if (parseFormat(format, entry->argumentTypes, &entry->argumentCount)) {
+				uintptr_t formatLength = strlen(format) + 1;
+				uintptr_t entrySize = MM_Math::roundToCeiling(VERBOSE_RING_BUFFER_ALIGNMENT, sizeof(VerboseRingBufferFormat) + entry->argumentCount + formatLength);
+				uintptr_t used = (uintptr_t)_header->formatTableUsed;
+				if ((used + entrySize) <= VERBOSE_RING_BUFFER_FORMAT_TABLE_SIZE) {
+					VerboseRingBufferFormat *stored = (VerboseRingBufferFormat *)(_formatTable + used);
+					uint8_t *storedTypes = (uint8_t *)(stored + 1);
+					char *storedFormat = (char *)(storedTypes + entry->argumentCount);
+					stored->length = (uint32_t)entrySize;
+					stored->argumentCount = entry->argumentCount;
+					memcpy(storedTypes, entry->argumentTypes, entry->argumentCount);
+					memcpy(storedFormat, format, formatLength);
+
+					entry->formatId = _header->formatCount;
+					entry->storedFormat = storedFormat;
+
+					/* publish the entry once it is complete */
+					MM_AtomicOperations::writeBarrier();
+					_header->formatTableUsed = used + entrySize;
+					_header->formatCount += 1;
+					return entry;
+				}
+			}
+			return NULL;
+		}
+
+		index = (index + 1) & (VERBOSE_RING_BUFFER_FORMAT_CACHE_SIZE - 1);
+	}
+
+	/* every slot is taken */
+	return NULL;
+}
+
+bool
+MM_VerboseWriterFileLoggingRingBuffer::parseFormat(const char *format, uint8_t *argumentTypes, uint32_t *argumentCount)
+{
+	uint32_t count = 0;
+	const char *cursor = format;
+
+	while ('\0' != *cursor) {
+		if ('%' != *cursor++) {
+			continue;
+		}
+		if ('%' == *cursor) {
+			/* literal '%' */
+			cursor += 1;
+			continue;
+		}
+
+		/* one flag, as omrstr_vprintf() accepts */
+		switch (*cursor) {
+		case '0':
+		case ' ':
+		case '-':
+		case '+':
+		case '#':
+			cursor += 1;
+			break;
+		}
+		/* width and precision: arguments given as '*' and positional arguments ('$') are not supported */
+		while (('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+		if ('.' == *cursor) {
+			cursor += 1;
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				cursor += 1;
+			}
+		}
+		if (('*' == *cursor) || ('$' == *cursor)) {
+			return false;
+		}
+
+		bool isLongLong = false;
+		bool isLong = false;
+		if ('z' == *cursor) {
+			cursor += 1;
+#if defined(OMR_ENV_DATA64)
+			isLongLong = true;
+#endif /* defined(OMR_ENV_DATA64) */
+		} else if ('l' == *cursor) {
+			cursor += 1;
+			if ('l' == *cursor) {
+				cursor += 1;
+				isLongLong = true;
+			} else {
+				isLong = true;
+#if defined(OMR_ENV_DATA64) && !defined(WIN32)
+				/* long is as wide as a pointer, except on 64 bit Windows */
+				isLongLong = true;
+#endif /* defined(OMR_ENV_DATA64) && !defined(WIN32) */
+			}
+		}
+
+		if (VERBOSE_RING_BUFFER_MAX_ARGUMENTS == count) {
+			return false;
+		}
+
+		switch (*cursor) {
+		case 'c':
+			argumentTypes[count] = VERBOSE_RING_BUFFER_ARGUMENT_U32;
+			break;
+		case 'i':
+		case 'd':
+		case 'u':
+		case 'x':
+		case 'X':
+			argumentTypes[count] = isLongLong ? VERBOSE_RING_BUFFER_ARGUMENT_U64 : VERBOSE_RING_BUFFER_ARGUMENT_U32;
+			break;
+		case 'p':
+			argumentTypes[count] = VERBOSE_RING_BUFFER_ARGUMENT_POINTER;
+			break;
+		case 's':
+			if (isLong) {
+				/* wide strings */
+				return false;
+			}
+			argumentTypes[count] = VERBOSE_RING_BUFFER_ARGUMENT_STRING;
+			break;
+		case 'f':
+		case 'e':
+		case 'E':
+		case 'F':
+		case 'g':
+		case 'G':
+			argumentTypes[count] = VERBOSE_RING_BUFFER_ARGUMENT_DOUBLE;
+			break;
+		default:
+			return false;
+		}
+		cursor += 1;
+		count += 1;
+	}
+
+	*argumentCount = count;
+	return true;
+}
+
+VerboseRingBufferRecord *
+MM_VerboseWriterFileLoggingRingBuffer::reserveRecord(uintptr_t size)
+{
+	if (size > _ringBufferSize) {
+		_header->droppedRecords += 1;
+		return NULL;
+	}
+
+	uintptr_t offset = (uintptr_t)(_header->head % _ringBufferSize);
+	uintptr_t contiguous = _ringBufferSize - offset;
+	if (size > contiguous) {
+		/* records do not wrap: pad the end of the ring, and start the record at the beginning */
+		makeRoom(contiguous);
+		VerboseRingBufferRecord *pad = (VerboseRingBufferRecord *)(_ring + offset);
+		pad->length = (uint32_t)contiguous;
+		pad->type = VERBOSE_RING_BUFFER_RECORD_PAD;
+		pad->indent = 0;
+		pad->formatId = 0;
+		pad->reserved = 0;
+		commitRecord(contiguous);
+		offset = 0;
+	}
+
+	makeRoom(size);
+	return (VerboseRingBufferRecord *)(_ring + offset);
+}
+
+void
+MM_VerboseWriterFileLoggingRingBuffer::commitRecord(uintptr_t size)
+{
+	/* the head is published once the record is complete */
+	MM_AtomicOperations::writeBarrier();
+	_header->head += size;
+}
+
+void
+MM_VerboseWriterFileLoggingRingBuffer::makeRoom(uintptr_t size)
+{
+	uint64_t head = _header->head;
+	uint64_t tail = _header->tail;
+
+	if ((head + size - tail) > _ringBufferSize) {
+		uint64_t overwritten = 0;
+		while ((head + size - tail) > _ringBufferSize) {
+			VerboseRingBufferRecord *oldest = (VerboseRingBufferRecord *)(_ring + (uintptr_t)(tail % _ringBufferSize));
+			tail += oldest->length;
+			if (VERBOSE_RING_BUFFER_RECORD_PAD != oldest->type) {
+				overwritten += 1;
+			}
+		}
+		_header->overwrittenRecords += overwritten;
+		_header->tail = tail;
+		/* the tail is published before the records it drops are overwritten */
+		MM_AtomicOperations::writeBarrier();
+	}
+}
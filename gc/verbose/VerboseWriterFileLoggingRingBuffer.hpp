@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGRINGBUFFER_HPP_)
+#define VERBOSEWRITERFILELOGGINGRINGBUFFER_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "VerboseRingBufferFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/* Number of slots in the table mapping format strings to format table entries (a power of two). */
+#define VERBOSE_RING_BUFFER_FORMAT_CACHE_SIZE 1024
+
+/**
+ * Output agent which writes verbosegc output as binary records into a memory mapped ring file
+ * (see VerboseRingBufferFormat.hpp), instead of formatting it as text.
+ * Each distinct format string is stored once, along with the types of its arguments, and every line output with
+ * it is a fixed layout record holding the arguments only, so logging a line costs a few copies. The records are
+ * converted back to XML offline. The ring is sized by MM_GCExtensionsBase::verboseRingBufferSize and keeps the most
+ * recent output; the file is never rotated.
+ *
+ * The writer chain is only ever used by one thread at a time, so the ring has a single producer: it needs no lock,
+ * and readers mapping the file only rely on the head and tail being published after and before the records they cover.
+ */
+class MM_VerboseWriterFileLoggingRingBuffer : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * A format string already stored in the format table
+	 */
+	struct FormatCacheEntry {
+		const char *format; /**< The format string, as passed to the writer chain */
+		const char *storedFormat; /**< The copy of the format string in the format table */
+		uint32_t formatId; /**< The index of the format in the format table */
+		uint32_t argumentCount; /**< The number of arguments consumed by the format */
+		uint8_t argumentTypes[VERBOSE_RING_BUFFER_MAX_ARGUMENTS]; /**< The VerboseRingBufferArgumentType of each argument */
+	};
+
+	uintptr_t _ringBufferSize; /**< Size of the ring, in bytes */
+	intptr_t _logFileDescriptor; /**< The file being mapped, -1 if not open */
+	J9MmapHandle *_mapping; /**< The mapping of the whole file */
+	VerboseRingBufferHeader *_header; /**< The header at the start of the mapping */
+	uint8_t *_formatTable; /**< The format table area of the mapping */
+	uint8_t *_ring; /**< The ring area of the mapping */
+	FormatCacheEntry _formatCache[VERBOSE_RING_BUFFER_FORMAT_CACHE_SIZE]; /**< Formats already stored, hashed by address */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingRingBuffer *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t ringBufferSize);
+
+	/**
+	 * Text output is not used: every line reaches the writer through outputRecord().
+	 */
+	virtual void outputString(MM_EnvironmentBase *env, const char *string) {}
+
+	virtual bool outputRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+protected:
+	MM_VerboseWriterFileLoggingRingBuffer(MM_EnvironmentBase *env, MM_VerboseManager *manager, uintptr_t ringBufferSize);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the format table entry of a format string, adding it to the table if it is not there yet.
+	 * @return the cache entry of the format, or NULL if the format can not be stored (the line must be output as text)
+	 */
+	FormatCacheEntry *findFormat(MM_EnvironmentBase *env, const char *format);
+
+	/**
+	 * Determine the argument types consumed by a format string, the same way omrstr_vprintf() reads them.
+	 * @return false if the format uses conversions records can not represent (positional or '*' arguments, wide strings)
+	 */
+	bool parseFormat(const char *format, uint8_t *argumentTypes, uint32_t *argumentCount);
+
+	/**
+	 * Format a line and write it as a text record, for formats which can not be stored.
+	 */
+	void outputTextRecord(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Reserve contiguous space for a record at the head of the ring, moving the tail past the records it overwrites.
+	 * @param size the size of the record, aligned to VERBOSE_RING_BUFFER_ALIGNMENT
+	 * @return the address of the record, or NULL if the record is larger than the ring
+	 */
+	VerboseRingBufferRecord *reserveRecord(uintptr_t size);
+
+	/**
+	 * Publish the record last reserved, once it has been filled in.
+	 * @param size the size passed to reserveRecord()
+	 */
+	void commitRecord(uintptr_t size);
+
+	/**
+	 * Move the tail past the oldest records until there is room for size more bytes at the head.
+	 */
+	void makeRoom(uintptr_t size);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGRINGBUFFER_HPP_ */
@@ -27,6 +27,7 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "RememberedSetCards.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -56,6 +57,7 @@ static void verboseHandlerCompactEnd(J9HookInterface** hook, uintptr_t eventNum,
 #if defined(OMR_GC_MODRON_SCAVENGER)
 static void verboseHandlerScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerScavengePercolate(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerScavengePauseTargetDecision(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 static void verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
@@ -138,6 +140,7 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseHandlerScavengeEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_PERCOLATE_COLLECT, verboseHandlerScavengePercolate, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_PAUSE_TARGET_DECISION, verboseHandlerScavengePauseTargetDecision, OMR_GET_CALLSITE(), (void *)this);
 
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, OMR_GET_CALLSITE(), this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_END, verboseHandlerConcurrentEnd, OMR_GET_CALLSITE(), this);
@@ -196,6 +199,7 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseHandlerScavengeEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_PERCOLATE_COLLECT, verboseHandlerScavengePercolate, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_PAUSE_TARGET_DECISION, verboseHandlerScavengePauseTargetDecision, NULL);
 
 	/* Concurrent GMP */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, NULL);
@@ -300,6 +304,33 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+	if (0 != markStats->_markMapCacheBits) {
+		writer->formatAndOutput(env, 1, "<mark-map-cache flushcount=\"%zu\" bitcount=\"%zu\" />",
+				markStats->_markMapCacheFlushes, markStats->_markMapCacheBits);
+	}
+
+	uintptr_t nodeCount = extensions->_numaManager.getAffinityLeaderCount();
+	if (extensions->numaAwareWorkPackets && (1 < nodeCount)) {
+		writer->formatAndOutput(env, 1, "<workpacket-info nodes=\"%zu\" remotesteals=\"%zu\" />",
+				nodeCount, markStats->_remoteStealCount);
+	}
+
+	if (extensions->workStealingDeque) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<deque-info stolen=\"%zu\" shared=\"%zu\" />",
+				workPacketStats->dequeElementsStolen, workPacketStats->dequeElementsShared);
+	}
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	MM_ConcurrentEvacuationStats *evacuationStats = &extensions->globalGCStats.concurrentEvacuationStats;
+	if (0 != evacuationStats->_areasSelected) {
+		writer->formatAndOutput(env, 1, "<concurrent-evacuation areas=\"%zu\" abortedareas=\"%zu\" selectedbytes=\"%zu\" objects=\"%zu\" bytes=\"%zu\" pinned=\"%zu\" discardedbytes=\"%zu\" />",
+				evacuationStats->_areasSelected, evacuationStats->_areasAborted, evacuationStats->_bytesSelected,
+				evacuationStats->_objectsEvacuated, evacuationStats->_bytesEvacuated, evacuationStats->_objectsPinned,
+				evacuationStats->_bytesDiscarded);
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -372,8 +403,13 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_summaryChunks) {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" summarychunks=\"%zu\" summarywaits=\"%zu\" reason=\"%s\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, compactStats->_summaryChunks, compactStats->_summaryChunkWaits, getCompactionReasonAsString(compactStats->_compactReason));
+		} else {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -415,6 +451,10 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		if (extensions->scvTenureStrategyDecay) {
+			writer->formatAndOutput(env, 1, "<tenure-decay tenureage=\"%zu\" window=\"%zu\" copysavedbytes=\"%zu\" tenuregarbagebytes=\"%zu\" />",
+					extensions->scvTenureDecayTenureAge, extensions->scvTenureDecayWindow, cycleScavengerStats->_decayCopyBytesSaved, cycleScavengerStats->_decayTenureGarbageBytes);
+		}
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -425,6 +465,15 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if (extensions->scavengerHotFieldCopy) {
+		writer->formatAndOutput(env, 1, "<hot-field-copy objects=\"%zu\" bytes=\"%zu\" samecacheline=\"%zu\" samepage=\"%zu\" />",
+				scavengerStats->_hotFieldCopyCount, scavengerStats->_hotFieldCopyBytes, scavengerStats->_hotFieldCopySameCacheLineCount, scavengerStats->_hotFieldCopySamePageCount);
+	}
+	if (NULL != extensions->rememberedSetCards) {
+		MM_RememberedSetCards *rememberedSetCards = extensions->rememberedSetCards;
+		writer->formatAndOutput(env, 1, "<remembered-set-cards cards=\"%zu\" cleaned=\"%zu\" objects=\"%zu\" buffered=\"%zu\" />",
+				rememberedSetCards->getLastDrainCards(), rememberedSetCards->getLastDrainCleanedCards(), rememberedSetCards->getLastDrainObjects(), rememberedSetCards->getLastDrainBufferedObjects());
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -507,6 +556,43 @@ MM_VerboseHandlerOutputStandard::handleScavengePercolateInternal(MM_EnvironmentB
 {
 	/* Empty stub */
 }
+
+void
+MM_VerboseHandlerOutputStandard::handleScavengePauseTargetDecision(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ScavengePauseTargetDecisionEvent *event = (MM_ScavengePauseTargetDecisionEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	uintptr_t overheadHundredths = (uintptr_t)(event->overhead * 100.0f);
+	const char *action = NULL;
+
+	switch (event->resizeType) {
+	case HEAP_EXPAND:
+		action = "expand";
+		break;
+	case HEAP_CONTRACT:
+		action = "contract";
+		break;
+	default:
+		action = "none";
+		break;
+	}
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<nursery-sizing id=\"%zu\" action=\"%s\" amount=\"%zu\" nurserysize=\"%zu\" reason=\"%s\" %s>",
+		manager->getIdAndIncrement(), action, event->amount, event->nurserySize, getPauseTargetReasonAsString((PauseTargetReason)event->reason), tagTemplate);
+	writer->formatAndOutput(env, 1, "<pause timems=\"%llu.%03llu\" averagems=\"%llu.%03llu\" targetms=\"%llu.%03llu\" />",
+		event->pauseTime / 1000, event->pauseTime % 1000, event->averagePauseTime / 1000, event->averagePauseTime % 1000, event->pauseTarget / 1000, event->pauseTarget % 1000);
+	writer->formatAndOutput(env, 1, "<overhead percent=\"%zu.%02zu\" target=\"%zu\" />", overheadHundredths / 100, overheadHundredths % 100, event->overheadTarget);
+	writer->formatAndOutput(env, 1, "<tenure-age from=\"%zu\" to=\"%zu\" />", event->tenureAge, event->newTenureAge);
+	writer->formatAndOutput(env, 0, "</nursery-sizing>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
 #endif /*defined(OMR_GC_MODRON_SCAVENGER) */
 
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -554,8 +640,8 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	handleGCOPOuterStanzaStart(env, "card-cleaning", env->_cycleState->_verboseContextID, durationUs, true);
 
 	writer->formatAndOutput(
-			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
-			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" cardsScanned=\"%zu\" cardsScannedPerMs=\"%llu\" />",
+			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount, event->finalScannedCards, event->finalScannedCardsPerMs);
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
@@ -854,7 +940,7 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -898,7 +984,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
@@ -1045,6 +1131,12 @@ verboseHandlerScavengePercolate(J9HookInterface** hook, uintptr_t eventNum, void
 	((MM_VerboseHandlerOutputStandard *)userData)->handleScavengePercolate(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerScavengePauseTargetDecision(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleScavengePauseTargetDecision(hook, eventNum, eventData);
+}
+
 void
 verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
@@ -137,6 +137,14 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleScavengePercolate(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write verbose stanza for a nursery sizing decision of the scavenger pause target controller.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleScavengePauseTargetDecision(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 	
 	virtual const char *getConcurrentTypeString() { return "scavenge"; }
 	
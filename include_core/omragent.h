@@ -43,6 +43,7 @@ extern "C" {
 
 typedef struct OMR_TI_MemoryCategory OMR_TI_MemoryCategory;
 typedef struct OMR_SampledMethodDescription OMR_SampledMethodDescription;
+typedef struct OMR_TI_AllocationSite OMR_TI_AllocationSite;
 
 typedef struct OMR_TI {
 	int32_t version;
@@ -302,6 +303,30 @@ typedef struct OMR_TI {
 	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT A NULL pointer was passed in for an output parameter.
 	 */
 	omr_error_t (*GetMethodProperties)(OMR_VMThread *vmThread, size_t *numProperties, const char *const **propertyNames, size_t *sizeofSampledMethodDesc);
+
+	/**
+	 * Retrieve the allocation sites which allocated the most bytes, in decreasing order of allocated bytes.
+	 *
+	 * Allocation sites are sampled by the GC every -Xgc:allocationSamplingInterval= bytes allocated by a thread,
+	 * when it refreshes its thread local heap. The bytes allocated since the previous sample of the thread are
+	 * attributed to the site of the sampled object: its type and its call site, as reported by the language.
+	 * A call site which is a method dictionary key can be described using GetMethodDescriptions().
+	 *
+	 * @param[in] vmThread The current OMR VM thread.
+	 * @param[in] maxSites The number of entries in sites.
+	 * @param[out] sites A preallocated buffer where the allocation sites will be written.
+	 *             Must not be NULL if maxSites is non-zero.
+	 * @param[out] writtenCount If not NULL, the number of allocation sites written to sites is written to this address.
+	 * @param[out] totalCount If not NULL, the number of allocation sites available is written to this address.
+	 *
+	 * @return An OMR error code.
+	 * @retval OMR_ERROR_NONE Success.
+	 * @retval OMR_THREAD_NOT_ATTACHED vmThread is NULL.
+	 * @retval OMR_ERROR_NOT_AVAILABLE Allocation sites are not sampled.
+	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT maxSites is negative, or sites is NULL and maxSites is non-zero.
+	 */
+	omr_error_t (*GetAllocationSites)(OMR_VMThread *vmThread, int32_t maxSites, OMR_TI_AllocationSite *sites,
+		int32_t *writtenCount, int32_t *totalCount);
 } OMR_TI;
 
 /*
@@ -333,6 +358,23 @@ struct OMR_TI_MemoryCategory {
 	struct OMR_TI_MemoryCategory *parent;
 };
 
+/*
+ * Return data for the GetAllocationSites API
+ */
+struct OMR_TI_AllocationSite {
+	/* Type of the objects allocated at this site, as reported by the language */
+	const void *type;
+
+	/* Call site of the objects allocated at this site, as reported by the language (may be NULL) */
+	const void *callSite;
+
+	/* Bytes attributed to this site; may overestimate by the bytes of a less frequent site this site replaced */
+	uint64_t allocatedBytes;
+
+	/* Number of samples taken at this site */
+	uint64_t sampleCount;
+};
+
 /**
  * Description of a method that was sampled by the profiler, which is retrieved using GetMethodDescriptions() in OMR_TI.
  * The size of this structure is language-specific. Call GetMethodProperties() to determine its required size.
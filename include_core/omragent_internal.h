@@ -114,6 +114,7 @@ omr_error_t omrtiGetMethodDescriptions(OMR_VMThread *vmThread, void **methodArra
 	OMR_SampledMethodDescription *methodDescriptions, char *nameBuffer, size_t nameBytes,
 	size_t *firstRetryMethod, size_t *nameBytesRemaining);
 omr_error_t omrtiGetMethodProperties(OMR_VMThread *vmThread, size_t *numProperties, const char *const **propertyNames, size_t *sizeofSampledMethodDesc);
+omr_error_t omrtiGetAllocationSites(OMR_VMThread *vmThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, int32_t *totalCount);
 
 /* This is an internal API which is subject to change without notice. Agents must not use this API. */
 typedef struct OMR_ThreadAPI {
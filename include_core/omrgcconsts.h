@@ -215,6 +215,13 @@ struct ModronLnrlOptions {
 #define MMINLINE_DEBUG inline
 #endif /* WIN32 */
 
+/* Hint that the object at address will be read shortly (no-op where the compiler offers no prefetch builtin) */
+#if defined(__GNUC__)
+#define OMR_GC_PREFETCH_OBJECT(address) __builtin_prefetch((const void *)(address), 0, 3)
+#else /* __GNUC__ */
+#define OMR_GC_PREFETCH_OBJECT(address)
+#endif /* __GNUC__ */
+
 /**
  * Lightweight Non-Reentrant Locks (LWNR) Spinlock Support
  * We can't use spinlocks on platforms that do not support semaphores.
@@ -388,7 +395,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	SCAV_PAUSE_TOO_HIGH
 } ContractReason;
 
 typedef enum {
@@ -398,9 +406,17 @@ typedef enum {
 	SCAV_RATIO_TOO_HIGH,
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
-	FORCED_NURSERY_EXPAND
+	FORCED_NURSERY_EXPAND,
+	SCAV_OVERHEAD_TOO_HIGH
 } ExpandReason;
 
+typedef enum {
+	PAUSE_TARGET_WITHIN_TARGETS = 1,
+	PAUSE_TARGET_PAUSE_TOO_HIGH,
+	PAUSE_TARGET_OVERHEAD_TOO_HIGH,
+	PAUSE_TARGET_EXPANSION_LIMITED_BY_PAUSE
+} PauseTargetReason;
+
 typedef enum {
 	NO_LOA_RESIZE = 1,
 	LOA_EXPAND_HEAP_ALIGNMENT,
@@ -463,6 +479,7 @@ typedef enum {
 #define J9_SCV_TENURE_RATIO_HIGH 30
 #define J9_SCV_REMSET_MAX 65536
 #define J9_SCV_REMSET_FRAGMENT_SIZE 32
+#define J9_SCV_REMSET_BUFFER_SIZE 64
 #define J9_SCV_REMSET_SIZE 16384
 
 #define J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK 20
@@ -369,6 +369,9 @@ typedef struct J9PortVmemParams {
 	 *  		- enabled for Linux only,
 	 *  		- If not set, search memory in linear scan method
 	 *  		- If set, scan memory in a quick way, using memory information in file /proc/self/maps. (still use linear search if failed)
+	 * \arg OMRPORT_VMEM_ADVISE_HUGEPAGE
+	 * 			- enabled for Linux only, ignored on all other platforms
+	 * 			- if set, memory reserved with the default page size is advised for transparent huge pages (MADV_HUGEPAGE)
 	 */
 	uintptr_t options;
 
@@ -399,6 +402,7 @@ typedef enum J9VMemMemoryQuery {
 #define OMRPORT_VMEM_ZOS_USE2TO32G_AREA 16
 #define OMRPORT_VMEM_ALLOC_QUICK 		32
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
+#define OMRPORT_VMEM_ADVISE_HUGEPAGE 128
 
 /**
  * @name Virtual Memory Address
@@ -1299,6 +1303,8 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_available_physical_memory)(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 	/** see @ref omrvmem.c::omrvmem_get_process_memory_size "omrvmem_get_process_memory_size"*/
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+	/** see @ref omrvmem.c::omrvmem_get_huge_page_backed_size "omrvmem_get_huge_page_backed_size"*/
+	int32_t (*vmem_get_huge_page_backed_size)(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBackedSize);
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -1832,6 +1838,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_numa_get_node_details(param1,param2) privateOmrPortLibrary->vmem_numa_get_node_details(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
+#define omrvmem_get_huge_page_backed_size(param1,param2,param3,param4) privateOmrPortLibrary->vmem_get_huge_page_backed_size(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
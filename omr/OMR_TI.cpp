@@ -30,6 +30,9 @@
 
 #include "OMR_MethodDictionary.hpp"
 #include "OMR_VM.hpp"
+#if defined(OMR_GC)
+#include "omrgc.h"
+#endif /* defined(OMR_GC) */
 
 #define MINIMUM_CPU_LOAD_INTERVAL J9CONST_I64(1000000)
 #define MAXIMUM_NEGATIVE_ELAPSED_TIME_COUNT 3
@@ -871,3 +874,24 @@ omrtiGetMethodProperties(OMR_VMThread *vmThread, size_t *numProperties, const ch
 	}
 	return rc;
 }
+
+omr_error_t
+omrtiGetAllocationSites(OMR_VMThread *vmThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, int32_t *totalCount)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	OMR_TI_ENTER_FROM_VM_THREAD(vmThread);
+
+	if (NULL == vmThread) {
+		rc = OMR_THREAD_NOT_ATTACHED;
+	} else if ((0 > maxSites) || ((0 != maxSites) && (NULL == sites))) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else {
+#if defined(OMR_GC)
+		rc = OMR_GC_GetAllocationSites(vmThread, maxSites, sites, writtenCount, totalCount);
+#else /* defined(OMR_GC) */
+		rc = OMR_ERROR_NOT_AVAILABLE;
+#endif /* defined(OMR_GC) */
+	}
+	OMR_TI_RETURN(vmThread, rc);
+}
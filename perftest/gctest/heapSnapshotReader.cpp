@@ -0,0 +1,381 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "heapSnapshotReader.hpp"
+
+#include "HeapSnapshotFormat.hpp"
+
+/* An object of the snapshot, as decoded */
+struct SnapshotObject {
+	uint64_t offset;
+	uint64_t size;
+	bool operator<(const SnapshotObject &other) const { return offset < other.offset; }
+};
+
+/* A reference of the snapshot, as decoded: the offsets of the referring and of the referenced objects */
+typedef std::pair<uint64_t, uint64_t> SnapshotReference;
+
+static bool
+readFile(OMRPortLibrary *portLibrary, const char *fileName, std::vector<uint8_t> &contents)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+
+	bool result = true;
+	int64_t length = omrfile_flength(fd);
+	if (length < (int64_t)sizeof(HeapSnapshotHeader)) {
+		result = false;
+	} else {
+		contents.resize((size_t)length);
+		size_t offset = 0;
+		while (offset < contents.size()) {
+			intptr_t bytesRead = omrfile_read(fd, &contents[offset], (intptr_t)(contents.size() - offset));
+			if (bytesRead <= 0) {
+				result = false;
+				break;
+			}
+			offset += (size_t)bytesRead;
+		}
+	}
+	omrfile_close(fd);
+
+	return result;
+}
+
+/**
+ * Decode an unsigned varint.
+ * @return false if the varint runs past end
+ */
+static bool
+readVarint(const uint8_t **cursor, const uint8_t *end, uint64_t *value)
+{
+	uint64_t result = 0;
+	for (uint32_t shift = 0; (*cursor < end) && (shift < 64); shift += 7) {
+		uint8_t byte = **cursor;
+		*cursor += 1;
+		result |= ((uint64_t)(byte & 0x7F)) << shift;
+		if (0 == (byte & 0x80)) {
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Decode a zigzag encoded signed varint.
+ * @return false if the varint runs past end
+ */
+static bool
+readSignedVarint(const uint8_t **cursor, const uint8_t *end, int64_t *value)
+{
+	uint64_t encoded = 0;
+	if (!readVarint(cursor, end, &encoded)) {
+		return false;
+	}
+	*value = (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1);
+	return true;
+}
+
+static bool
+readObjectsFrame(const uint8_t *cursor, const uint8_t *end, std::vector<SnapshotObject> &objects, std::vector<SnapshotReference> &references)
+{
+	uint64_t previousEnd = 0;
+	while (cursor < end) {
+		int64_t delta = 0;
+		SnapshotObject object;
+		uint64_t referenceCount = 0;
+		if (!readSignedVarint(&cursor, end, &delta) || !readVarint(&cursor, end, &object.size) || !readVarint(&cursor, end, &referenceCount)) {
+			return false;
+		}
+		object.offset = previousEnd + delta;
+		previousEnd = object.offset + object.size;
+		objects.push_back(object);
+		for (uint64_t i = 0; i < referenceCount; i++) {
+			if (!readSignedVarint(&cursor, end, &delta)) {
+				return false;
+			}
+			references.push_back(SnapshotReference(object.offset, object.offset + delta));
+		}
+	}
+	return true;
+}
+
+static bool
+readReferencesFrame(const uint8_t *cursor, const uint8_t *end, std::vector<SnapshotReference> &references)
+{
+	uint64_t objectOffset = 0;
+	if (!readVarint(&cursor, end, &objectOffset)) {
+		return false;
+	}
+	while (cursor < end) {
+		int64_t delta = 0;
+		if (!readSignedVarint(&cursor, end, &delta)) {
+			return false;
+		}
+		references.push_back(SnapshotReference(objectOffset, objectOffset + delta));
+	}
+	return true;
+}
+
+/**
+ * @return the index of the object at offset, or offsets.size() if there is none
+ */
+static size_t
+findObject(const std::vector<uint64_t> &offsets, uint64_t offset)
+{
+	std::vector<uint64_t>::const_iterator found = std::lower_bound(offsets.begin(), offsets.end(), offset);
+	if ((offsets.end() == found) || (offset != *found)) {
+		return offsets.size();
+	}
+	return (size_t)(found - offsets.begin());
+}
+
+bool
+readHeapSnapshot(OMRPortLibrary *portLibrary, const char *fileName, HeapSnapshotGraph &graph)
+{
+	std::vector<uint8_t> contents;
+	if (!readFile(portLibrary, fileName, contents)) {
+		return false;
+	}
+
+	const HeapSnapshotHeader *header = (const HeapSnapshotHeader *)&contents[0];
+	if ((HEAP_SNAPSHOT_MAGIC != header->magic) || (HEAP_SNAPSHOT_VERSION != header->version) || (0 == header->objectAlignment)) {
+		return false;
+	}
+	graph.heapBase = header->heapBase;
+	graph.objectAlignment = header->objectAlignment;
+
+	std::vector<SnapshotObject> objects;
+	std::vector<SnapshotReference> references;
+	const uint8_t *cursor = &contents[0] + sizeof(HeapSnapshotHeader);
+	const uint8_t *end = &contents[0] + contents.size();
+	uint64_t expectedObjectCount = 0;
+	uint64_t expectedReferenceCount = 0;
+	bool complete = false;
+
+	while (!complete && (cursor < end)) {
+		uint8_t type = *cursor;
+		cursor += 1;
+		uint64_t payloadLength = 0;
+		if (!readVarint(&cursor, end, &payloadLength) || (payloadLength > (uint64_t)(end - cursor))) {
+			return false;
+		}
+		const uint8_t *payloadEnd = cursor + payloadLength;
+		bool valid = false;
+		switch (type) {
+		case HEAP_SNAPSHOT_FRAME_OBJECTS:
+			valid = readObjectsFrame(cursor, payloadEnd, objects, references);
+			break;
+		case HEAP_SNAPSHOT_FRAME_REFERENCES:
+			valid = readReferencesFrame(cursor, payloadEnd, references);
+			break;
+		case HEAP_SNAPSHOT_FRAME_END:
+			valid = readVarint(&cursor, payloadEnd, &expectedObjectCount) && readVarint(&cursor, payloadEnd, &expectedReferenceCount);
+			complete = true;
+			break;
+		default:
+			break;
+		}
+		if (!valid) {
+			return false;
+		}
+		cursor = payloadEnd;
+	}
+	if (!complete || (expectedObjectCount != objects.size()) || (expectedReferenceCount != references.size())) {
+		return false;
+	}
+
+	/* the frames of the GC threads are interleaved; put the objects, then their references, in address order */
+	std::sort(objects.begin(), objects.end());
+	std::sort(references.begin(), references.end());
+
+	graph.offsets.resize(objects.size());
+	graph.sizes.resize(objects.size());
+	for (size_t i = 0; i < objects.size(); i++) {
+		graph.offsets[i] = objects[i].offset;
+		graph.sizes[i] = objects[i].size * graph.objectAlignment;
+	}
+
+	graph.referenceStarts.resize(objects.size() + 1);
+	graph.references.clear();
+	graph.references.reserve(references.size());
+	graph.danglingReferenceCount = 0;
+	size_t next = 0;
+	for (size_t object = 0; object < objects.size(); object++) {
+		graph.referenceStarts[object] = graph.references.size();
+		for (; (next < references.size()) && (references[next].first <= graph.offsets[object]); next++) {
+			size_t target = findObject(graph.offsets, references[next].second);
+			if ((references[next].first != graph.offsets[object]) || (target == objects.size())) {
+				graph.danglingReferenceCount += 1;
+			} else {
+				graph.references.push_back(target);
+			}
+		}
+	}
+	graph.referenceStarts[objects.size()] = graph.references.size();
+	graph.danglingReferenceCount += references.size() - next;
+
+	return true;
+}
+
+/**
+ * Depth first walk of the graph from a root, numbering the objects in postorder. Iterative, since object graphs
+ * are often deeper than the native stack.
+ */
+static void
+walkFromRoot(const HeapSnapshotGraph &graph, size_t root, std::vector<size_t> &postorder, std::vector<size_t> &postorderNumbers, std::vector<std::pair<size_t, size_t> > &stack)
+{
+	const size_t unvisited = graph.offsets.size() + 1;
+	postorderNumbers[root] = unvisited - 1;
+	stack.push_back(std::make_pair(root, graph.referenceStarts[root]));
+	while (!stack.empty()) {
+		size_t object = stack.back().first;
+		size_t &next = stack.back().second;
+		if (next < graph.referenceStarts[object + 1]) {
+			size_t child = graph.references[next];
+			next += 1;
+			if (unvisited == postorderNumbers[child]) {
+				/* on the stack; numbered once all of its children are */
+				postorderNumbers[child] = unvisited - 1;
+				stack.push_back(std::make_pair(child, graph.referenceStarts[child]));
+			}
+		} else {
+			postorderNumbers[object] = postorder.size();
+			postorder.push_back(object);
+			stack.pop_back();
+		}
+	}
+}
+
+void
+computeHeapSnapshotDominators(const HeapSnapshotGraph &graph, HeapSnapshotDominators &dominators)
+{
+	const size_t objectCount = graph.offsets.size();
+	const size_t virtualRoot = objectCount;
+	const size_t unvisited = objectCount + 1;
+	const size_t undefined = objectCount + 1;
+
+	/* predecessors of each object, in the same layout as the references */
+	std::vector<size_t> predecessorStarts(objectCount + 1, 0);
+	for (size_t i = 0; i < graph.references.size(); i++) {
+		predecessorStarts[graph.references[i] + 1] += 1;
+	}
+	for (size_t object = 0; object < objectCount; object++) {
+		predecessorStarts[object + 1] += predecessorStarts[object];
+	}
+	std::vector<size_t> predecessors(graph.references.size());
+	std::vector<size_t> fill(predecessorStarts.begin(), predecessorStarts.end() - 1);
+	for (size_t object = 0; object < objectCount; object++) {
+		for (size_t i = graph.referenceStarts[object]; i < graph.referenceStarts[object + 1]; i++) {
+			predecessors[fill[graph.references[i]]++] = object;
+		}
+	}
+
+	/* infer the roots: first the objects nothing refers to, then the lowest unreached object of each remaining cycle */
+	std::vector<size_t> postorder;
+	postorder.reserve(objectCount + 1);
+	std::vector<size_t> postorderNumbers(objectCount + 1, unvisited);
+	std::vector<std::pair<size_t, size_t> > stack;
+	dominators.roots.clear();
+	for (size_t object = 0; object < objectCount; object++) {
+		if (predecessorStarts[object] == predecessorStarts[object + 1]) {
+			dominators.roots.push_back(object);
+			walkFromRoot(graph, object, postorder, postorderNumbers, stack);
+		}
+	}
+	for (size_t object = 0; object < objectCount; object++) {
+		if (unvisited == postorderNumbers[object]) {
+			dominators.roots.push_back(object);
+			walkFromRoot(graph, object, postorder, postorderNumbers, stack);
+		}
+	}
+	postorderNumbers[virtualRoot] = postorder.size();
+	postorder.push_back(virtualRoot);
+
+	std::vector<bool> isRoot(objectCount, false);
+	for (std::vector<size_t>::const_iterator root = dominators.roots.begin(); root != dominators.roots.end(); ++root) {
+		isRoot[*root] = true;
+	}
+
+	/*
+	 * Iterative dominator computation of Cooper, Harvey and Kennedy ("A Simple, Fast Dominance Algorithm"): visit the
+	 * objects in reverse postorder, intersecting the dominators of their processed predecessors, until nothing changes.
+	 * A root also has the virtual root as a predecessor.
+	 */
+	std::vector<size_t> &idom = dominators.dominators;
+	idom.assign(objectCount + 1, undefined);
+	idom[virtualRoot] = virtualRoot;
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (size_t position = postorder.size() - 1; position-- > 0;) {
+			size_t object = postorder[position];
+			size_t newDominator = isRoot[object] ? virtualRoot : undefined;
+			for (size_t i = predecessorStarts[object]; i < predecessorStarts[object + 1]; i++) {
+				size_t predecessor = predecessors[i];
+				if (undefined == idom[predecessor]) {
+					continue;
+				}
+				if (undefined == newDominator) {
+					newDominator = predecessor;
+					continue;
+				}
+				size_t finger1 = predecessor;
+				size_t finger2 = newDominator;
+				while (finger1 != finger2) {
+					while (postorderNumbers[finger1] < postorderNumbers[finger2]) {
+						finger1 = idom[finger1];
+					}
+					while (postorderNumbers[finger2] < postorderNumbers[finger1]) {
+						finger2 = idom[finger2];
+					}
+				}
+				newDominator = finger1;
+			}
+			if (idom[object] != newDominator) {
+				idom[object] = newDominator;
+				changed = true;
+			}
+		}
+	}
+
+	/* a dominator comes after the objects it dominates in postorder, so it is complete when reached */
+	std::vector<uint64_t> &retainedSizes = dominators.retainedSizes;
+	retainedSizes.assign(objectCount + 1, 0);
+	for (size_t position = 0; position < postorder.size(); position++) {
+		size_t object = postorder[position];
+		if (virtualRoot != object) {
+			retainedSizes[object] += graph.sizes[object];
+			retainedSizes[idom[object]] += retainedSizes[object];
+		}
+	}
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+
+#if !defined(HEAPSNAPSHOTREADER_HPP_)
+#define HEAPSNAPSHOTREADER_HPP_
+
+#include <vector>
+
+#include "omrport.h"
+
+/**
+ * Object graph of a heap snapshot written by MM_HeapSnapshotWriter (see OMR_GC_WriteHeapSnapshot()), with the
+ * objects in address order and the references of object i in references[referenceStarts[i]..referenceStarts[i + 1]).
+ */
+struct HeapSnapshotGraph {
+	uint64_t heapBase; /**< address object offsets are relative to */
+	uint64_t objectAlignment; /**< size in bytes of the unit of offsets and sizes */
+	std::vector<uint64_t> offsets; /**< offset of each object, in units of objectAlignment */
+	std::vector<uint64_t> sizes; /**< size in bytes of each object */
+	std::vector<size_t> referenceStarts; /**< index in references of the first reference of each object, then the total */
+	std::vector<size_t> references; /**< indices of the referenced objects */
+	uint64_t danglingReferenceCount; /**< references to objects missing from the snapshot, which are ignored */
+};
+
+/**
+ * Dominator tree of a heap snapshot graph. The snapshot does not record the roots, so they are inferred: the objects
+ * no other object refers to are roots, and so is the lowest object of each cycle which is not reachable from them.
+ * All roots are dominated by a virtual root, whose index is the number of objects.
+ */
+struct HeapSnapshotDominators {
+	std::vector<size_t> roots; /**< the inferred roots */
+	std::vector<size_t> dominators; /**< index of the immediate dominator of each object */
+	std::vector<uint64_t> retainedSizes; /**< bytes freed if each object became unreachable */
+};
+
+/**
+ * Read a heap snapshot file and decode its object graph.
+ * @return true on success, false if the file is not a complete heap snapshot
+ */
+bool readHeapSnapshot(OMRPortLibrary *portLibrary, const char *fileName, HeapSnapshotGraph &graph);
+
+/**
+ * Compute the dominator tree and the retained sizes of the objects of a heap snapshot graph.
+ */
+void computeHeapSnapshotDominators(const HeapSnapshotGraph &graph, HeapSnapshotDominators &dominators);
+
+#endif /* HEAPSNAPSHOTREADER_HPP_ */
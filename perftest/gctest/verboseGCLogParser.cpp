@@ -26,6 +26,8 @@
 #include <iterator>
 #include <numeric>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string>
 
 #include "pugixml.hpp"
 
@@ -33,6 +35,9 @@
 #include "omrport.h"
 #include "omrthread.h"
 
+#include "heapSnapshotReader.hpp"
+#include "verboseGCRingDecoder.hpp"
+
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
@@ -40,10 +45,26 @@ const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
+/* Orders object indices by decreasing retained size */
+struct RetainedSizeOrder {
+	const std::vector<uint64_t> &retainedSizes;
+	RetainedSizeOrder(const std::vector<uint64_t> &sizes) : retainedSizes(sizes) {}
+	bool operator()(size_t a, size_t b) const { return retainedSizes[a] > retainedSizes[b]; }
+};
+
 double getAvg(std::vector<double> v);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
-
-int main(void)
+int decode(const char *ringFileName, const char *xmlFileName, OMRPortLibrary *portLibrary);
+int analyzeHeapSnapshot(const char *snapshotFileName, uintptr_t topCount, OMRPortLibrary *portLibrary);
+
+/**
+ * Without arguments, analyze every verbose GC file in the current directory (text or ring buffer).
+ * With -decode <ring file> [<xml file>], convert a ring buffer file written with -Xgc:verboseRingBufferSize=
+ * to XML, on stdout if no XML file is given.
+ * With -heapSnapshot <snapshot file> [<count>], print the objects of a heap snapshot written by
+ * OMR_GC_WriteHeapSnapshot() which retain the most memory (10 by default).
+ */
+int main(int argc, char *argv[])
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -66,6 +87,30 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
+	if ((argc > 1) && (0 == strcmp(argv[1], "-decode"))) {
+		if ((argc < 3) || (argc > 4)) {
+			fprintf(stderr, "Usage: %s -decode <ring file> [<xml file>]\n", argv[0]);
+			rc = -1;
+		} else {
+			rc = decode(argv[2], (4 == argc) ? argv[3] : NULL, &portLibrary);
+		}
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return (int)rc;
+	}
+
+	if ((argc > 1) && (0 == strcmp(argv[1], "-heapSnapshot"))) {
+		if ((argc < 3) || (argc > 4)) {
+			fprintf(stderr, "Usage: %s -heapSnapshot <snapshot file> [<count>]\n", argv[0]);
+			rc = -1;
+		} else {
+			rc = analyzeHeapSnapshot(argv[2], (4 == argc) ? (uintptr_t)atoi(argv[3]) : 10, &portLibrary);
+		}
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return (int)rc;
+	}
+
 	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
 	if(rcFile == (uintptr_t)-1) {
@@ -94,6 +139,76 @@ int main(void)
 	omrthread_detach(NULL);
 }
 
+int
+decode(const char *ringFileName, const char *xmlFileName, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	std::string xml;
+
+	if (!decodeVerboseGCRing(portLibrary, ringFileName, xml)) {
+		return -1;
+	}
+
+	if (NULL == xmlFileName) {
+		fwrite(xml.c_str(), 1, xml.length(), stdout);
+		return 0;
+	}
+
+	intptr_t fd = omrfile_open(xmlFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		fprintf(stderr, "Failed to open %s\n", xmlFileName);
+		return -1;
+	}
+	intptr_t bytesWritten = omrfile_write(fd, xml.c_str(), (intptr_t)xml.length());
+	omrfile_close(fd);
+	if ((intptr_t)xml.length() != bytesWritten) {
+		fprintf(stderr, "Failed to write %s\n", xmlFileName);
+		return -1;
+	}
+
+	return 0;
+}
+
+int
+analyzeHeapSnapshot(const char *snapshotFileName, uintptr_t topCount, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	HeapSnapshotGraph graph;
+	HeapSnapshotDominators dominators;
+
+	if (!readHeapSnapshot(portLibrary, snapshotFileName, graph)) {
+		fprintf(stderr, "Failed to read heap snapshot %s\n", snapshotFileName);
+		return -1;
+	}
+	computeHeapSnapshotDominators(graph, dominators);
+
+	size_t objectCount = graph.offsets.size();
+	omrtty_printf("\nResults for : %s\n", snapshotFileName);
+	omrtty_printf("Objects    : %zu (%llu bytes)\n", objectCount, dominators.retainedSizes[objectCount]);
+	omrtty_printf("References : %zu (%llu dangling)\n", graph.references.size(), graph.danglingReferenceCount);
+	omrtty_printf("Roots      : %zu (inferred)\n\n", dominators.roots.size());
+
+	std::vector<size_t> objects(objectCount);
+	for (size_t i = 0; i < objectCount; i++) {
+		objects[i] = i;
+	}
+	size_t shown = std::min((size_t)topCount, objectCount);
+	std::partial_sort(objects.begin(), objects.begin() + shown, objects.end(), RetainedSizeOrder(dominators.retainedSizes));
+
+	omrtty_printf("            Object            Size          Retained         Dominator\n");
+	omrtty_printf("-----------------------------------------------------------------------\n");
+	for (size_t i = 0; i < shown; i++) {
+		size_t object = objects[i];
+		size_t dominator = dominators.dominators[object];
+		uint64_t dominatorAddress = (objectCount == dominator) ? 0 : (graph.heapBase + (graph.offsets[dominator] * graph.objectAlignment));
+		omrtty_printf("0x%016llx  %12llu  %16llu  0x%016llx\n",
+			graph.heapBase + (graph.offsets[object] * graph.objectAlignment), graph.sizes[object], dominators.retainedSizes[object], dominatorAddress);
+	}
+	omrtty_printf("\n");
+
+	return 0;
+}
+
 double
 getAvg(std::vector<double> v)
 {
@@ -132,9 +247,18 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double avgGCDuration = 0;
 
 	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	pugi::xml_parse_result result;
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+	if (isVerboseGCRing(&portLibrary, fileName)) {
+		std::string xml;
+		if (decodeVerboseGCRing(&portLibrary, fileName, xml)) {
+			result = doc.load_buffer(xml.c_str(), xml.length());
+		}
+	} else {
+		result = doc.load_file(fileName);
+	}
+
 	if(!result) {
 		omrtty_printf("Error loading file : %s\n", fileName);
 		return;
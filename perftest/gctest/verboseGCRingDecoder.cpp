@@ -0,0 +1,331 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "verboseGCRingDecoder.hpp"
+
+#include "VerboseRingBufferFormat.hpp"
+
+#define INDENT_SPACER "  "
+
+/* A format table entry of the file being decoded */
+struct RingFormat {
+	const char *format;
+	const uint8_t *argumentTypes;
+	uint32_t argumentCount;
+};
+
+static bool
+readFile(OMRPortLibrary *portLibrary, const char *fileName, std::vector<uint8_t> &contents)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+
+	bool result = true;
+	int64_t length = omrfile_flength(fd);
+	if (length < (int64_t)sizeof(VerboseRingBufferHeader)) {
+		result = false;
+	} else {
+		contents.resize((size_t)length);
+		size_t offset = 0;
+		while (offset < contents.size()) {
+			intptr_t bytesRead = omrfile_read(fd, &contents[offset], (intptr_t)(contents.size() - offset));
+			if (bytesRead <= 0) {
+				result = false;
+				break;
+			}
+			offset += (size_t)bytesRead;
+		}
+	}
+	omrfile_close(fd);
+
+	return result;
+}
+
+/**
+ * Find the end of the next conversion in a format string, in the same way the writer found its arguments.
+ * @return the character following the conversion, or NULL if there are no more conversions
+ */
+static const char *
+findConversionEnd(const char *cursor)
+{
+	while ('\0' != *cursor) {
+		if ('%' != *cursor++) {
+			continue;
+		}
+		if ('%' == *cursor) {
+			cursor += 1;
+			continue;
+		}
+		while ((NULL != strchr("0 -+#123456789.zl", *cursor)) && ('\0' != *cursor)) {
+			cursor += 1;
+		}
+		if ('\0' == *cursor) {
+			return NULL;
+		}
+		return cursor + 1;
+	}
+	return NULL;
+}
+
+/**
+ * Format a piece of a line holding at most one conversion, and append it.
+ */
+static void
+appendSegment(OMRPortLibrary *portLibrary, std::string &xml, const std::string &segment, uint8_t argumentType, const uint8_t *argument, uint32_t stringLength)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const char *format = segment.c_str();
+	std::vector<char> buffer;
+	uintptr_t size = 0;
+
+	switch (argumentType) {
+	case VERBOSE_RING_BUFFER_ARGUMENT_U32:
+	{
+		uint32_t value = (uint32_t)*(const uint64_t *)argument;
+		size = omrstr_printf(NULL, 0, format, value);
+		buffer.resize(size);
+		omrstr_printf(&buffer[0], size, format, value);
+		break;
+	}
+	case VERBOSE_RING_BUFFER_ARGUMENT_U64:
+	{
+		uint64_t value = *(const uint64_t *)argument;
+		size = omrstr_printf(NULL, 0, format, value);
+		buffer.resize(size);
+		omrstr_printf(&buffer[0], size, format, value);
+		break;
+	}
+	case VERBOSE_RING_BUFFER_ARGUMENT_DOUBLE:
+	{
+		double value = 0.0;
+		memcpy(&value, argument, sizeof(value));
+		size = omrstr_printf(NULL, 0, format, value);
+		buffer.resize(size);
+		omrstr_printf(&buffer[0], size, format, value);
+		break;
+	}
+	case VERBOSE_RING_BUFFER_ARGUMENT_POINTER:
+	{
+		void *value = (void *)(uintptr_t)*(const uint64_t *)argument;
+		size = omrstr_printf(NULL, 0, format, value);
+		buffer.resize(size);
+		omrstr_printf(&buffer[0], size, format, value);
+		break;
+	}
+	case VERBOSE_RING_BUFFER_ARGUMENT_STRING:
+	{
+		std::string value;
+		const char *string = NULL;
+		if (VERBOSE_RING_BUFFER_NULL_STRING != stringLength) {
+			value.assign((const char *)argument, stringLength);
+			string = value.c_str();
+		}
+		size = omrstr_printf(NULL, 0, format, string);
+		buffer.resize(size);
+		omrstr_printf(&buffer[0], size, format, string);
+		break;
+	}
+	default:
+		/* the trailing text of the line, with no conversion */
+		size = omrstr_printf(NULL, 0, format);
+		buffer.resize(size);
+		omrstr_printf(&buffer[0], size, format);
+		break;
+	}
+
+	xml.append(&buffer[0]);
+}
+
+/**
+ * Decode one formatted record, whose arguments span [arguments, end).
+ * @return false if the record does not match its format
+ */
+static bool
+appendFormattedRecord(OMRPortLibrary *portLibrary, std::string &xml, const RingFormat *format, const uint8_t *arguments, const uint8_t *end)
+{
+	const char *cursor = format->format;
+
+	for (uint32_t i = 0; i < format->argumentCount; i++) {
+		const char *conversionEnd = findConversionEnd(cursor);
+		if ((NULL == conversionEnd) || ((arguments + sizeof(uint64_t)) > end)) {
+			return false;
+		}
+		uint8_t argumentType = format->argumentTypes[i];
+		const uint8_t *argument = arguments;
+		uint32_t stringLength = 0;
+		arguments += sizeof(uint64_t);
+		if (VERBOSE_RING_BUFFER_ARGUMENT_STRING == argumentType) {
+			stringLength = *(const uint32_t *)argument;
+			argument = arguments;
+			if (VERBOSE_RING_BUFFER_NULL_STRING != stringLength) {
+				arguments += (stringLength + VERBOSE_RING_BUFFER_ALIGNMENT - 1) & ~(uintptr_t)(VERBOSE_RING_BUFFER_ALIGNMENT - 1);
+				if (arguments > end) {
+					return false;
+				}
+			}
+		}
+		appendSegment(portLibrary, xml, std::string(cursor, conversionEnd - cursor), argumentType, argument, stringLength);
+		cursor = conversionEnd;
+	}
+	appendSegment(portLibrary, xml, std::string(cursor), 0, NULL, 0);
+
+	return true;
+}
+
+bool
+isVerboseGCRing(OMRPortLibrary *portLibrary, const char *fileName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+	uint32_t magic = 0;
+	intptr_t bytesRead = omrfile_read(fd, &magic, sizeof(magic));
+	omrfile_close(fd);
+
+	return (sizeof(magic) == bytesRead) && (VERBOSE_RING_BUFFER_MAGIC == magic);
+}
+
+bool
+decodeVerboseGCRing(OMRPortLibrary *portLibrary, const char *fileName, std::string &xml)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	std::vector<uint8_t> contents;
+
+	if (!readFile(portLibrary, fileName, contents)) {
+		omrtty_printf("Error reading file : %s\n", fileName);
+		return false;
+	}
+
+	const uint8_t *base = &contents[0];
+	const VerboseRingBufferHeader *header = (const VerboseRingBufferHeader *)base;
+	uint64_t fileSize = contents.size();
+	if ((VERBOSE_RING_BUFFER_MAGIC != header->magic) || (VERBOSE_RING_BUFFER_VERSION != header->version)) {
+		omrtty_printf("Not a verbose GC ring buffer file (version %u) : %s\n", VERBOSE_RING_BUFFER_VERSION, fileName);
+		return false;
+	}
+	if ((header->pointerSize > sizeof(void *))
+		|| ((header->textOffset + header->headerTextLength + header->footerTextLength) > fileSize)
+		|| (header->formatTableUsed > header->formatTableSize)
+		|| ((header->formatTableOffset + header->formatTableSize) > fileSize)
+		|| ((header->ringOffset + header->ringSize) > fileSize)
+		|| (header->tail > header->head)
+		|| ((header->head - header->tail) > header->ringSize)
+	) {
+		omrtty_printf("Corrupt verbose GC ring buffer file : %s\n", fileName);
+		return false;
+	}
+
+	/* number the formats */
+	std::vector<RingFormat> formats;
+	const uint8_t *formatCursor = base + header->formatTableOffset;
+	const uint8_t *formatTableEnd = formatCursor + header->formatTableUsed;
+	for (uint32_t i = 0; i < header->formatCount; i++) {
+		const VerboseRingBufferFormat *entry = (const VerboseRingBufferFormat *)formatCursor;
+		if (((formatCursor + sizeof(VerboseRingBufferFormat)) > formatTableEnd)
+			|| ((formatCursor + entry->length) > formatTableEnd)
+			|| ((sizeof(VerboseRingBufferFormat) + entry->argumentCount) >= entry->length)
+			|| (VERBOSE_RING_BUFFER_MAX_ARGUMENTS < entry->argumentCount)
+		) {
+			omrtty_printf("Corrupt format table in verbose GC ring buffer file : %s\n", fileName);
+			return false;
+		}
+		RingFormat format;
+		format.argumentTypes = (const uint8_t *)(entry + 1);
+		format.argumentCount = entry->argumentCount;
+		format.format = (const char *)(format.argumentTypes + format.argumentCount);
+		formats.push_back(format);
+		formatCursor += entry->length;
+	}
+
+	xml.assign((const char *)(base + header->textOffset), header->headerTextLength);
+	if ((0 != header->overwrittenRecords) || (0 != header->droppedRecords)) {
+		char comment[128];
+		omrstr_printf(comment, sizeof(comment), "<!-- %llu records overwritten, %llu records dropped -->\n", header->overwrittenRecords, header->droppedRecords);
+		xml.append(comment);
+	}
+
+	/* Once the ring has wrapped around, the oldest records left may be the end of a stanza: skip to the start of the next one */
+	bool skipToStanza = (0 != header->overwrittenRecords);
+	const uint8_t *ring = base + header->ringOffset;
+	uint64_t position = header->tail;
+	while (position < header->head) {
+		const VerboseRingBufferRecord *record = (const VerboseRingBufferRecord *)(ring + (position % header->ringSize));
+		uint64_t offset = position % header->ringSize;
+		if ((record->length < sizeof(VerboseRingBufferRecord))
+			|| (0 != (record->length % VERBOSE_RING_BUFFER_RECORD_ALIGNMENT))
+			|| ((offset + record->length) > header->ringSize)
+		) {
+			omrtty_printf("Corrupt record at %llu in verbose GC ring buffer file : %s\n", position, fileName);
+			return false;
+		}
+		position += record->length;
+
+		const uint8_t *payload = (const uint8_t *)(record + 1);
+		const uint8_t *end = (const uint8_t *)record + record->length;
+		std::string line;
+		switch (record->type) {
+		case VERBOSE_RING_BUFFER_RECORD_PAD:
+			continue;
+		case VERBOSE_RING_BUFFER_RECORD_FORMATTED:
+			if ((record->formatId >= formats.size())
+				|| !appendFormattedRecord(portLibrary, line, &formats[record->formatId], payload, end)
+			) {
+				omrtty_printf("Corrupt record at %llu in verbose GC ring buffer file : %s\n", position - record->length, fileName);
+				return false;
+			}
+			break;
+		case VERBOSE_RING_BUFFER_RECORD_TEXT:
+			line.assign((const char *)payload, strnlen((const char *)payload, end - payload));
+			break;
+		default:
+			omrtty_printf("Unknown record type %u in verbose GC ring buffer file : %s\n", record->type, fileName);
+			return false;
+		}
+
+		if (skipToStanza) {
+			if ((0 != record->indent) || (0 != line.compare(0, 1, "<")) || (0 == line.compare(0, 2, "</"))) {
+				continue;
+			}
+			skipToStanza = false;
+		}
+		for (uint16_t i = 0; i < record->indent; i++) {
+			xml.append(INDENT_SPACER);
+		}
+		xml.append(line);
+		xml.append("\n");
+	}
+
+	xml.append((const char *)(base + header->textOffset + header->headerTextLength), header->footerTextLength);
+
+	return true;
+}
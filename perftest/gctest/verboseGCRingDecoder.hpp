@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCRINGDECODER_HPP_)
+#define VERBOSEGCRINGDECODER_HPP_
+
+#include <string>
+
+#include "omrport.h"
+
+/**
+ * Check whether a verbose GC file was written by the ring buffer writer (-Xgc:verboseRingBufferSize=),
+ * rather than as XML text.
+ */
+bool isVerboseGCRing(OMRPortLibrary *portLibrary, const char *fileName);
+
+/**
+ * Convert a verbose GC ring buffer file back to the XML the text writers would have written for the records it
+ * still holds. Lines are formatted with omrstr_printf(), as they would have been by the writer.
+ * @param[out] xml the decoded document
+ * @return true on success, false if the file is not a valid ring buffer file
+ */
+bool decodeVerboseGCRing(OMRPortLibrary *portLibrary, const char *fileName, std::string &xml);
+
+#endif /* VERBOSEGCRINGDECODER_HPP_ */
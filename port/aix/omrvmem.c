@@ -1509,3 +1509,9 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	Trc_PRT_vmem_get_process_memory_exit(result, *memorySize);
 	return result;
 }
+
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBackedSize)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -372,3 +372,19 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+ * Get the number of bytes of a reserved range which are currently backed by huge pages, whether explicit
+ * (hugetlbfs) large pages or transparent huge pages. This is only supported on Linux.
+ * @param [in] portLibrary port library
+ * @param [in] address start of the range to query
+ * @param [in] byteAmount size of the range to query
+ * @param [in] identifier descriptor for the virtual memory block containing the range
+ * @param [out] hugePageBackedSize pointer to variable to receive result
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED or OMRPORT_ERROR_VMEM_INVALID_PARAMS if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBackedSize)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
@@ -744,6 +744,19 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 	}
 #endif
 
+#if defined(MADV_HUGEPAGE)
+	/* Transparent huge pages only apply to default page mappings; explicit large pages are already huge */
+	if ((NULL != memoryPointer)
+		&& OMR_ARE_ANY_BITS_SET(params->options, OMRPORT_VMEM_ADVISE_HUGEPAGE)
+		&& (OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator)
+	) {
+		if (0 != madvise(identifier->address, identifier->size, MADV_HUGEPAGE)) {
+			/* The reservation is still usable, just backed by default pages */
+			Trc_PRT_vmem_omrvmem_reserve_memory_advise_hugepage_failure(errno, identifier->address, identifier->size);
+		}
+	}
+#endif /* defined(MADV_HUGEPAGE) */
+
 #if defined(OMRVMEM_DEBUG)
 	printf("\tomrvmem_reserve_memory_ex returning %p\n", memoryPointer);
 	fflush(stdout);
@@ -1689,3 +1702,67 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	Trc_PRT_vmem_get_process_memory_exit(result, *memorySize);
 	return result;
 }
+
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBackedSize)
+{
+	int32_t result = OMRPORT_ERROR_VMEM_OPFAILED;
+	uintptr_t backedSize = 0;
+	Trc_PRT_vmem_get_huge_page_backed_size_enter(address, byteAmount);
+
+	if (!rangeIsValid(identifier, address, byteAmount)) {
+		Trc_PRT_vmem_get_huge_page_backed_size_failed("range check", 0);
+		result = OMRPORT_ERROR_VMEM_INVALID_PARAMS;
+	} else if (OMRPORT_VMEM_RESERVE_USED_SHM == identifier->allocator) {
+		/* hugetlbfs pages are allocated when the segment is attached so the whole range is backed */
+		backedSize = byteAmount;
+		result = 0;
+	} else {
+		/* Transparent huge pages are reported per mapping as AnonHugePages in /proc/self/smaps */
+		char *smapsFilename = "/proc/self/smaps";
+		FILE *smapsStream = fopen(smapsFilename, "r");
+		if (NULL != smapsStream) {
+			uintptr_t rangeStart = (uintptr_t)address;
+			uintptr_t rangeEnd = rangeStart + byteAmount;
+			uintptr_t mappingStart = 0;
+			uintptr_t mappingEnd = 0;
+			char line[512];
+
+			while (NULL != fgets(line, sizeof(line), smapsStream)) {
+				uintptr_t start = 0;
+				uintptr_t end = 0;
+				uintptr_t hugePageKilobytes = 0;
+
+				if (NULL == strchr(line, '\n')) {
+					/* skip the rest of an over-long line (a mapping with a long path name) */
+					int c = 0;
+					do {
+						c = fgetc(smapsStream);
+					} while ((EOF != c) && ('\n' != c));
+				}
+
+				if (2 == sscanf(line, "%" SCNxPTR "-%" SCNxPTR " ", &start, &end)) {
+					/* header line of the next mapping */
+					mappingStart = start;
+					mappingEnd = end;
+				} else if ((1 == sscanf(line, "AnonHugePages: %" SCNuPTR " kB", &hugePageKilobytes))
+					&& (mappingStart < rangeEnd) && (mappingEnd > rangeStart)
+				) {
+					uintptr_t overlap = OMR_MIN(mappingEnd, rangeEnd) - OMR_MAX(mappingStart, rangeStart);
+					backedSize += OMR_MIN(overlap, hugePageKilobytes * 1024);
+				}
+			}
+			fclose(smapsStream);
+			result = 0;
+		} else {
+			Trc_PRT_vmem_get_huge_page_backed_size_failed(smapsFilename, (intptr_t)errno);
+			result = OMRPORT_ERROR_VMEM_OPFAILED;
+		}
+	}
+
+	if (0 == result) {
+		*hugePageBackedSize = backedSize;
+	}
+	Trc_PRT_vmem_get_huge_page_backed_size_exit(result, backedSize);
+	return result;
+}
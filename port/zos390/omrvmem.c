@@ -1569,6 +1569,12 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
 
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBackedSize)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
 #if defined(OMR_ENV_DATA64)
 static BOOLEAN
 isRmode64Supported()
@@ -1846,3 +1846,9 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary,
 
 	return result;
 }
+
+int32_t
+omrvmem_get_huge_page_backed_size(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBackedSize)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}